@@ -0,0 +1,182 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file BoundingBoxIndex.cpp
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Geom/BoundingBoxIndex.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cmath>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+/*----------------------------------------------------------------------------*/
+/// nombre maximum de cellules dans une direction
+static const uint NB_MAX_CELLULES_DIR = 64;
+/// nombre maximum de cellules recouvertes par une boîte rangée dans la grille
+static const uint NB_MAX_CELLULES_BOITE = 64;
+/*----------------------------------------------------------------------------*/
+/// vrai si la boîte est vide
+static bool estVide(const double* bounds)
+{
+    return bounds[0] > bounds[1] || bounds[2] > bounds[3] || bounds[4] > bounds[5];
+}
+/*----------------------------------------------------------------------------*/
+/// vrai si la boîte est finie
+static bool estFinie(const double* bounds)
+{
+    for (uint i=0; i<6; i++)
+        if (!std::isfinite(bounds[i]))
+            return false;
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+BoundingBoxIndex::BoundingBoxIndex()
+{
+    for (uint d=0; d<3; d++){
+        m_min[d] = 0.0;
+        m_step[d] = 1.0;
+        m_nb[d] = 1;
+    }
+}
+/*----------------------------------------------------------------------------*/
+void BoundingBoxIndex::add(const double bounds[6])
+{
+    m_bounds.insert(m_bounds.end(), bounds, bounds+6);
+}
+/*----------------------------------------------------------------------------*/
+void BoundingBoxIndex::build()
+{
+    const uint nb_boxes = getNbBoxes();
+    m_cells.clear();
+    m_large.clear();
+
+    // boîte englobant les boîtes finies
+    double box[6] = {HUGE_VAL, -HUGE_VAL, HUGE_VAL, -HUGE_VAL, HUGE_VAL, -HUGE_VAL};
+    for (uint i=0; i<nb_boxes; i++){
+        const double* b = &m_bounds[6*i];
+        if (estVide(b) || !estFinie(b))
+            continue;
+        for (uint d=0; d<3; d++){
+            box[2*d] = std::min(box[2*d], b[2*d]);
+            box[2*d+1] = std::max(box[2*d+1], b[2*d+1]);
+        }
+    }
+
+    // environ une cellule par boîte
+    uint nb_dir = (uint)std::ceil(std::cbrt((double)nb_boxes));
+    if (nb_dir < 1)
+        nb_dir = 1;
+    if (nb_dir > NB_MAX_CELLULES_DIR)
+        nb_dir = NB_MAX_CELLULES_DIR;
+    for (uint d=0; d<3; d++){
+        if (box[2*d] > box[2*d+1]){
+            m_min[d] = 0.0;
+            m_step[d] = 1.0;
+            m_nb[d] = 1;
+        }
+        else {
+            m_min[d] = box[2*d];
+            m_nb[d] = nb_dir;
+            m_step[d] = (box[2*d+1] - box[2*d]) / nb_dir;
+            if (m_step[d] <= 0.0){
+                m_step[d] = 1.0;
+                m_nb[d] = 1;
+            }
+        }
+    }
+    m_cells.resize(m_nb[0]*m_nb[1]*m_nb[2]);
+
+    for (uint i=0; i<nb_boxes; i++){
+        const double* b = &m_bounds[6*i];
+        if (estVide(b))
+            continue;
+        if (!estFinie(b)){
+            m_large.push_back(i);
+            continue;
+        }
+        uint c_min[3], c_max[3];
+        uint nb_cells = 1;
+        for (uint d=0; d<3; d++){
+            c_min[d] = cell(d, b[2*d]);
+            c_max[d] = cell(d, b[2*d+1]);
+            nb_cells *= c_max[d] - c_min[d] + 1;
+        }
+        if (nb_cells > NB_MAX_CELLULES_BOITE){
+            m_large.push_back(i);
+            continue;
+        }
+        for (uint k=c_min[2]; k<=c_max[2]; k++)
+            for (uint j=c_min[1]; j<=c_max[1]; j++)
+                for (uint l=c_min[0]; l<=c_max[0]; l++)
+                    m_cells[l + m_nb[0]*(j + m_nb[1]*k)].push_back(i);
+    }
+}
+/*----------------------------------------------------------------------------*/
+uint BoundingBoxIndex::cell(uint dir, double x) const
+{
+    double pos = std::floor((x - m_min[dir]) / m_step[dir]);
+    if (!(pos > 0.0))
+        return 0;
+    if (pos >= (double)m_nb[dir])
+        return m_nb[dir]-1;
+    return (uint)pos;
+}
+/*----------------------------------------------------------------------------*/
+bool BoundingBoxIndex::overlap(uint i, const double bounds[6]) const
+{
+    const double* b = &m_bounds[6*i];
+    if (estVide(b))
+        return false;
+    for (uint d=0; d<3; d++)
+        if (b[2*d] > bounds[2*d+1] || bounds[2*d] > b[2*d+1])
+            return false;
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+void BoundingBoxIndex::getCandidates(const double bounds[6], std::vector<uint>& ids) const
+{
+    ids.clear();
+    if (estVide(bounds))
+        return;
+
+    uint c_min[3], c_max[3];
+    size_t nb_cells = 1;
+    for (uint d=0; d<3; d++){
+        c_min[d] = std::isfinite(bounds[2*d]) ? cell(d, bounds[2*d]) : 0;
+        c_max[d] = std::isfinite(bounds[2*d+1]) ? cell(d, bounds[2*d+1]) : m_nb[d]-1;
+        nb_cells *= c_max[d] - c_min[d] + 1;
+    }
+
+    if (nb_cells >= m_cells.size()){
+        // la recherche couvre toute la grille
+        for (uint i=0; i<getNbBoxes(); i++)
+            if (overlap(i, bounds))
+                ids.push_back(i);
+        return;
+    }
+
+    for (uint k=c_min[2]; k<=c_max[2]; k++)
+        for (uint j=c_min[1]; j<=c_max[1]; j++)
+            for (uint l=c_min[0]; l<=c_max[0]; l++){
+                const std::vector<uint>& in_cell = m_cells[l + m_nb[0]*(j + m_nb[1]*k)];
+                ids.insert(ids.end(), in_cell.begin(), in_cell.end());
+            }
+    ids.insert(ids.end(), m_large.begin(), m_large.end());
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    uint nb = 0;
+    for (uint i=0; i<ids.size(); i++)
+        if (overlap(ids[i], bounds))
+            ids[nb++] = ids[i];
+    ids.resize(nb);
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Geom
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -52,25 +52,28 @@ CommandCreateGeom::CommandCreateGeom(Internal::Context& c, std::string name,
 CommandCreateGeom::~CommandCreateGeom()
 {
     // Suppression par le manager des entités détruites
+    if (!getContext().isFinished())
+        deleteDestroyedEntities();
+}
+/*----------------------------------------------------------------------------*/
+void CommandCreateGeom::deleteDestroyedEntities()
+{
     Internal::InfoCommand& icmd = getInfoCommand();
-
-    if (!getContext().isFinished()) {
-        for (uint i = 0; i < icmd.getNbGeomInfoEntity(); i++) {
-            GeomEntity *ge = 0;
-            Internal::InfoCommand::type t;
-            icmd.getGeomInfoEntity(i, ge, t);
-
-            if (ge) {
-                if (Internal::InfoCommand::DELETED == t) {
-                    getGeomManager().removeEntity(ge);
-                    // destruction des entités que l'on avait construites
-                    delete ge;
-                }
-            } else
-                std::cerr << "Erreur interne dans ~CommandCreateGeom, GeomEntity nulle" << std::endl;
-        } // end for i<icmd.getNbGeomInfoEntity()
-    }
-
+    for (uint i=0; i<icmd.getNbGeomInfoEntity(); i++) {
+        GeomEntity* ge = 0;
+        Internal::InfoCommand::type t;
+        icmd.getGeomInfoEntity(i, ge, t);
+
+        if (ge){
+            if (Internal::InfoCommand::DELETED == t) {
+                getGeomManager().removeEntity(ge);
+                // destruction des entités que l'on avait construites
+                delete ge;
+            }
+        }
+        else
+            std::cerr<<"Erreur interne dans CommandCreateGeom::deleteDestroyedEntities, GeomEntity nulle"<<std::endl;
+    } // end for i<icmd.getNbGeomInfoEntity()
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateGeom::preExecute()
@@ -29,12 +29,16 @@ class Volume;
 /*----------------------------------------------------------------------------*/
 CommandCut::
 CommandCut(Internal::Context& c, GeomEntity* e,
-           std::vector<GeomEntity*>& es)
+           std::vector<GeomEntity*>& es, double tolerance)
 : CommandEditGeom(c, "Différence Booléenne"),m_entity(e),
   m_cutting_entities(es)
 {
     validate();
-    m_impl = new GeomCutImplementation(c, m_entity, m_cutting_entities);
+    if (tolerance < 0.0)
+        throw TkUtil::Exception(TkUtil::UTF8String ("La tolérance de l'opération booléenne doit être positive ou nulle", TkUtil::Charset::UTF_8));
+    GeomCutImplementation* impl = new GeomCutImplementation(c, m_entity, m_cutting_entities);
+    impl->setFuzzyValue(tolerance);
+    m_impl = impl;
 
     TkUtil::UTF8String comments (TkUtil::Charset::UTF_8);
 	comments << "Différence Booléenne pour "<<m_entity->getName();
@@ -16,6 +16,7 @@
 #include "Geom/Surface.h"
 #include "Geom/Curve.h"
 #include "Geom/Vertex.h"
+#include "Geom/OCCGeomRepresentation.h"
 #include "Group/GroupManager.h"
 #include "Group/Group3D.h"
 #include "Group/Group2D.h"
@@ -28,6 +29,12 @@
 #include <TkUtil/ReferencedMutex.h>
 #include <TkUtil/MemoryError.h>
 
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+
 //#include <GMDSCommon/Timer.h>
 /*----------------------------------------------------------------------------*/
 using namespace TkUtil;
@@ -278,6 +285,94 @@ void CommandEditGeom::deleteMementos()
     m_mementos.clear();
 }
 /*----------------------------------------------------------------------------*/
+/// estimation de la mémoire occupée par une entité géométrique et ses shapes OCC
+static size_t tailleEntiteGeom(GeomEntity* ge)
+{
+    // une sous-shape : la shape et un noeud
+    const size_t shape = sizeof(TopoDS_Shape) + 2*sizeof(void*);
+
+    size_t taille = 0;
+    if (dynamic_cast<Volume*>(ge))
+        taille = sizeof(Volume);
+    else if (dynamic_cast<Surface*>(ge))
+        taille = sizeof(Surface);
+    else if (dynamic_cast<Curve*>(ge))
+        taille = sizeof(Curve);
+    else
+        taille = sizeof(Vertex);
+
+    std::vector<GeomRepresentation*> loc_reps = ge->getComputationalProperties();
+    for (uint j=0; j<loc_reps.size(); j++){
+        OCCGeomRepresentation* occ_rep = dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
+        if (0 == occ_rep)
+            continue;
+        TopTools_IndexedMapOfShape sous_shapes;
+        TopExp::MapShapes(occ_rep->getShape(), sous_shapes);
+        taille += sous_shapes.Extent()*shape;
+
+        // la triangulation des faces est l'essentiel de la mémoire
+        for (int i=1; i<=sous_shapes.Extent(); i++){
+            if (sous_shapes(i).ShapeType() != TopAbs_FACE)
+                continue;
+            TopLoc_Location aLoc;
+            Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(TopoDS::Face(sous_shapes(i)), aLoc);
+            if (!triangulation.IsNull())
+                taille += triangulation->NbNodes()*sizeof(gp_Pnt)
+                        + triangulation->NbTriangles()*sizeof(Poly_Triangle);
+        }
+    }
+    return taille;
+}
+/*----------------------------------------------------------------------------*/
+size_t CommandEditGeom::getMemoryFootprint ( ) const
+{
+    // un noeud de std::map : la valeur, 3 pointeurs et la couleur
+    const size_t noeud = sizeof(std::pair<GeomEntity* const,MementoGeomEntity>) + 4*sizeof(void*);
+
+    size_t taille = Internal::CommandInternal::getMemoryFootprint()
+            + m_mementos.size()*noeud;
+    if (m_impl)
+        taille += m_impl->getShapeHistory().getMemorySize();
+
+    // les entités détruites (ou créées puis annulées) sont conservées
+    // jusqu'à la destruction de la commande
+    Internal::InfoCommand& icmd = const_cast<CommandEditGeom*>(this)->getInfoCommand();
+    for (uint i=0; i<icmd.getNbGeomInfoEntity(); i++) {
+        GeomEntity* ge = 0;
+        Internal::InfoCommand::type t;
+        icmd.getGeomInfoEntity(i, ge, t);
+        if (ge && Internal::InfoCommand::DELETED == t)
+            taille += tailleEntiteGeom(ge);
+    }
+    return taille;
+}
+/*----------------------------------------------------------------------------*/
+size_t CommandEditGeom::getReleasableMemory ( ) const
+{
+    if (Command::DONE != getStatus ( ))
+        return 0;
+
+    // tout sauf la commande elle-même
+    return getMemoryFootprint() - sizeof(Internal::CommandInternal);
+}
+/*----------------------------------------------------------------------------*/
+bool CommandEditGeom::releaseUndoData ( )
+{
+    TkUtil::AutoReferencedMutex autoMutex (getMutex ( ));
+
+    if (Command::DONE != getStatus ( ))
+        return false;
+
+    deleteMementos();
+    if (m_impl)
+        m_impl->clearShapeHistory();
+
+    // les entités détruites par la commande ne seront plus restaurées
+    deleteDestroyedEntities();
+    releaseInternalUndoData();
+    return true;
+}
+/*----------------------------------------------------------------------------*/
 void CommandEditGeom::copyGroups(GeomEntity* ge1, GeomEntity* ge2)
 {
     if (ge1->getDim() == 3 && ge2->getDim() == 3){
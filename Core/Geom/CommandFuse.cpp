@@ -28,11 +28,16 @@ class Surface;
 class Volume;
 /*----------------------------------------------------------------------------*/
 CommandFuse::
-CommandFuse(Internal::Context& c,std::vector<GeomEntity*> e)
+CommandFuse(Internal::Context& c,std::vector<GeomEntity*> e,
+            double tolerance)
 : CommandEditGeom(c, "Fusion Booléenne"), m_entities(e)
 {
     validate();
-    m_impl = new GeomFuseImplementation(c, m_entities);
+    if (tolerance < 0.0)
+        throw TkUtil::Exception(TkUtil::UTF8String ("La tolérance de l'opération booléenne doit être positive ou nulle", TkUtil::Charset::UTF_8));
+    GeomFuseImplementation* impl = new GeomFuseImplementation(c, m_entities);
+    impl->setFuzzyValue(tolerance);
+    m_impl = impl;
 
     TkUtil::UTF8String comments (TkUtil::Charset::UTF_8);
 	comments << "Fusion Booléenne de ";
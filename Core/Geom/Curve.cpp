@@ -9,6 +9,7 @@
 #include "Internal/ContextIfc.h"
 /*----------------------------------------------------------------------------*/
 #include <list>
+#include <algorithm>
 #include <string.h>
 #include <sys/types.h>
 /*----------------------------------------------------------------------------*/
@@ -58,8 +59,8 @@ namespace Geom {
 const char* Curve::typeNameGeomCurve = "GeomCurve";
 /*----------------------------------------------------------------------------*/
 Curve::Curve(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
-        GeomProperty* gprop, GeomRepresentation* compProp)
-:GeomEntity(ctx, prop, disp, gprop,compProp)
+        GeomProperty* gprop, GeomRepresentation* compProp, bool registered)
+:GeomEntity(ctx, prop, disp, gprop,compProp,registered)
 {
 }
 /*----------------------------------------------------------------------------*/
@@ -377,6 +378,15 @@ void Curve::project(Utils::Math::Point& P) const
 	}
 }
 /*----------------------------------------------------------------------------*/
+void Curve::project(std::vector<Utils::Math::Point>& points) const
+{
+	if (getComputationalProperties().size() == 1)
+		getComputationalProperty()->project(points,this);
+	else
+		for (uint i=0; i<points.size(); i++)
+			project(points[i]);
+}
+/*----------------------------------------------------------------------------*/
 void Curve::project(const Utils::Math::Point& P1, Utils::Math::Point& P2) const
 {
 	if (getComputationalProperties().size() == 1)
@@ -428,6 +438,19 @@ getPoint(const double& p, Utils::Math::Point& Pt, const bool in01) const
 	}
 }
 /*----------------------------------------------------------------------------*/
+void Curve::
+getPoints(const std::vector<double>& params, std::vector<Utils::Math::Point>& points,
+		const bool in01) const
+{
+	if (getComputationalProperties().size() == 1)
+		getComputationalProperty()->getPoints(params, points, in01);
+	else {
+		points.resize(params.size());
+		for (uint i=0; i<params.size(); i++)
+			getPoint(params[i], points[i], in01);
+	}
+}
+/*----------------------------------------------------------------------------*/
 void Curve::tangent(const Utils::Math::Point& P1, Utils::Math::Vector& V2) const
 {
 	if (getComputationalProperties().size() == 1)
@@ -598,43 +621,39 @@ void Curve::getParametricsPoints(const Utils::Math::Point& Pt0,
     std::cout<<"ratioSeuil = "<<ratioSeuil<<std::endl;
 #endif
 
+    // les paramètres sont calculés puis les points sont évalués en une fois
+    std::vector<double> params(nbPt);
+    std::vector<Utils::Math::Point> l_points;
+
     if (passeParSommet) {
     	if (paramPt0 < paramPt1){
     		for (uint i=0; i<nbPt; i++) {
-    			double paramVtx;
     			if (l_ratios[i] <= ratioSeuil)
-    				paramVtx = paramPt0 + (first-paramPt0)*l_ratios[i]/ratioSeuil;
+    				params[i] = paramPt0 + (first-paramPt0)*l_ratios[i]/ratioSeuil;
     			else
-    				paramVtx = last + (paramPt1-last)*(l_ratios[i]-ratioSeuil)/(1-ratioSeuil);
-    			Utils::Math::Point PtI;
-    			getPoint(paramVtx, PtI);
-    			points.push_back(PtI);
+    				params[i] = last + (paramPt1-last)*(l_ratios[i]-ratioSeuil)/(1-ratioSeuil);
     		}
     	}
     	else {
     		for (uint i=0; i<nbPt; i++) {
-                double paramVtx;
                 if (l_ratios[i] <= ratioSeuil)
-                    paramVtx = paramPt0 + (last-paramPt0)*l_ratios[i]/ratioSeuil;
+                    params[i] = paramPt0 + (last-paramPt0)*l_ratios[i]/ratioSeuil;
                 else
-                    paramVtx = first + (paramPt1-first)*(l_ratios[i]-ratioSeuil)/(1-ratioSeuil);
-
-                Utils::Math::Point PtI;
-                getPoint(paramVtx, PtI);
-                points.push_back(PtI);
+                    params[i] = first + (paramPt1-first)*(l_ratios[i]-ratioSeuil)/(1-ratioSeuil);
             }
         }
+    	getPoints(params, l_points);
+    	points.insert(points.end(), l_points.begin(), l_points.end());
     }
     else {
-        for (uint i=0; i<nbPt; i++){
-            double paramVtx = paramPt0 + (paramPt1-paramPt0)*l_ratios[i];
-            Utils::Math::Point PtI;
-            getPoint(paramVtx, PtI);
-            points.push_back(PtI);
+        for (uint i=0; i<nbPt; i++)
+            params[i] = paramPt0 + (paramPt1-paramPt0)*l_ratios[i];
+        getPoints(params, l_points);
+        points.insert(points.end(), l_points.begin(), l_points.end());
 #ifdef _DEBUG_GETPARAMETRICSPOINTS
-            std::cout<<"paramVtx (pour i = "<<i<<") = "<<paramVtx<<" => PtI "<<PtI<<std::endl;
+        for (uint i=0; i<nbPt; i++)
+            std::cout<<"paramVtx (pour i = "<<i<<") = "<<params[i]<<" => PtI "<<l_points[i]<<std::endl;
 #endif
-        }
 #ifndef NOT_USE_OPTIM_DISCR
         // vérification du respect de l_ratios
         double* lgi = new double[nbPt+1]; // longueurs des bras
@@ -687,12 +706,13 @@ void Curve::getParametricsPoints(const Utils::Math::Point& Pt0,
         		// on recommece ...
         		for (uint i=0; i<nbPt; i++){
         			ratios[i] += ecarts[i]*(ratios[i]-ratios[i+1])/(lgi[i]-lgi[i+1]);
-        			double paramVtx = paramPt0 + (paramPt1-paramPt0)*ratios[i];
+        			params[i] = paramPt0 + (paramPt1-paramPt0)*ratios[i];
 #ifdef _DEBUG_GETPARAMETRICSPOINTS
-        			std::cout<<"paramVtx (pour i = "<<i<<") = "<<paramVtx<<std::endl;
+        			std::cout<<"paramVtx (pour i = "<<i<<") = "<<params[i]<<std::endl;
 #endif
-        			getPoint(paramVtx, points[i+init_size]);
         		}
+        		getPoints(params, l_points);
+        		std::copy(l_points.begin(), l_points.end(), points.begin()+init_size);
         	}
         	nb_iter += 1;
         } while (ecart_max>ecart_tol && nb_iter<nb_iter_max && ecart_max_prec >= ecart_max);
@@ -786,10 +806,12 @@ void Curve::getParametricsPointsLoops(const double& alpha0,
 //        }
 //    }
 //    else {
-        for (uint i=0; i<nbPt; i++){
-            double paramVtx = alpha0 + (alpha1-alpha0)*l_ratios[i];
-            getPoint(paramVtx, l_points[i]);
-        }
+        std::vector<double> params(nbPt);
+        for (uint i=0; i<nbPt; i++)
+            params[i] = alpha0 + (alpha1-alpha0)*l_ratios[i];
+        std::vector<Utils::Math::Point> points;
+        getPoints(params, points);
+        std::copy(points.begin(), points.end(), l_points);
 //    }
 
 //   for (uint i=0; i<nbPt; i++)
@@ -13,6 +13,8 @@
 #include "Geom/FacetedCurve.h"
 #include "Geom/FacetedVertex.h"
 #include "Utils/Entity.h"
+#include "Utils/Property.h"
+#include "Utils/DisplayProperties.h"
 #include "Utils/Point.h"
 #include "Utils/Vector.h"
 #include "Utils/MgxException.h"
@@ -661,10 +663,11 @@ Curve* EntityFactory::newArcEllipse(const Geom::Vertex* center,
 }
 /*----------------------------------------------------------------------------*/
 //#define _DEBUG_BSPLINE
-Curve* EntityFactory::newBSpline(const std::vector<Utils::Math::Point>& points, int degMin, int degMax)
+OCCGeomRepresentation* EntityFactory::newBSplineRepresentation(
+		const std::vector<Utils::Math::Point>& points, int degMin, int degMax)
 {
 #ifdef _DEBUG_BSPLINE
-	std::cout<<"EntityFactory::newBSpline avec "<<points.size()<<" points"<<std::endl;
+	std::cout<<"EntityFactory::newBSplineRepresentation avec "<<points.size()<<" points"<<std::endl;
 #endif
     //gmds::Timer t1;
     OCCGeomRepresentation* rep =0;
@@ -744,6 +747,13 @@ Curve* EntityFactory::newBSpline(const std::vector<Utils::Math::Point>& points,
         throw Utils::BuildingException(TkUtil::UTF8String ("Erreur durant la creation d'une bspline", TkUtil::Charset::UTF_8));
     }
 
+    return rep;
+}
+/*----------------------------------------------------------------------------*/
+Curve* EntityFactory::newBSpline(const std::vector<Utils::Math::Point>& points, int degMin, int degMax)
+{
+    OCCGeomRepresentation* rep = newBSplineRepresentation(points, degMin, degMax);
+
     Curve*	curve	= new Curve(m_context,
                 m_context.newProperty(Utils::Entity::GeomCurve),
                 m_context.newDisplayProperties(Utils::Entity::GeomCurve),
@@ -751,8 +761,20 @@ Curve* EntityFactory::newBSpline(const std::vector<Utils::Math::Point>& points,
 	CHECK_NULL_PTR_ERROR (curve)
 	m_context.newGraphicalRepresentation (*curve);
 
-    //gmds::Timer t6;
-    //std::cerr<<"GLOBAL time = "<<t6-t1<<std::endl;
+	return curve;
+}
+/*----------------------------------------------------------------------------*/
+Curve* EntityFactory::newTemporaryBSpline(const std::vector<Utils::Math::Point>& points, int degMin, int degMax)
+{
+    OCCGeomRepresentation* rep = newBSplineRepresentation(points, degMin, degMax);
+
+    // ni nom, ni identifiant, ni représentation graphique
+    Curve*	curve	= new Curve(m_context,
+                new Utils::Property(Curve::getTinyName()),
+                new Utils::DisplayProperties(),
+                new GeomProperty(),rep, false);
+	CHECK_NULL_PTR_ERROR (curve)
+
 	return curve;
 }
 /*----------------------------------------------------------------------------*/
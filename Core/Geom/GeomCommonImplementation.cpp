@@ -63,26 +63,37 @@ void GeomCommonImplementation::commonVolumes(std::vector<GeomEntity*>& res)
     GeomEntity* e1 = m_init_entities[0];
     TopoDS_Shape s1;
     getOCCShape(e1, s1);
-    for(unsigned int i=1;i<m_init_entities.size();i++){
-        GeomEntity* e2 = m_init_entities[i];
+    if (m_init_entities.size() == 2){
+        // une seule opération OCC, son historique guide la reconstruction
         TopoDS_Shape s2;
-        getOCCShape(e2, s2);
-
+        getOCCShape(m_init_entities[1], s2);
         BRepAlgoAPI_Common Common_operator(s1, s2);
-        TopoDS_Shape s;
-        if(Common_operator.IsDone())
-        {
-            s = Common_operator.Shape();
-            ShapeAnalysis_ShapeContents cont;
-            cont.Clear();
-            cont.Perform(s);
+        if(!Common_operator.IsDone())
+            throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'intersection", TkUtil::Charset::UTF_8));
+        createGeomEntities(Common_operator);
+    }
+    else {
+        // les intersections sont enchainées, seule la forme finale est exploitée
+        for(unsigned int i=1;i<m_init_entities.size();i++){
+            GeomEntity* e2 = m_init_entities[i];
+            TopoDS_Shape s2;
+            getOCCShape(e2, s2);
+
+            BRepAlgoAPI_Common Common_operator(s1, s2);
+            TopoDS_Shape s;
+            if(Common_operator.IsDone())
+            {
+                s = Common_operator.Shape();
+                ShapeAnalysis_ShapeContents cont;
+                cont.Clear();
+                cont.Perform(s);
 
 //            if (cont.NbSolids()<1){
 //                throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'intersection", TkUtil::Charset::UTF_8);
-            //}
-        }
-        else
-          throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'intersection", TkUtil::Charset::UTF_8));
+                //}
+            }
+            else
+              throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'intersection", TkUtil::Charset::UTF_8));
 
 //        for (unsigned int i = 0; i < m_init_entities.size(); i++) {
 //            GeomEntity* ei = m_init_entities[i];
@@ -96,10 +107,11 @@ void GeomCommonImplementation::commonVolumes(std::vector<GeomEntity*>& res)
 //            std::cerr<<"COM - NB Shapes modified from  "<<ei->getName()<<" : "<<modSh.Extent()<<std::endl;
 //        }
 
-        s1=s;
-    }
+            s1=s;
+        }
 
-    createGeomEntities(s1);
+        createGeomEntities(s1);
+    }
 
     //=========================================================================
     //          Gestion des groupes de volumes
@@ -57,6 +57,7 @@ GeomCutImplementation::
 GeomCutImplementation(Internal::Context& c, GeomEntity* e,
         std::vector<GeomEntity*> es)
 : GeomModificationBaseClass(c)
+, m_fuzzy(0.0)
 {
     m_entities_param.push_back(e);
     m_entities_param.insert(m_entities_param.end(),es.begin(),es.end());
@@ -86,55 +87,28 @@ void GeomCutImplementation::cutVolumes(std::vector<GeomEntity*>& res)
     TopoDS_Shape s1;
     getOCCShape(e1, s1);
 
-
-
-    GeomEntity* e2 = m_init_entities[1];
-
-    TopoDS_Shape cutting_assembly;
-
-    getOCCShape(e2, cutting_assembly);
-    for(unsigned int i=2;i<m_init_entities.size();i++){
-        GeomEntity* e3 = m_init_entities[i];
-        TopoDS_Shape s3;
-        getOCCShape(e3, s3);
-
-        BRepAlgoAPI_Fuse fuse_operator(cutting_assembly, s3);
+    // les entités à retirer sont toutes passées comme outils d'une même
+    // opération, sans les unir au préalable
+    TopTools_ListOfShape arguments, tools;
+    arguments.Append(s1);
+    for(unsigned int i=1;i<m_init_entities.size();i++){
         TopoDS_Shape s;
-        if(fuse_operator.IsDone())
-        {
-            s= fuse_operator.Shape();
-            ShapeAnalysis_ShapeContents cont;
-            cont.Clear();
-            cont.Perform(s);
-
-            if (cont.NbSolids()<1){
-                throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union des formes à supprimer: Aucun volume généré", TkUtil::Charset::UTF_8));
-            }
-        }
-        else
-            throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union des formes à supprimer: Un objet de type BRepAlgoAPI_Fuse n'a pas fonctionné", TkUtil::Charset::UTF_8));
-
-        cutting_assembly = s;
+        getOCCShape(m_init_entities[i], s);
+        tools.Append(s);
     }
 
+    BRepAlgoAPI_Cut Cut_operator;
+    Cut_operator.SetArguments(arguments);
+    Cut_operator.SetTools(tools);
+    Cut_operator.SetRunParallel(Standard_True);
+    if (m_fuzzy > 0.0)
+        Cut_operator.SetFuzzyValue(m_fuzzy);
+    Cut_operator.Build();
 
-    BRepAlgoAPI_Cut Cut_operator(s1, cutting_assembly);
-
-    TopoDS_Shape s;
-
-    if(Cut_operator.IsDone())
-    {
-        s = Cut_operator.Shape();
-        ShapeAnalysis_ShapeContents cont;
-        cont.Clear();
-        cont.Perform(s);
-    }
-    else
+    if(!Cut_operator.IsDone())
         throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de la différence", TkUtil::Charset::UTF_8));
 
-    s1 = s;
-
-    createGeomEntities(s1,true);
+    createGeomEntities(Cut_operator,true);
 
 //    {
 //    	// parcourir les surfaces associées au volume avant la coupe (Shape1),
@@ -45,8 +45,8 @@ namespace Mgx3D {
 namespace Geom {
 /*----------------------------------------------------------------------------*/
 GeomEntity::GeomEntity(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
-        GeomProperty* gprop, GeomRepresentation* compProp)
-: Internal::InternalEntity (ctx, prop, disp),
+        GeomProperty* gprop, GeomRepresentation* compProp, bool registered)
+: Internal::InternalEntity (ctx, prop, disp, registered),
   m_geomProp(gprop), m_computedAreaIsUpToDate(false), m_computedArea(0)
 {
 	m_geomRep.push_back(compProp);
@@ -55,6 +55,7 @@ namespace Geom {
 GeomFuseImplementation::
 GeomFuseImplementation(Internal::Context& c,std::vector<GeomEntity*> es)
 : GeomModificationBaseClass(c)
+, m_fuzzy(0.0)
 {
     m_entities_param.insert(m_entities_param.end(),es.begin(),es.end());
 
@@ -88,43 +89,47 @@ void GeomFuseImplementation::perform(std::vector<GeomEntity*>& res)
         throw TkUtil::Exception (TkUtil::UTF8String ("Les entités à fusionner doivent être des volumes, des surfaces ou des courbes", TkUtil::Charset::UTF_8));
 }
 /*----------------------------------------------------------------------------*/
+void GeomFuseImplementation::fuse(BRepAlgoAPI_Fuse& fuse_operator)
+{
+    // une seule opération booléenne avec toutes les entités (la première
+    // en argument, les autres en outils) plutôt qu'une union 2 à 2
+    TopTools_ListOfShape arguments, tools;
+    for(unsigned int i=0;i<m_init_entities.size();i++){
+        TopoDS_Shape s;
+        getOCCShape(m_init_entities[i], s);
+        if (i==0)
+            arguments.Append(s);
+        else
+            tools.Append(s);
+    }
+    fuse_operator.SetArguments(arguments);
+    fuse_operator.SetTools(tools);
+    fuse_operator.SetRunParallel(Standard_True);
+    if (m_fuzzy > 0.0)
+        fuse_operator.SetFuzzyValue(m_fuzzy);
+    fuse_operator.Build();
+
+    if(!fuse_operator.IsDone())
+        throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union: Un objet de type BRepAlgoAPI_Fuse n'a pas fonctionné", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
 void GeomFuseImplementation::fuseVolumes(std::vector<GeomEntity*>& res)
 {
 #ifdef _DEBUG2
 	std::cout<<"GeomFuseImplementation::fuseVolumes()"<<std::endl;
 #endif
 
-    GeomEntity* e1 = m_init_entities[0];
-    TopoDS_Shape s1;
-    getOCCShape(e1, s1);
-    for(unsigned int i=1;i<m_init_entities.size();i++){
-        GeomEntity* e2 = m_init_entities[i];
-        TopoDS_Shape s2;
-        getOCCShape(e2, s2);
-
-        BRepAlgoAPI_Fuse fuse_operator(s1, s2);
-        TopoDS_Shape s;
-        if(fuse_operator.IsDone())
-        {
-            s= fuse_operator.Shape();
-            ShapeAnalysis_ShapeContents cont;
-            cont.Clear();
-            cont.Perform(s);
-
-            if (cont.NbSolids()<1){
-                throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union: Aucun volume généré", TkUtil::Charset::UTF_8));
-            }
-        }
-        else
-            throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union: Un objet de type BRepAlgoAPI_Fuse n'a pas fonctionné", TkUtil::Charset::UTF_8));
+    BRepAlgoAPI_Fuse fuse_operator;
+    fuse(fuse_operator);
 
-        s1 = s;
+    ShapeAnalysis_ShapeContents cont;
+    cont.Clear();
+    cont.Perform(fuse_operator.Shape());
+    if (cont.NbSolids()<1){
+        throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union: Aucun volume généré", TkUtil::Charset::UTF_8));
     }
 
-//    if(new_volumes.size()==0)
-//        throw TkUtil::Exception (TkUtil::UTF8String ("L'union de volumes n'a pas généré de volumes!", TkUtil::Charset::UTF_8));
-    createGeomEntities(s1);
-//    createGeomEntities(fuse_operator);
+    createGeomEntities(fuse_operator);
 
 
     //=========================================================================
@@ -157,36 +162,17 @@ void GeomFuseImplementation::fuseSurfaces(std::vector<GeomEntity*>& res)
 	std::cout<<"GeomFuseImplementation::fuseSurfaces()"<<std::endl;
 #endif
 
-    GeomEntity* e1 = m_init_entities[0];
-    TopoDS_Shape s1;
-    getOCCShape(e1, s1);
-    for(unsigned int i=1;i<m_init_entities.size();i++){
-        GeomEntity* e2 = m_init_entities[i];
-        TopoDS_Shape s2;
-        getOCCShape(e2, s2);
+    BRepAlgoAPI_Fuse fuse_operator;
+    fuse(fuse_operator);
 
-
-        BRepAlgoAPI_Fuse fuse_operator(s1, s2);
-        TopoDS_Shape s;
-        if(fuse_operator.IsDone())
-        {
-            s= fuse_operator.Shape();
-            ShapeAnalysis_ShapeContents cont;
-            cont.Clear();
-            cont.Perform(s);
-
-            if (cont.NbFaces()<1){
-                throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union: Aucun surface générée", TkUtil::Charset::UTF_8));
-            }
-        }
-        else
-            throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union: Un objet de type BRepAlgoAPI_Fuse n'a pas fonctionné", TkUtil::Charset::UTF_8));
-
-        s1 = s;
+    ShapeAnalysis_ShapeContents cont;
+    cont.Clear();
+    cont.Perform(fuse_operator.Shape());
+    if (cont.NbFaces()<1){
+        throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union: Aucun surface générée", TkUtil::Charset::UTF_8));
     }
-//    if(new_volumes.size()==0)
-//        throw TkUtil::Exception (TkUtil::UTF8String ("L'union de volumes n'a pas généré de volumes!", TkUtil::Charset::UTF_8));
-    createGeomEntities(s1);
+
+    createGeomEntities(fuse_operator);
 
 
     //=========================================================================
@@ -219,34 +205,17 @@ void GeomFuseImplementation::fuseCurves(std::vector<GeomEntity*>& res)
 	// [EB] non utilisé
 	std::cout<<"GeomFuseImplementation::fuseCurves()"<<std::endl;
 #endif
-    GeomEntity* e1 = m_init_entities[0];
-    TopoDS_Shape s1;
-    getOCCShape(e1, s1);
-    for(unsigned int i=1;i<m_init_entities.size();i++){
-        GeomEntity* e2 = m_init_entities[i];
-        TopoDS_Shape s2;
-        getOCCShape(e2, s2);
-
-        BRepAlgoAPI_Fuse fuse_operator(s1, s2);
-        TopoDS_Shape s;
-        if(fuse_operator.IsDone())
-        {
-            s= fuse_operator.Shape();
-            ShapeAnalysis_ShapeContents cont;
-            cont.Clear();
-            cont.Perform(s);
-
-            if (cont.NbC0Curves()<1){
-                throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union: Aucune courbe générée", TkUtil::Charset::UTF_8));
-            }
-        }
-        else
-            throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union: Un objet de type BRepAlgoAPI_Fuse n'a pas fonctionné", TkUtil::Charset::UTF_8));
-
-        s1 = s;
+    BRepAlgoAPI_Fuse fuse_operator;
+    fuse(fuse_operator);
+
+    ShapeAnalysis_ShapeContents cont;
+    cont.Clear();
+    cont.Perform(fuse_operator.Shape());
+    if (cont.NbC0Curves()<1){
+        throw TkUtil::Exception (TkUtil::UTF8String ("Problème OCC lors de l'union: Aucune courbe générée", TkUtil::Charset::UTF_8));
     }
 
-    createGeomEntities(s1);
+    createGeomEntities(fuse_operator);
 //    //=========================================================================
 //    std::map<GeomEntity*, std::vector<GeomEntity*> >::iterator it = m_replacedEntities.begin();
 //    while(it!=m_replacedEntities.end()){
@@ -128,10 +128,8 @@ void GeomGluingImplementation::sewVolumes(std::vector<GeomEntity*>& res)
 	}
 	splitter.SetArguments(list_of_arguments);
 	splitter.Build();
-	TopoDS_Shape s1 = splitter.Shape();
 
-	createGeomEntities(s1,true);
-	//createGeomEntities(splitter);
+	createGeomEntities(splitter,true);
 
 //    //=========================================================================
 //    std::map<GeomEntity*, std::vector<GeomEntity*> >::iterator it = m_replacedEntities.begin();
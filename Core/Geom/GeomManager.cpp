@@ -144,21 +144,25 @@ void GeomManager::clear()
             iter != m_volumes.end(); ++iter)
         delete *iter;
     m_volumes.clear();
+    m_volumes_index.clear();
 
     for (std::vector<Surface*>::const_iterator iter = m_surfaces.begin();
             iter != m_surfaces.end(); ++iter)
         delete *iter;
     m_surfaces.clear();
+    m_surfaces_index.clear();
 
     for (std::vector<Curve*>::const_iterator iter = m_curves.begin();
             iter != m_curves.end(); ++iter)
         delete *iter;
     m_curves.clear();
+    m_curves_index.clear();
 
     for (std::vector<Vertex*>::const_iterator iter = m_vertices.begin();
             iter != m_vertices.end(); ++iter)
         delete *iter;
     m_vertices.clear();
+    m_vertices_index.clear();
 }
 /*----------------------------------------------------------------------------*/
 Geom::GeomInfo GeomManager::getInfos(std::string name, int dim)
@@ -3162,15 +3166,21 @@ makeBlocksByExtrude(std::vector<GeomEntity*>& entities, const Utils::Math::Vecto
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManager::
 fuse(std::vector<std::string>& entities)
+{
+   return fuse(entities, 0.0);
+}
+/*----------------------------------------------------------------------------*/
+Internal::M3DCommandResultIfc* GeomManager::
+fuse(std::vector<std::string>& entities, double tolerance)
 {
     std::vector<GeomEntity*> vge;
     convert(entities, vge);
 
-   return fuse(vge);
+   return fuse(vge, tolerance);
 }
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManager::
-fuse(std::vector<GeomEntity*>& entities)
+fuse(std::vector<GeomEntity*>& entities, double tolerance)
 {
     TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
     message << "GeomManager::fuse (";
@@ -3190,7 +3200,7 @@ fuse(std::vector<GeomEntity*>& entities)
         Internal::CommandComposite* commandCompo =
              new Internal::CommandComposite(getLocalContext(), "Fusion booléenne entre géométries avec topologies");
 
-        commandGeom = new CommandFuse(getLocalContext(),entities);
+        commandGeom = new CommandFuse(getLocalContext(),entities,tolerance);
         commandCompo->addCommand(commandGeom);
 
         Topo::CommandModificationTopo* commandTopo = new Topo::CommandModificationTopo(getLocalContext(),
@@ -3200,7 +3210,7 @@ fuse(std::vector<GeomEntity*>& entities)
         command = commandCompo;
     }
     else {
-    	commandGeom = new CommandFuse(getLocalContext(),entities);
+    	commandGeom = new CommandFuse(getLocalContext(),entities,tolerance);
     	command = commandGeom;
     }
 
@@ -3212,7 +3222,10 @@ fuse(std::vector<GeomEntity*>& entities)
             cmd << ", ";
         cmd << "\""<< entities[i]->getName()<<"\"";
     }
-    cmd <<"])";
+    cmd <<"]";
+    if (tolerance > 0.0)
+        cmd << ", " << Utils::Math::MgxNumeric::userRepresentation (tolerance);
+    cmd <<")";
     command->setScriptCommand(cmd);
 
     // on passe au gestionnaire de commandes qui exécute la commande en // ou non
@@ -4082,15 +4095,22 @@ Internal::M3DCommandResultIfc* GeomManager::exportIGES(std::vector<Geom::GeomEnt
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManager::
 cut(std::string tokeep,std::vector<std::string>& tocut)
+{
+   return cut(tokeep, tocut, 0.0);
+}
+/*----------------------------------------------------------------------------*/
+Internal::M3DCommandResultIfc* GeomManager::
+cut(std::string tokeep,std::vector<std::string>& tocut, double tolerance)
 {
     std::vector<GeomEntity*> vge;
     convert(tocut, vge);
 
-   return cut(getEntity(tokeep),vge);
+   return cut(getEntity(tokeep),vge,tolerance);
 }
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManager::
-cut(Geom::GeomEntity* tokeep, std::vector<Geom::GeomEntity*>& tocut)
+cut(Geom::GeomEntity* tokeep, std::vector<Geom::GeomEntity*>& tocut,
+        double tolerance)
 {
     TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
     message << "GeomManager::cut (";
@@ -4113,7 +4133,7 @@ cut(Geom::GeomEntity* tokeep, std::vector<Geom::GeomEntity*>& tocut)
         Internal::CommandComposite* commandCompo =
              new Internal::CommandComposite(getLocalContext(), "Différences entre géométries avec topologies");
 
-        commandGeom = new CommandCut(getLocalContext(),tokeep, tocut);
+        commandGeom = new CommandCut(getLocalContext(),tokeep, tocut, tolerance);
         commandCompo->addCommand(commandGeom);
 
         Topo::CommandModificationTopo* commandTopo = new Topo::CommandModificationTopo(getLocalContext(),
@@ -4123,7 +4143,7 @@ cut(Geom::GeomEntity* tokeep, std::vector<Geom::GeomEntity*>& tocut)
         command = commandCompo;
     }
     else {
-        commandGeom = new CommandCut(getLocalContext(),tokeep, tocut);
+        commandGeom = new CommandCut(getLocalContext(),tokeep, tocut, tolerance);
         command = commandGeom;
     }
 
@@ -4135,7 +4155,10 @@ cut(Geom::GeomEntity* tokeep, std::vector<Geom::GeomEntity*>& tocut)
             cmd << ", ";
         cmd << "\""<< tocut[i]->getName()<<"\"";
     }
-    cmd <<"])";
+    cmd <<"]";
+    if (tolerance > 0.0)
+        cmd << ", " << Utils::Math::MgxNumeric::userRepresentation (tolerance);
+    cmd <<")";
     command->setScriptCommand(cmd);
 
     // on passe au gestionnaire de commandes qui exécute la commande en // ou non
@@ -4150,6 +4173,13 @@ cut(Geom::GeomEntity* tokeep, std::vector<Geom::GeomEntity*>& tocut)
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManager::
 cut(std::vector<std::string>& tokeep,std::vector<std::string>& tocut)
+{
+   return cut(tokeep, tocut, 0.0);
+}
+/*----------------------------------------------------------------------------*/
+Internal::M3DCommandResultIfc* GeomManager::
+cut(std::vector<std::string>& tokeep,std::vector<std::string>& tocut,
+        double tolerance)
 {
     std::vector<GeomEntity*> vge_keep, vge_cut;
 
@@ -4159,12 +4189,12 @@ cut(std::vector<std::string>& tokeep,std::vector<std::string>& tocut)
     for (uint i=0; i<tocut.size(); i++)
         vge_cut.push_back(getEntity(tocut[i]));
 
-   return cut(vge_keep, vge_cut);
+   return cut(vge_keep, vge_cut, tolerance);
 }
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManager::
 cut(std::vector<Geom::GeomEntity*>& tokeep,
-        std::vector<Geom::GeomEntity*>& tocut)
+        std::vector<Geom::GeomEntity*>& tocut, double tolerance)
 {
     TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
     message << "GeomManager::cut ([";
@@ -4194,7 +4224,7 @@ cut(std::vector<Geom::GeomEntity*>& tokeep,
     if (Internal::EntitiesHelper::hasTopoRef(tokeep)){
     	for(unsigned int i=0;i<tokeep.size();i++)
     	{
-    		commandGeom = new CommandCut(getLocalContext(),tokeep[i], tocut);
+    		commandGeom = new CommandCut(getLocalContext(),tokeep[i], tocut, tolerance);
     		commandCompo->addCommand(commandGeom);
 
     		Topo::CommandModificationTopo* commandTopo = new Topo::CommandModificationTopo(getLocalContext(),
@@ -4205,7 +4235,7 @@ cut(std::vector<Geom::GeomEntity*>& tokeep,
     else {
     	for(unsigned int i=0;i<tokeep.size();i++)
     	{
-    		commandGeom = new CommandCut(getLocalContext(),tokeep[i], tocut);
+    		commandGeom = new CommandCut(getLocalContext(),tokeep[i], tocut, tolerance);
     		commandCompo->addCommand(commandGeom);
     	}
     }
@@ -4226,7 +4256,10 @@ cut(std::vector<Geom::GeomEntity*>& tokeep,
             cmd << ", ";
         cmd << "\""<< tocut[i]->getName()<<"\"";
     }
-    cmd <<"])";
+    cmd <<"]";
+    if (tolerance > 0.0)
+        cmd << ", " << Utils::Math::MgxNumeric::userRepresentation (tolerance);
+    cmd <<")";
     command->setScriptCommand(cmd);
 
     // on passe au gestionnaire de commandes qui exécute la commande en // ou non
@@ -4675,10 +4708,7 @@ Volume* GeomManager::getVolume(const std::string& name, const bool exceptionIfNo
     else
         new_name = name;
 
-    for (std::vector<Volume*>::const_iterator iter = m_volumes.begin();
-            iter != m_volumes.end(); ++iter)
-        if (new_name == (*iter)->getName())
-            vol = (*iter);
+    vol = m_volumes_index.find(new_name);
 
     if (exceptionIfNotFound && vol == 0){
         TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
@@ -4709,10 +4739,7 @@ Surface* GeomManager::getSurface(const std::string& name, const bool exceptionIf
     else
         new_name = name;
 
-    for (std::vector<Surface*>::const_iterator iter = m_surfaces.begin();
-            iter != m_surfaces.end(); ++iter)
-        if (new_name == (*iter)->getName())
-            surf = (*iter);
+    surf = m_surfaces_index.find(new_name);
 
     if (exceptionIfNotFound && surf == 0){
         TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
@@ -4743,10 +4770,7 @@ Curve* GeomManager::getCurve(const std::string& name, const bool exceptionIfNotF
     else
         new_name = name;
 
-    for (std::vector<Curve*>::const_iterator iter = m_curves.begin();
-            iter != m_curves.end(); ++iter)
-        if (new_name == (*iter)->getName())
-            curve = (*iter);
+    curve = m_curves_index.find(new_name);
 
     if (exceptionIfNotFound && curve == 0){
         TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
@@ -4777,10 +4801,7 @@ Vertex* GeomManager::getVertex(const std::string& name, const bool exceptionIfNo
     else
         new_name = name;
 
-    for (std::vector<Vertex*>::const_iterator iter = m_vertices.begin();
-            iter != m_vertices.end(); ++iter)
-        if (new_name == (*iter)->getName())
-            vertex = (*iter);
+    vertex = m_vertices_index.find(new_name);
 
     if (exceptionIfNotFound && vertex == 0){
         TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
@@ -5041,12 +5062,38 @@ void GeomManager::removeEntity (GeomEntity* ge)
     }
 }
 /*----------------------------------------------------------------------------*/
+void GeomManager::add (Volume* v)
+{
+    m_volumes.push_back(v);
+    m_volumes_index.add(v);
+}
+/*----------------------------------------------------------------------------*/
+void GeomManager::add (Surface* s)
+{
+    m_surfaces.push_back(s);
+    m_surfaces_index.add(s);
+}
+/*----------------------------------------------------------------------------*/
+void GeomManager::add (Curve* c)
+{
+    m_curves.push_back(c);
+    m_curves_index.add(c);
+}
+/*----------------------------------------------------------------------------*/
+void GeomManager::add (Vertex* v)
+{
+    m_vertices.push_back(v);
+    m_vertices_index.add(v);
+}
+/*----------------------------------------------------------------------------*/
 void GeomManager::remove (Volume* v)
 {
     std::vector<Volume*>::iterator iter;
     iter = find(m_volumes.begin(), m_volumes.end(), v);
-    if (iter != m_volumes.end())
+    if (iter != m_volumes.end()){
         m_volumes.erase(iter);
+        m_volumes_index.remove(v);
+    }
     else
         throw TkUtil::Exception("Erreur interne, volume absent du GeomManager pour removeVolume");
 }
@@ -5055,8 +5102,10 @@ void GeomManager::remove (Surface* s)
 {
     std::vector<Surface*>::iterator iter;
     iter = find(m_surfaces.begin(), m_surfaces.end(), s);
-    if (iter != m_surfaces.end())
+    if (iter != m_surfaces.end()){
         m_surfaces.erase(iter);
+        m_surfaces_index.remove(s);
+    }
     else
         throw TkUtil::Exception("Erreur interne, surface absente du GeomManager pour removeSurface");
 }
@@ -5065,8 +5114,10 @@ void GeomManager::remove (Curve* c)
 {
     std::vector<Curve*>::iterator iter;
     iter = find(m_curves.begin(), m_curves.end(), c);
-    if (iter != m_curves.end())
+    if (iter != m_curves.end()){
         m_curves.erase(iter);
+        m_curves_index.remove(c);
+    }
     else
         throw TkUtil::Exception("Erreur interne, courbe absente du GeomManager pour removeCurve");
 }
@@ -5075,8 +5126,10 @@ void GeomManager::remove (Vertex* v)
 {
     std::vector<Vertex*>::iterator iter;
     iter = find(m_vertices.begin(), m_vertices.end(), v);
-    if (iter != m_vertices.end())
+    if (iter != m_vertices.end()){
         m_vertices.erase(iter);
+        m_vertices_index.remove(v);
+    }
     else
         throw TkUtil::Exception("Erreur interne, sommet absent du GeomManager pour removeVertex");
 }
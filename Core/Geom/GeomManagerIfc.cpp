@@ -458,6 +458,11 @@ Internal::M3DCommandResultIfc* GeomManagerIfc::fuse(std::vector<std::string>& en
     throw TkUtil::Exception (TkUtil::UTF8String ("GeomManagerIfc::fuse should be overloaded.", TkUtil::Charset::UTF_8));
 }
 /*----------------------------------------------------------------------------*/
+Internal::M3DCommandResultIfc* GeomManagerIfc::fuse(std::vector<std::string>& entities, double tolerance)
+{
+    throw TkUtil::Exception (TkUtil::UTF8String ("GeomManagerIfc::fuse should be overloaded.", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManagerIfc::common(std::vector<std::string>& entities)
 {
     throw TkUtil::Exception (TkUtil::UTF8String ("GeomManagerIfc::common should be overloaded.", TkUtil::Charset::UTF_8));
@@ -478,12 +483,23 @@ Internal::M3DCommandResultIfc* GeomManagerIfc::cut(std::string tokeep,std::vecto
     throw TkUtil::Exception (TkUtil::UTF8String ("GeomManagerIfc::cut should be overloaded.", TkUtil::Charset::UTF_8));
 }
 /*----------------------------------------------------------------------------*/
+Internal::M3DCommandResultIfc* GeomManagerIfc::cut(std::string tokeep,std::vector<std::string>& tocut, double tolerance)
+{
+    throw TkUtil::Exception (TkUtil::UTF8String ("GeomManagerIfc::cut should be overloaded.", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManagerIfc::
 cut(std::vector<std::string>& tokeep,std::vector<std::string>& tocut)
 {
     throw TkUtil::Exception (TkUtil::UTF8String ("GeomManagerIfc::cut should be overloaded.", TkUtil::Charset::UTF_8));
 }
 /*----------------------------------------------------------------------------*/
+Internal::M3DCommandResultIfc* GeomManagerIfc::
+cut(std::vector<std::string>& tokeep,std::vector<std::string>& tocut, double tolerance)
+{
+    throw TkUtil::Exception (TkUtil::UTF8String ("GeomManagerIfc::cut should be overloaded.", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManagerIfc::glue(std::vector<std::string>& entities)
 {
     throw TkUtil::Exception (TkUtil::UTF8String ("GeomManagerIfc::glue should be overloaded.", TkUtil::Charset::UTF_8));
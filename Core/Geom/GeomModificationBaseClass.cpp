@@ -14,6 +14,8 @@
 #include "Geom/Volume.h"
 #include "Geom/OCCGeomRepresentation.h"
 #include "Geom/EntityFactory.h"
+#include "Geom/BoundingBoxIndex.h"
+#include "Utils/ParallelExecution.h"
 /*----------------------------------------------------------------------------*/
 #include "Utils/MgxNumeric.h"
 #include <TkUtil/TraceLog.h>
@@ -23,6 +25,7 @@
 #include "TkUtil/Exception.h"
 #include <TkUtil/MemoryError.h>
 #include <set>
+#include <cmath>
 /*----------------------------------------------------------------------------*/
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Face.hxx>
@@ -682,15 +685,113 @@ createGeomEntities(const TopoDS_Shape& shape, const bool replaceVolumes, const b
     m_newEntities.insert(m_newEntities.end(),m_newVertices.begin(),m_newVertices.end());
 }
 /*----------------------------------------------------------------------------*/
+void GeomModificationBaseClass::
+createGeomEntities(BRepBuilderAPI_MakeShape& op, const bool replaceVolumes, const bool deleteAloneVertices)
+{
+	// historique pour toutes les sous-shapes des entités initiales
+	std::vector<TopoDS_Shape> inputs;
+	for (uint i=0; i<m_init_entities.size(); i++)
+		getOCCShapes(m_init_entities[i], inputs);
+	m_history.record(op, inputs);
+
+	createGeomEntities(op.Shape(), replaceVolumes, deleteAloneVertices);
+}
+/*----------------------------------------------------------------------------*/
+/// ajoute les shapes des entités (à une seule représentation) dans shapes
+template <typename TEntity>
+static void indexeShapes(const std::vector<TEntity*>& entities,
+		TopTools_IndexedMapOfShape& shapes, std::vector<GeomEntity*>& entites)
+{
+	for (uint i=0; i<entities.size(); i++){
+		std::vector<GeomRepresentation*> loc_reps = entities[i]->getComputationalProperties();
+		if (loc_reps.size() != 1)
+			continue;
+		OCCGeomRepresentation* occ_rep =
+				dynamic_cast<OCCGeomRepresentation*>(loc_reps[0]);
+		CHECK_NULL_PTR_ERROR(occ_rep);
+		if ((uint)shapes.Add(occ_rep->getShape()) > entites.size())
+			entites.push_back(entities[i]);
+	}
+}
+/*----------------------------------------------------------------------------*/
+/** entités (parmi celles de shapes) remplaçant e d'après l'historique de
+ *  l'opération OCC
+ *  \return faux si l'historique ne permet pas de retrouver une des shapes
+ *  remplaçantes
+ */
+static bool remplacantesHistorique(GeomEntity* e, const ShapeHistory& history,
+		const TopTools_IndexedMapOfShape& shapes, const std::vector<GeomEntity*>& entites,
+		std::vector<GeomEntity*>& remplacantes)
+{
+	std::vector<GeomRepresentation*> loc_reps = e->getComputationalProperties();
+	for (uint j=0; j<loc_reps.size(); j++){
+		OCCGeomRepresentation* occ_rep =
+				dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
+		CHECK_NULL_PTR_ERROR(occ_rep);
+		const TopoDS_Shape& sh = occ_rep->getShape();
+		if (!history.isKnown(sh))
+			return false;
+		if (history.isDeleted(sh))
+			continue;
+		const TopTools_ListOfShape& modified = history.modified(sh);
+		if (modified.IsEmpty()){
+			// shape non modifiée par l'opération
+			int ind = shapes.FindIndex(sh);
+			if (ind == 0)
+				return false;
+			remplacantes.push_back(entites[ind-1]);
+			continue;
+		}
+		for (TopTools_ListIteratorOfListOfShape it(modified); it.More(); it.Next()){
+			int ind = shapes.FindIndex(it.Value());
+			// morceau non retenu (d'aire nulle par exemple)
+			if (ind == 0)
+				return false;
+			remplacantes.push_back(entites[ind-1]);
+		}
+	}
+	return true;
+}
+/*----------------------------------------------------------------------------*/
 void GeomModificationBaseClass::buildReplacedList(const bool replaceVolumes){
     std::vector<GeomEntity*>::iterator it= m_removedEntities.begin();
     std::vector<Volume*> removedVolumes;
+    std::vector<Curve*> removedCurves;
+    std::vector<Surface*> removedSurfaces;
+    // index des boîtes des volumes candidats, construits à la demande
+    BoundingBoxIndex indexToKeepVolumes, indexNewVolumes;
+    bool volumesIndexes = false;
+
+    // shapes des entités conservées et nouvelles, pour l'historique
+    TopTools_IndexedMapOfShape historyShapes[4];
+    std::vector<GeomEntity*> historyEntities[4];
+    if (!m_history.isEmpty()){
+        indexeShapes(m_toKeepCurves, historyShapes[1], historyEntities[1]);
+        indexeShapes(m_newCurves, historyShapes[1], historyEntities[1]);
+        indexeShapes(m_toKeepSurfaces, historyShapes[2], historyEntities[2]);
+        indexeShapes(m_newSurfaces, historyShapes[2], historyEntities[2]);
+        indexeShapes(m_toKeepVolumes, historyShapes[3], historyEntities[3]);
+        indexeShapes(m_newVolumes, historyShapes[3], historyEntities[3]);
+    }
     std::vector<GeomEntity*> toKeepInFact;
     while(it!=m_removedEntities.end()){
         GeomEntity* rem_entity = *it;
 #ifdef _DEBUG2
         std::cout<<"To remove "<<rem_entity->getName()<<std::endl;
 #endif
+        const int dim = rem_entity->getDim();
+        if (!m_history.isEmpty() && dim > 0 && (dim < 3 || replaceVolumes)){
+            // l'historique de l'opération donne directement les remplaçantes,
+            // sinon (entité supprimée ou non retrouvée) on compare les géométries
+            std::vector<GeomEntity*> remplacantes;
+            if (remplacantesHistorique(rem_entity, m_history, historyShapes[dim],
+                    historyEntities[dim], remplacantes) && !remplacantes.empty()){
+                std::vector<GeomEntity*>& rep = m_replacedEntities[rem_entity];
+                rep.insert(rep.end(), remplacantes.begin(), remplacantes.end());
+                it++;
+                continue;
+            }
+        }
         switch(rem_entity->getDim()){
         case 0:
         {
@@ -703,22 +804,28 @@ void GeomModificationBaseClass::buildReplacedList(const bool replaceVolumes){
         {
         	Curve* e = dynamic_cast<Curve*>(rem_entity);
         	CHECK_NULL_PTR_ERROR(e);
-        	computeReplacedCurve(e);
+        	removedCurves.push_back(e);
         }
         break;
         case 2:
         {
         	Surface* e = dynamic_cast<Surface*>(rem_entity);
         	CHECK_NULL_PTR_ERROR(e);
-        	computeReplacedSurface(e);
+        	removedSurfaces.push_back(e);
         }
         break;
         case 3:
         {
         	Volume* e = dynamic_cast<Volume*>(rem_entity);
         	CHECK_NULL_PTR_ERROR(e);
-        	if(replaceVolumes)
-        		computeReplacedVolume(e);
+        	if(replaceVolumes){
+        		if (!volumesIndexes){
+        			indexeEntites(m_toKeepVolumes, indexToKeepVolumes);
+        			indexeEntites(m_newVolumes, indexNewVolumes);
+        			volumesIndexes = true;
+        		}
+        		computeReplacedVolume(e, indexToKeepVolumes, indexNewVolumes);
+        	}
         	else
         		removedVolumes.push_back(e);
         }
@@ -727,6 +834,10 @@ void GeomModificationBaseClass::buildReplacedList(const bool replaceVolumes){
         it++;
     }
 
+    // les courbes et surfaces sont traitées ensemble, en parallèle
+    computeReplacedCurves(removedCurves);
+    computeReplacedSurfaces(removedSurfaces);
+
     // identification des entités remplacées par elle-même
     std::map<GeomEntity*,std::vector<GeomEntity*> >::iterator it_rep;
     for(it_rep=m_replacedEntities.begin();it_rep!=m_replacedEntities.end();it_rep++)
@@ -1010,269 +1121,289 @@ void GeomModificationBaseClass::computeReplacedVertex(Vertex* e)
     }
 }
 /*----------------------------------------------------------------------------*/
-void GeomModificationBaseClass::computeReplacedCurve(Curve* e)
+/// boîte englobante [xmin, xmax, ymin, ymax, zmin, zmax] de la shape
+static void boiteShape(const TopoDS_Shape& sh, double bounds[6])
+{
+	Bnd_Box box;
+	box.SetGap(0.0);
+	BRepBndLib::Add(sh, box);
+	if (box.IsVoid()){
+		// jamais candidate
+		bounds[0] = bounds[2] = bounds[4] = 1.0;
+		bounds[1] = bounds[3] = bounds[5] = 0.0;
+		return;
+	}
+	box.Get(bounds[0], bounds[2], bounds[4], bounds[1], bounds[3], bounds[5]);
+}
+/*----------------------------------------------------------------------------*/
+/** boîte élargie pour l'appariement : deux shapes égales (areSame, à 1/10 de
+ *  la diagonale) ou l'une contenant l'autre (Curve::contains..., à la moitié
+ *  de la taille dans chaque direction) ont des boîtes élargies qui se coupent
+ */
+static void boiteAppariement(const TopoDS_Shape& sh, double bounds[6])
+{
+	boiteShape(sh, bounds);
+	if (bounds[0] > bounds[1])
+		return;
+	double diag = 0.0;
+	for (uint d=0; d<3; d++)
+		diag += (bounds[2*d+1]-bounds[2*d])*(bounds[2*d+1]-bounds[2*d]);
+	diag = std::sqrt(diag);
+	for (uint d=0; d<3; d++){
+		double marge = 0.5*(bounds[2*d+1]-bounds[2*d]) + 0.11*diag
+				+ Utils::Math::MgxNumeric::mgxGeomDoubleEpsilon*(1.0+diag);
+		bounds[2*d]   -= marge;
+		bounds[2*d+1] += marge;
+	}
+}
+/*----------------------------------------------------------------------------*/
+/// la shape de l'unique représentation de l'entité, nulle sinon
+static TopoDS_Shape shapeUnique(GeomEntity* e)
 {
 	std::vector<GeomRepresentation*> loc_reps = e->getComputationalProperties();
-#ifdef _DEBUG2
-	std::cout<<" computeReplacedCurve "<<e->getName()<<" avec "<<loc_reps.size()<<" GeomRepresentation"<<std::endl;
-#endif
-
-	for (uint j=0; j<loc_reps.size(); j++){
-		OCCGeomRepresentation* occ_rep =
-				dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
-		CHECK_NULL_PTR_ERROR(occ_rep);
-		TopoDS_Edge occ_e = TopoDS::Edge(occ_rep->getShape());
-
-		//========================================================================
-		// Cela peut être une entité conservée (cas d'un glue par exemple) ou
-		// nouvelle
-		bool is_fully_replaced  = false;
-		bool is_partly_replaced = false;
-	#ifdef _DEBUG2
-		std::cout<<"m_toKeepCurves :"<<std::endl;
-	#endif
-		for(unsigned int i=0;i<m_toKeepCurves.size() && !is_fully_replaced;i++){
-			Curve* c = m_toKeepCurves[i];
-	#ifdef _DEBUG2
-			std::cout<<"  "<<c->getName()<<std::endl;
-	#endif
-			std::vector<GeomRepresentation*> loc_reps_c = c->getComputationalProperties();
-			if (loc_reps_c.size() == 1){
-				OCCGeomRepresentation* occ_rep_c =
-						dynamic_cast<OCCGeomRepresentation*>(loc_reps_c[0]);
-				CHECK_NULL_PTR_ERROR(occ_rep_c);
-				TopoDS_Edge occ_c = TopoDS::Edge(occ_rep_c->getShape());
-				// si on sait que la shape est partiellement remplacee, autant ne
-				// plus tester les shapes en egalite
-				if(!is_partly_replaced && OCCGeomRepresentation::areEquals(occ_c,occ_e)){
-					m_replacedEntities[e].push_back(c); //e remplacee par c
-					is_fully_replaced = true;
-				}
-				if(!is_partly_replaced && !is_fully_replaced && c->contains(e)){
-					m_replacedEntities[e].push_back(c); //e remplacee par c
-					is_fully_replaced = true;
-				}
-
-				if(!is_fully_replaced && e->contains(c)){
-					m_replacedEntities[e].push_back(c); //e remplacee par c en partie
-					is_partly_replaced = true;
-				}
-			}
-		}
-		//========================================================================
-	#ifdef _DEBUG2
-		std::cout<<"m_newCurves :"<<std::endl;
-	#endif
-		for(unsigned int i=0;i<m_newCurves.size() && !is_fully_replaced;i++){
-			Curve* c = m_newCurves[i];
-	#ifdef _DEBUG2
-			std::cout<<"  "<<c->getName()<<std::endl;
-	#endif
-			std::vector<GeomRepresentation*> loc_reps_c = c->getComputationalProperties();
-			if (loc_reps_c.size() == 1){
-				OCCGeomRepresentation* occ_rep_c =
-						dynamic_cast<OCCGeomRepresentation*>(loc_reps_c[0]);
-				CHECK_NULL_PTR_ERROR(occ_rep_c);
-				TopoDS_Edge occ_c = TopoDS::Edge(occ_rep_c->getShape());
-
-				// si on sait que la shape est partiellement remplacee, autant ne
-				// plus tester les shapes en egalite
-				if(!is_partly_replaced && OCCGeomRepresentation::areEquals(occ_c,occ_e)){
-					m_replacedEntities[e].push_back(c); //e remplacee par c
-					is_fully_replaced = true;
-				}
-				if(!is_partly_replaced && !is_fully_replaced && c->contains(e)){
-					m_replacedEntities[e].push_back(c); //e remplacee par c
-					is_fully_replaced = true;
-				}
-
-				if(!is_fully_replaced && e->contains(c)){
-					m_replacedEntities[e].push_back(c); //e remplacee par c en partie
-					is_partly_replaced = true;
-				}
-			}
+	if (loc_reps.size() != 1)
+		return TopoDS_Shape();
+	OCCGeomRepresentation* occ_rep =
+			dynamic_cast<OCCGeomRepresentation*>(loc_reps[0]);
+	CHECK_NULL_PTR_ERROR(occ_rep);
+	return occ_rep->getShape();
+}
+/*----------------------------------------------------------------------------*/
+/** index des boîtes élargies des entités, celles sans représentation
+ *  unique ne sont jamais candidates
+ */
+template <typename TEntity>
+static void indexeEntites(const std::vector<TEntity*>& entities, BoundingBoxIndex& index)
+{
+	std::vector<double> boites(6*entities.size());
+	Utils::executeEnParallele(entities.size(), [&](uint i){
+		TopoDS_Shape sh = shapeUnique(entities[i]);
+		if (sh.IsNull()){
+			boites[6*i] = boites[6*i+2] = boites[6*i+4] = 1.0;
+			boites[6*i+1] = boites[6*i+3] = boites[6*i+5] = 0.0;
 		}
-#ifdef _DEBUG2
-	    std::cout<<"is_fully_replaced = "<<is_fully_replaced<<std::endl;
-	    std::cout<<"is_partly_replaced = "<<is_partly_replaced<<std::endl;
-#endif
-	} // end for (uint j=0; j<loc_reps.size(); j++)
-
-#ifdef _DEBUG2
-    std::cout<<"  remplacée par :";
-    for (uint i=0; i<m_replacedEntities[e].size(); i++)
-    	std::cout<<" "<<m_replacedEntities[e][i]->getName();
-    std::cout<<std::endl;
-#endif
+		else
+			boiteAppariement(sh, &boites[6*i]);
+	});
+	for (uint i=0; i<entities.size(); i++)
+		index.add(&boites[6*i]);
+	index.build();
+}
+/*----------------------------------------------------------------------------*/
+/** indices croissants des entités candidates, celles ajoutées à la liste
+ *  après la construction de l'index le sont toujours
+ */
+static void candidatsIndex(const BoundingBoxIndex& index, size_t nbEntities,
+		const double bounds[6], std::vector<uint>& ids)
+{
+	index.getCandidates(bounds, ids);
+	for (size_t i=index.getNbBoxes(); i<nbEntities; i++)
+		ids.push_back(i);
 }
 /*----------------------------------------------------------------------------*/
-void GeomModificationBaseClass::computeReplacedSurface(Surface* e)
+/// les candidats pour chacune des représentations d'une entité supprimée
+struct CandidatsRemplacement {
+	std::vector<TopoDS_Shape> shapes;
+	std::vector<std::vector<uint> > toKeep;
+	std::vector<std::vector<uint> > news;
+};
+/*----------------------------------------------------------------------------*/
+template <typename TEntity>
+static void calculeCandidats(TEntity* e,
+		const std::vector<TEntity*>& toKeep, const BoundingBoxIndex& indexToKeep,
+		const std::vector<TEntity*>& news, const BoundingBoxIndex& indexNews,
+		CandidatsRemplacement& candidats)
 {
-#ifdef _DEBUG2
-	std::cout<<" computeReplacedSurface("<<e->getName()<<")"<<std::endl;
-#endif
-
 	std::vector<GeomRepresentation*> loc_reps = e->getComputationalProperties();
-
+	candidats.shapes.resize(loc_reps.size());
+	candidats.toKeep.resize(loc_reps.size());
+	candidats.news.resize(loc_reps.size());
 	for (uint j=0; j<loc_reps.size(); j++){
 		OCCGeomRepresentation* occ_rep =
 				dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
 		CHECK_NULL_PTR_ERROR(occ_rep);
-		TopoDS_Face occ_e = TopoDS::Face(occ_rep->getShape());
-		//========================================================================
-		// Cela peut être une entité conservée (cas d'un glue par exemple) ou
-		// nouvelle
-		bool is_fully_replaced  = false;
-		bool is_partly_replaced = false;
-		for(unsigned int i=0;i<m_toKeepSurfaces.size() && !is_fully_replaced;i++){
-			Surface* s = m_toKeepSurfaces[i];
-#ifdef _DEBUG2
-			std::cout<<"  m_toKeepSurfaces["<<i<<"] : "<<s->getName()<<std::endl;
-#endif
-			std::vector<GeomRepresentation*> loc_reps_s = s->getComputationalProperties();
-			if (loc_reps_s.size() == 1){
-				OCCGeomRepresentation* occ_rep_s =
-						dynamic_cast<OCCGeomRepresentation*>(loc_reps_s[0]);
-
-				CHECK_NULL_PTR_ERROR(occ_rep_s);
-				TopoDS_Face occ_s = TopoDS::Face(occ_rep_s->getShape());
-				// si on sait que la shape est partiellement remplacee, autant ne
-				// plus tester les shapes en egalite
-				if(!is_partly_replaced && OCCGeomRepresentation::areEquals(occ_s,occ_e)){
-					m_replacedEntities[e].push_back(s); //e remplacee par s
-					is_fully_replaced = true;
-				}
-				if(!is_partly_replaced && !is_fully_replaced && s->contains(e)){
-					m_replacedEntities[e].push_back(s); //e remplacee par s
-					is_fully_replaced = true;
-				}
-
-				if(!is_fully_replaced && e->contains(s)){
-					m_replacedEntities[e].push_back(s); //e remplacee par c en partie
-					is_partly_replaced = true;
-				}
-			}
-		}
-
-		//========================================================================
-		for(unsigned int i=0;i<m_newSurfaces.size() && !is_fully_replaced;i++){
-			Surface* s = m_newSurfaces[i];
-#ifdef _DEBUG2
-			std::cout<<"  m_newSurfaces["<<i<<"] : "<<s->getName()<<std::endl;
-#endif
-			std::vector<GeomRepresentation*> loc_reps_s = s->getComputationalProperties();
-			if (loc_reps_s.size() == 1){
-				OCCGeomRepresentation* occ_rep_s =
-						dynamic_cast<OCCGeomRepresentation*>(loc_reps_s[0]);
-				CHECK_NULL_PTR_ERROR(occ_rep_s);
-				TopoDS_Face occ_s = TopoDS::Face(occ_rep_s->getShape());
-				// si on sait que la shape est partiellement remplacee, autant ne
-				// plus tester les shapes en egalite
-				if(!is_partly_replaced && OCCGeomRepresentation::areEquals(occ_s,occ_e)){
-					m_replacedEntities[e].push_back(s); //e remplacee par s
-					is_fully_replaced = true;
-				}
-				if(!is_partly_replaced && !is_fully_replaced && s->contains(e)){
-					m_replacedEntities[e].push_back(s); //e remplacee par s
-					is_fully_replaced = true;
-				}
-
-				if(!is_fully_replaced && e->contains(s)){
-					m_replacedEntities[e].push_back(s); //e remplacee par c en partie
-					is_partly_replaced = true;
-				}
-			}
-		}
-	} // end for (uint j=0; j<loc_reps.size(); j++)
-
-
-#ifdef _DEBUG2
-    std::cout<<"  => remplacée par";
-    for(uint i=0; i<m_replacedEntities[e].size(); i++)
-    	std::cout<<" "<<m_replacedEntities[e][i]->getName();
-    std::cout<<std::endl;
-#endif
+		candidats.shapes[j] = occ_rep->getShape();
+		double bounds[6];
+		boiteAppariement(candidats.shapes[j], bounds);
+		candidatsIndex(indexToKeep, toKeep.size(), bounds, candidats.toKeep[j]);
+		candidatsIndex(indexNews, news.size(), bounds, candidats.news[j]);
+	}
 }
 /*----------------------------------------------------------------------------*/
-void GeomModificationBaseClass::computeReplacedVolume(Volume* e)
+static void shapeOCC(const TopoDS_Shape& sh, TopoDS_Edge& e)  {e = TopoDS::Edge(sh);}
+static void shapeOCC(const TopoDS_Shape& sh, TopoDS_Face& f)  {f = TopoDS::Face(sh);}
+static void shapeOCC(const TopoDS_Shape& sh, TopoDS_Solid& s) {s = TopoDS::Solid(sh);}
+/*----------------------------------------------------------------------------*/
+/** cherche parmi les candidats (dans l'ordre des entités) ceux qui
+ *  remplacent la shape occ_e de e, totalement ou en partie
+ */
+template <typename TEntity, typename TShape>
+static void chercheRemplacantes(TEntity* e, const TShape& occ_e,
+		const std::vector<TEntity*>& entities, const std::vector<uint>& candidats,
+		bool& is_fully_replaced, bool& is_partly_replaced,
+		std::vector<GeomEntity*>& remplacantes)
 {
-	//e est une entité supprimée, on cherche celles l'ayant remplacées
-	OCCGeomRepresentation* occ_rep =
-			dynamic_cast<OCCGeomRepresentation*>(e->getComputationalProperty());
-	CHECK_NULL_PTR_ERROR(occ_rep);
-	TopoDS_Solid occ_e = TopoDS::Solid(occ_rep->getShape());
-
+	for (uint k=0; k<candidats.size() && !is_fully_replaced; k++){
+		TEntity* c = entities[candidats[k]];
 #ifdef _DEBUG2
-	std::cout<<"Volume a remplacer : "<<e->getName()<<std::endl;
+		std::cout<<"  candidat "<<c->getName()<<std::endl;
 #endif
-	//========================================================================
-	// Cela peut être une entité conservée (cas d'un glue par exemple) ou
-	// nouvelle
-	bool is_fully_replaced  = false;
-	bool is_partly_replaced = false;
-	for(unsigned int i=0;i<m_toKeepVolumes.size() && !is_fully_replaced;i++){
-		Volume* s = m_toKeepVolumes[i];
-#ifdef _DEBUG2
-		std::cout<<"  m_toKeepVolumes["<<i<<"] : "<<s->getName()<<std::endl;
-#endif
-		OCCGeomRepresentation* occ_rep_s =
-				dynamic_cast<OCCGeomRepresentation*>(s->getComputationalProperty());
-		CHECK_NULL_PTR_ERROR(occ_rep_s);
-		TopoDS_Solid occ_s = TopoDS::Solid(occ_rep_s->getShape());
+		TopoDS_Shape sh_c = shapeUnique(c);
+		if (sh_c.IsNull())
+			continue;
+		TShape occ_c;
+		shapeOCC(sh_c, occ_c);
 		// si on sait que la shape est partiellement remplacee, autant ne
-		// plus tester les shapes en egalite
-		if(!is_partly_replaced && OCCGeomRepresentation::areEquals(occ_s,occ_e)){
-			m_replacedEntities[e].push_back(s); //e remplacee par s
+		// plus tester les shapes en egalite (même TShape : forcément égales)
+		if(!is_partly_replaced && (occ_c.IsSame(occ_e) || OCCGeomRepresentation::areEquals(occ_c,occ_e))){
+			remplacantes.push_back(c); //e remplacee par c
 			is_fully_replaced = true;
 		}
-		if(!is_partly_replaced && !is_fully_replaced && s->contains(e)){
-			m_replacedEntities[e].push_back(s); //e remplacee par s
+		if(!is_partly_replaced && !is_fully_replaced && c->contains(e)){
+			remplacantes.push_back(c); //e remplacee par c
 			is_fully_replaced = true;
 		}
 
-		if(!is_fully_replaced && e->contains(s)){
-			m_replacedEntities[e].push_back(s); //e remplacee par c en partie
+		if(!is_fully_replaced && e->contains(c)){
+			remplacantes.push_back(c); //e remplacee par c en partie
 			is_partly_replaced = true;
 		}
 	}
-	//========================================================================
-	for(unsigned int i=0;i<m_newVolumes.size() && !is_fully_replaced;i++){
-		Volume* s = m_newVolumes[i];
-		OCCGeomRepresentation* occ_rep_s =
-				dynamic_cast<OCCGeomRepresentation*>(s->getComputationalProperty());
-		CHECK_NULL_PTR_ERROR(occ_rep_s);
-		TopoDS_Solid occ_s = TopoDS::Solid(occ_rep_s->getShape());
-		// si on sait que la shape est partiellement remplacee, autant ne
-		// plus tester les shapes en egalite
-#ifdef _DEBUG2
-		std::cout<<"\t == comparaison avec "<<s->getName()<<std::endl;
-		std::cout<<"\t  partly replaced = "<< is_partly_replaced<<std::endl;
-		std::cout<<"\t  fully  replaced = "<< is_fully_replaced<<std::endl;
+}
+/*----------------------------------------------------------------------------*/
+/** recherche en parallèle des entités remplaçant celles de removed, parmi
+ *  les entités conservées et nouvelles dont les boîtes peuvent correspondre
+ */
+template <typename TEntity, typename TShape>
+static void calculeRemplacantes(const std::vector<TEntity*>& removed,
+		const std::vector<TEntity*>& toKeep, const std::vector<TEntity*>& news,
+		std::vector<std::vector<GeomEntity*> >& remplacantes)
+{
+	BoundingBoxIndex indexToKeep, indexNews;
+	indexeEntites(toKeep, indexToKeep);
+	indexeEntites(news, indexNews);
+
+	std::vector<CandidatsRemplacement> candidats(removed.size());
+	Utils::executeEnParallele(removed.size(), [&](uint i){
+		calculeCandidats(removed[i], toKeep, indexToKeep, news, indexNews, candidats[i]);
+	});
+
+	// les tests exacts calculent à la demande l'aire et la triangulation
+	// des entités, on les prépare ici pour les faire ensuite en parallèle
+	std::set<TEntity*> a_preparer(removed.begin(), removed.end());
+	for (uint i=0; i<candidats.size(); i++)
+		for (uint j=0; j<candidats[i].shapes.size(); j++){
+			for (uint k=0; k<candidats[i].toKeep[j].size(); k++)
+				a_preparer.insert(toKeep[candidats[i].toKeep[j][k]]);
+			for (uint k=0; k<candidats[i].news[j].size(); k++)
+				a_preparer.insert(news[candidats[i].news[j][k]]);
+		}
+	std::vector<TEntity*> entites(a_preparer.begin(), a_preparer.end());
+	TopTools_IndexedMapOfShape faces;
+	for (uint i=0; i<entites.size(); i++){
+		std::vector<GeomRepresentation*> loc_reps = entites[i]->getComputationalProperties();
+		for (uint j=0; j<loc_reps.size(); j++){
+			OCCGeomRepresentation* occ_rep =
+					dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
+			CHECK_NULL_PTR_ERROR(occ_rep);
+			TopExp::MapShapes(occ_rep->getShape(), TopAbs_FACE, faces);
+		}
+	}
+	OCCGeomRepresentation::buildIncrementalBRepMesh(faces, 0.1);
+	Utils::executeEnParallele(entites.size(), [&](uint i){
+		entites[i]->getArea();
+	});
+
+	remplacantes.clear();
+	remplacantes.resize(removed.size());
+	Utils::executeEnParallele(removed.size(), [&](uint i){
+		TEntity* e = removed[i];
+		const CandidatsRemplacement& cand = candidats[i];
+		for (uint j=0; j<cand.shapes.size(); j++){
+			TShape occ_e;
+			shapeOCC(cand.shapes[j], occ_e);
+			//========================================================================
+			// Cela peut être une entité conservée (cas d'un glue par exemple) ou
+			// nouvelle
+			bool is_fully_replaced  = false;
+			bool is_partly_replaced = false;
+			chercheRemplacantes(e, occ_e, toKeep, cand.toKeep[j],
+					is_fully_replaced, is_partly_replaced, remplacantes[i]);
+			chercheRemplacantes(e, occ_e, news, cand.news[j],
+					is_fully_replaced, is_partly_replaced, remplacantes[i]);
+		}
+	});
+}
+/*----------------------------------------------------------------------------*/
+void GeomModificationBaseClass::computeReplacedCurves(const std::vector<Curve*>& removed)
+{
+	std::vector<std::vector<GeomEntity*> > remplacantes;
+	calculeRemplacantes<Curve, TopoDS_Edge>(removed, m_toKeepCurves, m_newCurves, remplacantes);
+	for (uint i=0; i<removed.size(); i++){
+		if (remplacantes[i].empty())
+			continue;
+		std::vector<GeomEntity*>& rep = m_replacedEntities[removed[i]];
+		rep.insert(rep.end(), remplacantes[i].begin(), remplacantes[i].end());
+#ifdef _DEBUG2
+		std::cout<<" "<<removed[i]->getName()<<" remplacée par :";
+		for (uint k=0; k<rep.size(); k++)
+			std::cout<<" "<<rep[k]->getName();
+		std::cout<<std::endl;
 #endif
-		if(!is_partly_replaced && OCCGeomRepresentation::areEquals(occ_s,occ_e)){
-
-			m_replacedEntities[e].push_back(s); //e remplacee par s
-			is_fully_replaced = true;
-#ifdef _DEBUG2
-			std::cout<<"\t totalement remplacé par "<<s->getName()<<std::endl;
+	}
+}
+/*----------------------------------------------------------------------------*/
+void GeomModificationBaseClass::computeReplacedSurfaces(const std::vector<Surface*>& removed)
+{
+	std::vector<std::vector<GeomEntity*> > remplacantes;
+	calculeRemplacantes<Surface, TopoDS_Face>(removed, m_toKeepSurfaces, m_newSurfaces, remplacantes);
+	for (uint i=0; i<removed.size(); i++){
+		if (remplacantes[i].empty())
+			continue;
+		std::vector<GeomEntity*>& rep = m_replacedEntities[removed[i]];
+		rep.insert(rep.end(), remplacantes[i].begin(), remplacantes[i].end());
+#ifdef _DEBUG2
+		std::cout<<" "<<removed[i]->getName()<<" remplacée par :";
+		for (uint k=0; k<rep.size(); k++)
+			std::cout<<" "<<rep[k]->getName();
+		std::cout<<std::endl;
 #endif
-		}
-		if(!is_partly_replaced && !is_fully_replaced && s->contains(e)){
-			m_replacedEntities[e].push_back(s); //e remplacee par s
-			is_fully_replaced = true;
+	}
+}
+/*----------------------------------------------------------------------------*/
+void GeomModificationBaseClass::computeReplacedVolume(Volume* e,
+		const BoundingBoxIndex& indexToKeep, const BoundingBoxIndex& indexNews)
+{
 #ifdef _DEBUG2
-			std::cout<<"\t contenu dans "<<s->getName()<<std::endl;
+	std::cout<<"Volume a remplacer : "<<e->getName()<<std::endl;
 #endif
-		}
+	//e est une entité supprimée, on cherche celles l'ayant remplacées
+	OCCGeomRepresentation* occ_rep =
+			dynamic_cast<OCCGeomRepresentation*>(e->getComputationalProperty());
+	CHECK_NULL_PTR_ERROR(occ_rep);
+	TopoDS_Solid occ_e = TopoDS::Solid(occ_rep->getShape());
 
-		if(!is_fully_replaced && e->contains(s)){
-			m_replacedEntities[e].push_back(s); //e remplacee par c en partie
-			is_partly_replaced = true;
-#ifdef _DEBUG2
-			std::cout<<"\t partiellement remplacé par "<<s->getName()<<std::endl;
-#endif
+	// les volumes conservés ajoutés après la construction de l'index
+	// (par un précédent appel) sont toujours candidats
+	double bounds[6];
+	boiteAppariement(occ_e, bounds);
+	std::vector<uint> candidats_toKeep, candidats_news;
+	candidatsIndex(indexToKeep, m_toKeepVolumes.size(), bounds, candidats_toKeep);
+	candidatsIndex(indexNews, m_newVolumes.size(), bounds, candidats_news);
 
-		}
+	//========================================================================
+	// Cela peut être une entité conservée (cas d'un glue par exemple) ou
+	// nouvelle
+	bool is_fully_replaced  = false;
+	bool is_partly_replaced = false;
+	std::vector<GeomEntity*> remplacantes;
+	chercheRemplacantes(e, occ_e, m_toKeepVolumes, candidats_toKeep,
+			is_fully_replaced, is_partly_replaced, remplacantes);
+	chercheRemplacantes(e, occ_e, m_newVolumes, candidats_news,
+			is_fully_replaced, is_partly_replaced, remplacantes);
+	if (!remplacantes.empty()){
+		std::vector<GeomEntity*>& rep = m_replacedEntities[e];
+		rep.insert(rep.end(), remplacantes.begin(), remplacantes.end());
 	}
 
 	if(!is_fully_replaced  && !is_partly_replaced )
@@ -1780,6 +1911,99 @@ static bool compareOCCSolid(const TopoDS_Solid s1, const TopoDS_Solid s2)
 	}
 }
 /*----------------------------------------------------------------------------*/
+/// associe les shapes OCC (toutes les représentations) aux entités
+template <typename TContainer>
+static void ajouteShapes(const TContainer& entities,
+		NCollection_DataMap<TopoDS_Shape, GeomEntity*, TopTools_ShapeMapHasher>& shapes)
+{
+	for (typename TContainer::const_iterator it = entities.begin(); it != entities.end(); ++it){
+		std::vector<GeomRepresentation*> loc_reps = (*it)->getComputationalProperties();
+		for (uint j=0; j<loc_reps.size(); j++){
+			OCCGeomRepresentation* occ_rep =
+					dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
+			CHECK_NULL_PTR_ERROR(occ_rep);
+			if (!shapes.IsBound(occ_rep->getShape()))
+				shapes.Bind(occ_rep->getShape(), *it);
+		}
+	}
+}
+/*----------------------------------------------------------------------------*/
+bool GeomModificationBaseClass::findShape(const TopoDS_Shape& sh,
+		const ShapeEntityMap& refs, const ShapeEntityMap& news,
+		GeomEntity*& found, bool& isRef) const
+{
+	found = 0;
+	isRef = false;
+	if (refs.IsBound(sh)){
+		found = refs.Find(sh);
+		isRef = true;
+		return true;
+	}
+	if (news.IsBound(sh)){
+		found = news.Find(sh);
+		return true;
+	}
+	// shape modifiée ou générée par l'opération, elle ne peut être
+	// identique à une shape argument de l'opération
+	return m_history.isImage(sh);
+}
+/*----------------------------------------------------------------------------*/
+bool GeomModificationBaseClass::isOperationInput(GeomEntity* e) const
+{
+	std::vector<GeomRepresentation*> loc_reps = e->getComputationalProperties();
+	for (uint j=0; j<loc_reps.size(); j++){
+		OCCGeomRepresentation* occ_rep =
+				dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
+		CHECK_NULL_PTR_ERROR(occ_rep);
+		if (m_history.isInput(occ_rep->getShape()))
+			return true;
+	}
+	return false;
+}
+/*----------------------------------------------------------------------------*/
+/** toutes les représentations des entités de référence d'une dimension et
+ *  l'index de leurs boîtes élargies, la boîte i est celle de shapes[i],
+ *  représentation de entities[i]
+ */
+struct IndexReferences {
+	std::vector<GeomEntity*> entities;
+	std::vector<TopoDS_Shape> shapes;
+	BoundingBoxIndex index;
+};
+/*----------------------------------------------------------------------------*/
+static void indexeReferences(const std::list<GeomEntity*>& refs, IndexReferences& res)
+{
+	for (std::list<GeomEntity*>::const_iterator it = refs.begin(); it != refs.end(); ++it){
+		std::vector<GeomRepresentation*> loc_reps = (*it)->getComputationalProperties();
+		for (uint j=0; j<loc_reps.size(); j++){
+			OCCGeomRepresentation* occ_rep =
+					dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
+			CHECK_NULL_PTR_ERROR(occ_rep);
+			res.entities.push_back(*it);
+			res.shapes.push_back(occ_rep->getShape());
+		}
+	}
+	std::vector<double> boites(6*res.shapes.size());
+	Utils::executeEnParallele(res.shapes.size(), [&](uint i){
+		boiteAppariement(res.shapes[i], &boites[6*i]);
+	});
+	for (uint i=0; i<res.shapes.size(); i++)
+		res.index.add(&boites[6*i]);
+	res.index.build();
+}
+/*----------------------------------------------------------------------------*/
+/** indices croissants (ordre de m_ref_entities) des représentations de
+ *  référence dont la boîte élargie coupe celle de sh, seules candidates à
+ *  l'égalité géométrique avec sh
+ */
+static void candidatsReferences(const IndexReferences& refs, const TopoDS_Shape& sh,
+		std::vector<uint>& ids)
+{
+	double bounds[6];
+	boiteAppariement(sh, bounds);
+	refs.index.getCandidates(bounds, ids);
+}
+/*----------------------------------------------------------------------------*/
 void GeomModificationBaseClass::createNewVertices(const TopoDS_Shape& shape,
         std::vector<TopoDS_Shape>& occ_entities,
         std::vector<Vertex*>& m3d_entities,
@@ -1802,6 +2026,13 @@ void GeomModificationBaseClass::createNewVertices(const TopoDS_Shape& shape,
     }
     ordered_vertices.sort(compareOCCVertex);
 
+    ShapeEntityMap refs, news;
+    ajouteShapes(m_ref_entities[0], refs);
+    ajouteShapes(m_newVertices, news);
+    IndexReferences index_refs;
+    indexeReferences(m_ref_entities[0], index_refs);
+    std::vector<uint> candidats;
+
     Vertex *newVertex=0;
     TopoDS_Vertex newOCCVertex;
 
@@ -1815,23 +2046,38 @@ void GeomModificationBaseClass::createNewVertices(const TopoDS_Shape& shape,
     	std::cout<<"**** Vertex en "<<pnt.X()<<" "<<pnt.Y()<<" "<<pnt.Z()<<std::endl;
 #endif
         bool to_keep=false;
+        // recherche directe de la shape (ou par l'historique)
+        GeomEntity* found = 0;
+        bool isRef = false;
+        const bool known = findShape(V, refs, news, found, isRef);
+        if (found && isRef){
+        	to_keep = true;
+        	newVertex = dynamic_cast<Vertex*>(found);
+        	CHECK_NULL_PTR_ERROR(newVertex);
+        	newOCCVertex = V;
+        	m_toKeepVertices.push_back(newVertex);
+        }
+
         // pour chaque sommet de la nouvelle shape, on regarde si
         // ce sommet n'existe pas déjà dans une shape de référence
 
         // if the ref entities are not kept new cells must be
         // created to replace them
-        std::list<GeomEntity*>::iterator it = m_ref_entities[0].begin();
-        for(;it!=m_ref_entities[0].end() && !to_keep; it++)
+        // une shape issue de l'opération n'est comparée qu'aux entités
+        // adjacentes qui ne sont pas des arguments de l'opération
+        // seuls les sommets proches (index des boîtes) sont comparés
+        candidats.clear();
+        if (!known || !found)
+            candidatsReferences(index_refs, V, candidats);
+        for(uint k=0; k<candidats.size() && !to_keep; k++)
         {
+            if (known && isOperationInput(index_refs.entities[candidats[k]]))
+                continue;
             //SOMMET COURANT
-            Vertex* current = dynamic_cast<Vertex*>(*it);
+            Vertex* current = dynamic_cast<Vertex*>(index_refs.entities[candidats[k]]);
             CHECK_NULL_PTR_ERROR(current);
-            //REPRESENTION OCC ASSOCIEE
-            OCCGeomRepresentation* occ_rep =
-                    dynamic_cast<OCCGeomRepresentation*>(current->getComputationalProperty());
-            CHECK_NULL_PTR_ERROR(occ_rep);
             //SOMMET OCC CORRESPONDANT
-            TopoDS_Vertex vrep = TopoDS::Vertex(occ_rep->getShape());
+            TopoDS_Vertex vrep = TopoDS::Vertex(index_refs.shapes[candidats[k]]);
             if(OCCGeomRepresentation::areEquals(V,vrep)){
                 // on a trouve que le sommet existe déjà,
                 to_keep = true;
@@ -1848,8 +2094,13 @@ void GeomModificationBaseClass::createNewVertices(const TopoDS_Shape& shape,
         //si on ne la pas trouve dans les sommets de reference, on
         //regarde tout de meme s'il n'est pas dans les sommets crees
         //par l'operation avant
-        bool found_in_news=false;
-        if(!to_keep)
+        bool found_in_news = (found && !isRef);
+        if (found_in_news){
+        	newVertex = dynamic_cast<Vertex*>(found);
+        	CHECK_NULL_PTR_ERROR(newVertex);
+        	newOCCVertex = V;
+        }
+        if(!to_keep && !known)
         {
             /* s'il n'est dans aucune des entités de référence, on vérifie
              * qu'il n'a pas deja ete ajoute precedemment  */
@@ -1879,6 +2130,7 @@ void GeomModificationBaseClass::createNewVertices(const TopoDS_Shape& shape,
             newOCCVertex=V;
             m_newEntities.push_back(newVertex);
             m_newVertices.push_back(newVertex);
+            news.Bind(V, newVertex);
 #ifdef _DEBUG2
                 std::cout<<"**** "<<newVertex->getName()<<" nouveau"<<std::endl;
 //            std::cout<<"Creation du sommet "<<newVertex->getName()<<" ("<<newVertex->getX()<<", "<<newVertex->getY()<<", "<<newVertex->getZ()<<")"<<std::endl;
@@ -1914,6 +2166,13 @@ void GeomModificationBaseClass::createNewCurves(const TopoDS_Shape& shape,
     }
     sorted_entities.sort(compareOCCEdge);
 
+    ShapeEntityMap refs, news;
+    ajouteShapes(m_ref_entities[1], refs);
+    ajouteShapes(m_newCurves, news);
+    IndexReferences index_refs;
+    indexeReferences(m_ref_entities[1], index_refs);
+    std::vector<uint> candidats;
+
     for (std::list<TopoDS_Edge>::iterator iter=sorted_entities.begin();
         		iter!=sorted_entities.end(); ++iter)
     {
@@ -1926,41 +2185,56 @@ void GeomModificationBaseClass::createNewCurves(const TopoDS_Shape& shape,
             TopoDS_Edge newOCCEdge;
 
             bool to_keep=false;
+            // recherche directe de la shape (ou par l'historique)
+            GeomEntity* found = 0;
+            bool isRef = false;
+            const bool known = findShape(E, refs, news, found, isRef);
+            if (found && isRef){
+            	to_keep = true;
+            	newEdge = dynamic_cast<Curve*>(found);
+            	CHECK_NULL_PTR_ERROR(newEdge);
+            	newOCCEdge = E;
+            	m_toKeepCurves.push_back(newEdge);
+            }
+
             // pour chaque courbe de la nouvelle shape, on regarde si
             // cette courbe n'existe pas déjà dans une shape de référence
             // if the ref entities are not kept new cells must be created to replace them
-            std::list<GeomEntity*>::iterator it = m_ref_entities[1].begin();
-
-            for(;it!=m_ref_entities[1].end() && !to_keep; it++)
+            // une shape issue de l'opération n'est comparée qu'aux entités
+            // adjacentes qui ne sont pas des arguments de l'opération
+            // seules les représentations proches (index des boîtes) sont comparées
+            candidats.clear();
+            if (!known || !found)
+                candidatsReferences(index_refs, E, candidats);
+            for(uint k=0; k<candidats.size() && !to_keep; k++)
             {
-                Curve* current = dynamic_cast<Curve*>(*it);
+                if (known && isOperationInput(index_refs.entities[candidats[k]]))
+                    continue;
+                Curve* current = dynamic_cast<Curve*>(index_refs.entities[candidats[k]]);
                 CHECK_NULL_PTR_ERROR(current);
+                TopoDS_Edge ref_edge = TopoDS::Edge(index_refs.shapes[candidats[k]]);
 
-                std::vector<GeomRepresentation*> loc_reps = current->getComputationalProperties();
-
-                for (uint j=0; j<loc_reps.size(); j++){
-                	OCCGeomRepresentation* occ_rep =
-                			dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
-                	CHECK_NULL_PTR_ERROR(occ_rep);
-                	TopoDS_Edge ref_edge = TopoDS::Edge(occ_rep->getShape());
-
-                	if(OCCGeomRepresentation::areEquals(E,ref_edge)){
-                		// on a trouve que le sommet existe déjà, on conserve
-                		// la référence
-                		to_keep = true;
-                		newEdge = current;
-                		newOCCEdge = E;
-                		m_toKeepCurves.push_back(current);
+                if(OCCGeomRepresentation::areEquals(E,ref_edge)){
+                	// on a trouve que le sommet existe déjà, on conserve
+                	// la référence
+                	to_keep = true;
+                	newEdge = current;
+                	newOCCEdge = E;
+                	m_toKeepCurves.push_back(current);
 #ifdef _DEBUG2
-                		std::cout<<"**** "<<current->getName()<<" a conserver"<<std::endl;
+                	std::cout<<"**** "<<current->getName()<<" a conserver"<<std::endl;
 #endif
-                	}
-                } // end for j
+                }
             }
             /* s'il n'est dans aucune des entités de référence, on vérifie
              * qu'il n'a pas deja ete ajoute precedemment  */
-            bool found_in_news=false;
-            if(!to_keep)
+            bool found_in_news = (found && !isRef);
+            if (found_in_news){
+            	newEdge = dynamic_cast<Curve*>(found);
+            	CHECK_NULL_PTR_ERROR(newEdge);
+            	newOCCEdge = E;
+            }
+            if(!to_keep && !known)
             {
                 for(unsigned int k=0; k<m_newCurves.size() && !found_in_news;k++)
                 {
@@ -1990,6 +2264,7 @@ void GeomModificationBaseClass::createNewCurves(const TopoDS_Shape& shape,
                 newOCCEdge=E;
                 m_newEntities.push_back(newEdge);
                 m_newCurves.push_back(newEdge);
+                news.Bind(E, newEdge);
 #ifdef _DEBUG2
                 std::cout<<"**** "<<newEdge->getName()<<" nouvelle"<<std::endl;
 #endif
@@ -2025,13 +2300,20 @@ void GeomModificationBaseClass::createNewSurfaces(
 #ifdef _DEBUG2
     std::cout<<"**** createNewSurfaces ... avec "<<entities.Extent()<<" entités"<<std::endl;
 #endif
+    // calcul de la triangulation interne des nouvelles faces, toutes ensemble
+    OCCGeomRepresentation::buildIncrementalBRepMesh(entities, 0.01);
+
     std::list<TopoDS_Face> sorted_entities;
-    for(int i = 1; i <= entities.Extent(); i++){
-    	TopoDS_Face F = TopoDS::Face(entities(i));
-    	sorted_entities.push_back(F);
-    	OCCGeomRepresentation::buildIncrementalBRepMesh(F, 0.01); // calcul de la triangulation interne
-    }
+    for(int i = 1; i <= entities.Extent(); i++)
+    	sorted_entities.push_back(TopoDS::Face(entities(i)));
     sorted_entities.sort(compareOCCFace);
+
+    ShapeEntityMap refs, news;
+    ajouteShapes(m_ref_entities[2], refs);
+    ajouteShapes(m_newSurfaces, news);
+    IndexReferences index_refs;
+    indexeReferences(m_ref_entities[2], index_refs);
+    std::vector<uint> candidats;
 #ifdef _DEBUG2
     std::cout<<" ==== end sorted_entities.sort ===="<<std::endl;
 #endif
@@ -2053,41 +2335,57 @@ void GeomModificationBaseClass::createNewSurfaces(
     		TopoDS_Face  newOCCFace;
 
     		bool to_keep=false;
+    		// recherche directe de la shape (ou par l'historique)
+    		GeomEntity* found = 0;
+    		bool isRef = false;
+    		const bool known = findShape(F, refs, news, found, isRef);
+    		if (found && isRef){
+    			to_keep = true;
+    			newFace = dynamic_cast<Surface*>(found);
+    			CHECK_NULL_PTR_ERROR(newFace);
+    			newOCCFace = F;
+    			m_toKeepSurfaces.push_back(newFace);
+    		}
+
     		// pour chaque surface de la nouvelle shape, on regarde si
     		// cette surface n'existe pas déjà dans une shape de référence
 
-    		std::list<GeomEntity*>::iterator it = m_ref_entities[2].begin();
-    		for(;it!=m_ref_entities[2].end() && !to_keep; it++)
+    		// une shape issue de l'opération n'est comparée qu'aux entités
+    		// adjacentes qui ne sont pas des arguments de l'opération
+    		// seules les représentations proches (index des boîtes) sont comparées
+    		candidats.clear();
+    		if (!known || !found)
+    			candidatsReferences(index_refs, F, candidats);
+    		for(uint k=0; k<candidats.size() && !to_keep; k++)
     		{
-    			Surface* current = dynamic_cast<Surface*>(*it);
+    			if (known && isOperationInput(index_refs.entities[candidats[k]]))
+    				continue;
+    			Surface* current = dynamic_cast<Surface*>(index_refs.entities[candidats[k]]);
     			CHECK_NULL_PTR_ERROR(current);
-
-    			std::vector<GeomRepresentation*> loc_reps = current->getComputationalProperties();
-
-    			for (uint j=0; j<loc_reps.size(); j++){
-    				OCCGeomRepresentation* occ_rep =
-    						dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
-    				CHECK_NULL_PTR_ERROR(occ_rep);
-    				TopoDS_Face rep_face = TopoDS::Face(occ_rep->getShape());
+    			TopoDS_Face rep_face = TopoDS::Face(index_refs.shapes[candidats[k]]);
 #ifdef _DEBUG2
-    				std::cout<<"  areEquals avec "<<current->getName()<<std::endl;
-#endif
-    				if(OCCGeomRepresentation::areEquals(F,rep_face)){
-    					//std::cout<<"\t on garde"<<std::endl;
-    					// on a trouve que la face existe déjà, on en conserve la référence
-    					to_keep = true;
-    					newFace = current;
-    					newOCCFace = F;
-    					m_toKeepSurfaces.push_back(current);
+    			std::cout<<"  areEquals avec "<<current->getName()<<std::endl;
+#endif
+    			if(OCCGeomRepresentation::areEquals(F,rep_face)){
+    				//std::cout<<"\t on garde"<<std::endl;
+    				// on a trouve que la face existe déjà, on en conserve la référence
+    				to_keep = true;
+    				newFace = current;
+    				newOCCFace = F;
+    				m_toKeepSurfaces.push_back(current);
 #ifdef _DEBUG2
-    					std::cout<<"**** "<<current->getName()<<" a conserver"<<std::endl;
+    				std::cout<<"**** "<<current->getName()<<" a conserver"<<std::endl;
 #endif
-    				}
-    			} // end for j
-    		} // end for it
+    			}
+    		} // end for k
 
-    		bool found_in_news = false;
-    		if(!to_keep)
+    		bool found_in_news = (found && !isRef);
+    		if (found_in_news){
+    			newFace = dynamic_cast<Surface*>(found);
+    			CHECK_NULL_PTR_ERROR(newFace);
+    			newOCCFace = F;
+    		}
+    		if(!to_keep && !known)
     		{
     			for(unsigned int k=0; k<m_newSurfaces.size() &&!found_in_news;k++)
     			{
@@ -2117,6 +2415,7 @@ void GeomModificationBaseClass::createNewSurfaces(
     			newOCCFace = F;
     			m_newEntities.push_back(newFace);
     			m_newSurfaces.push_back(newFace);
+    			news.Bind(F, newFace);
 #ifdef _DEBUG2
     			std::cout<<"**** "<<newFace->getName()<<" nouvelle"<<std::endl;
 #endif
@@ -2161,6 +2460,13 @@ void GeomModificationBaseClass::createNewVolumes(
     }
     sorted_entities.sort(compareOCCSolid);
 
+    ShapeEntityMap refs, news;
+    ajouteShapes(m_ref_entities[3], refs);
+    ajouteShapes(m_newVolumes, news);
+    IndexReferences index_refs;
+    indexeReferences(m_ref_entities[3], index_refs);
+    std::vector<uint> candidats;
+
     for (std::list<TopoDS_Solid>::iterator iter=sorted_entities.begin();
         		iter!=sorted_entities.end(); ++iter)
     {
@@ -2169,18 +2475,33 @@ void GeomModificationBaseClass::createNewVolumes(
         TopoDS_Solid newOCCVolume;
 
         bool to_keep=false;
+        // recherche directe de la shape (ou par l'historique)
+        GeomEntity* found = 0;
+        bool isRef = false;
+        const bool known = findShape(V, refs, news, found, isRef);
+        if (found && isRef){
+            to_keep = true;
+            newVolume = dynamic_cast<Volume*>(found);
+            CHECK_NULL_PTR_ERROR(newVolume);
+            newOCCVolume = V;
+            m_toKeepVolumes.push_back(newVolume);
+        }
+
         // pour chaque volume de la nouvelle shape, on regarde si
         // ce volume n'existe pas déjà dans une shape de référence
 
-        std::list<GeomEntity*>::iterator it = m_ref_entities[3].begin();
-        int index=0;
-        for(;it!=m_ref_entities[3].end() && !to_keep; it++)
+        // une shape issue de l'opération n'est comparée qu'aux entités
+        // adjacentes qui ne sont pas des arguments de l'opération
+        // seuls les volumes proches (index des boîtes) sont comparés
+        candidats.clear();
+        if (!known || !found)
+            candidatsReferences(index_refs, V, candidats);
+        for(uint k=0; k<candidats.size() && !to_keep; k++)
         {
-            Volume* current = dynamic_cast<Volume*>(*it);
+            if (known && isOperationInput(index_refs.entities[candidats[k]]))
+                continue;
+            Volume* current = dynamic_cast<Volume*>(index_refs.entities[candidats[k]]);
             CHECK_NULL_PTR_ERROR(current);
-            OCCGeomRepresentation* occ_rep =
-                    dynamic_cast<OCCGeomRepresentation*>(current->getComputationalProperty());
-            CHECK_NULL_PTR_ERROR(occ_rep);
 //            TopoDS_Shape sh = occ_rep->getShape();
 //            std::cout<<index++<<") "<<current->getName()<<" : "<<sh.ShapeType()<<std::endl;
 //            if(sh.ShapeType()==TopAbs_COMPOUND)
@@ -2192,7 +2513,7 @@ void GeomModificationBaseClass::createNewVolumes(
 //            else if(sh.ShapeType()==TopAbs_SOLID)
 //                std::cout<<"   --> SOLID"<<std::endl;
 
-            TopoDS_Solid rep_volume = TopoDS::Solid(occ_rep->getShape());
+            TopoDS_Solid rep_volume = TopoDS::Solid(index_refs.shapes[candidats[k]]);
 
             if(OCCGeomRepresentation::areEquals(V,rep_volume))
             {
@@ -2207,8 +2528,13 @@ void GeomModificationBaseClass::createNewVolumes(
             }
 
         }
-        bool found_in_news = false;
-        if(!to_keep)
+        bool found_in_news = (found && !isRef);
+        if (found_in_news){
+            newVolume = dynamic_cast<Volume*>(found);
+            CHECK_NULL_PTR_ERROR(newVolume);
+            newOCCVolume = V;
+        }
+        if(!to_keep && !known)
         {
             for(unsigned int k=0; k<m_newVolumes.size() &&!found_in_news;k++)
             {
@@ -2237,6 +2563,7 @@ void GeomModificationBaseClass::createNewVolumes(
             newOCCVolume= V;
             m_newEntities.push_back(newVolume);
             m_newVolumes.push_back(newVolume);
+            news.Bind(V, newVolume);
             occ_entities.push_back(newOCCVolume);
             m3d_entities.push_back(newVolume);
 #ifdef _DEBUG2
@@ -85,8 +85,7 @@ void GeomNewPrismImplementation::perform(std::vector<GeomEntity*>& res)
             throw TkUtil::Exception (TkUtil::UTF8String ("OCC n'arrive pas à effectuer la création du prisme par extrusion", TkUtil::Charset::UTF_8));
         }
         // on a obtenu le volume souhaite en OCC
-        TopoDS_Solid res_vol = TopoDS::Solid(builder.Shape());
-        createGeomEntities(res_vol);
+        createGeomEntities(builder);
         /* res est la nouvelle shape, on doit la connecter aux sous-shapes déjà
          * existantes ou créer de nouvelles sous-shapes.
          */
@@ -99,8 +98,7 @@ void GeomNewPrismImplementation::perform(std::vector<GeomEntity*>& res)
             throw TkUtil::Exception (TkUtil::UTF8String ("OCC n'arrive pas à effectuer la création du prisme par extrusion", TkUtil::Charset::UTF_8));
         }
         // on a obtenu le volume souhaite en OCC
-        TopoDS_Face res_face = TopoDS::Face(builder.Shape());
-        createGeomEntities(res_face);
+        createGeomEntities(builder);
         /* res est la nouvelle shape, on doit la connecter aux sous-shapes déjà
          * existantes ou créer de nouvelles sous-shapes.
          */
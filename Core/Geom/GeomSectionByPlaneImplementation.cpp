@@ -153,7 +153,7 @@ void GeomSectionByPlaneImplementation::splitEntities(std::vector<GeomEntity*>& r
 
     s = splitter.Shape();
 
-    createGeomEntities(s,true);
+    createGeomEntities(splitter,true);
 
     //=========================================================================
     //          Gestion des groupes de volumes (si un seul volume en entrée)
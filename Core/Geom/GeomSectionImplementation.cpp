@@ -166,7 +166,7 @@ void GeomSectionImplementation::sectionVolumes(std::vector<GeomEntity*>& res)
     splitter.Build();
     s = splitter.Shape();
 
-    createGeomEntities(s,true);
+    createGeomEntities(splitter,true);
 
     res.insert(res.end(), entities_new.begin(), entities_new.end());
 }
@@ -220,12 +220,13 @@ void GeomSectionImplementation::sectionSurfaces(std::vector<GeomEntity*>& res)
         list_of_arguments.Append(si);
     }
     list_of_arguments.Append(tool_face);
+    splitter.SetArguments(list_of_arguments);
     splitter.Build();
     s = splitter.Shape();
 
 
     //createGeomEntitiesBut(s,tool_shape);
-    createGeomEntities(s,true);
+    createGeomEntities(splitter,true);
 
     res.insert(res.end(), entities_new.begin(), entities_new.end());
 }
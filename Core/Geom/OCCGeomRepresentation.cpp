@@ -11,6 +11,7 @@
 #include "Geom/GeomDisplayRepresentation.h"
 #include "Geom/OCCDisplayRepresentationBuilder.h"
 #include "Geom/OCCFacetedRepresentationBuilder.h"
+#include "Geom/OCCProjector.h"
 #include "Geom/EntityFactory.h"
 #include "Geom/Vertex.h"
 #include "Geom/Curve.h"
@@ -18,6 +19,7 @@
 #include "Geom/Volume.h"
 #include "Utils/MgxNumeric.h"
 #include "Utils/MgxException.h"
+#include "Utils/ParallelExecution.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/TraceLog.h>
 #include <TkUtil/Log.h>
@@ -26,6 +28,7 @@
 #include <TkUtil/Exception.h>
 #include <algorithm>
 #include <TkUtil/MemoryError.h>
+#include <TkUtil/Mutex.h>
 /*----------------------------------------------------------------------------*/
 //inclusion de fichiers en-tête d'Open Cascade
 #include <TopoDS_Shape.hxx>
@@ -113,6 +116,9 @@
 #include <BRepClass_FaceClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopLoc_Location.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 
 #include <GeomAPI_IntCS.hxx>
@@ -133,9 +139,31 @@ namespace Geom {
 /*----------------------------------------------------------------------------*/
 TDF_Label OCCGeomRepresentation::m_rootLabel=TDF_Label();
 /*----------------------------------------------------------------------------*/
+/// identifiant unique d'un ensemble de projecteurs (jamais réutilisé)
+static unsigned long nouvelIdentifiantProjecteurs()
+{
+	static std::atomic<unsigned long> suivant(0);
+	return ++suivant;
+}
+/*----------------------------------------------------------------------------*/
+/** projecteurs créés par un thread lancé par Utils::executeEnParallele,
+ *  détruits avec le thread à la fin de la section parallèle
+ */
+struct ProjecteursDuThread {
+	~ProjecteursDuThread()
+	{
+		for (std::map<unsigned long, OCCProjector*>::iterator iter = projecteurs.begin();
+				iter != projecteurs.end(); ++iter)
+			delete iter->second;
+	}
+	std::map<unsigned long, OCCProjector*> projecteurs;
+};
+static thread_local ProjecteursDuThread projecteursDuThread;
+/*----------------------------------------------------------------------------*/
 OCCGeomRepresentation::OCCGeomRepresentation(Internal::Context& c,
 			const TopoDS_Shape& shape)
-:m_context(c), m_shape(shape), m_label()
+:m_context(c), m_shape(shape), m_label(), m_projectors(),
+ m_projectorsId(nouvelIdentifiantProjecteurs())
 {
     // on ne fait pas appel à BRepBuilderAPI_Copy ici car dans ce cas les shapes
     // "identiques" ne sont pas reconnues comme telles (différentes avec IsSame)
@@ -148,7 +176,8 @@ OCCGeomRepresentation::OCCGeomRepresentation(Internal::Context& c,
 }
 /*----------------------------------------------------------------------------*/
 OCCGeomRepresentation::OCCGeomRepresentation(const OCCGeomRepresentation& rep)
-: m_context(rep.m_context), m_shape(rep.m_shape)
+: m_context(rep.m_context), m_shape(rep.m_shape), m_projectors(),
+  m_projectorsId(nouvelIdentifiantProjecteurs())
 {
     // on ne fait pas appel à BRepBuilderAPI_Copy ici car dans ce cas les shapes
     // "identiques" ne sont pas reconnues comme telles (différentes avec IsSame)
@@ -161,7 +190,9 @@ OCCGeomRepresentation::OCCGeomRepresentation(const OCCGeomRepresentation& rep)
 }
 /*----------------------------------------------------------------------------*/
 OCCGeomRepresentation::~OCCGeomRepresentation()
-{}
+{
+	resetProjector();
+}
 /*----------------------------------------------------------------------------*/
 bool OCCGeomRepresentation::useOCAF() const
 {
@@ -1696,69 +1727,6 @@ void OCCGeomRepresentation::project(Utils::Math::Point& P, const Curve* C)
 void OCCGeomRepresentation::project(Utils::Math::Point& P, const Surface* S)
 {
     projectPointOn(P);
-
-//	double tol = 1.0e-7;
-//	gp_Pnt aPnt(P.getX(),P.getY(),P.getZ());
-//
-//	// version Salomé d'une projection d'un point sur une surface
-//	// 3 fois plus rapide que projectPointOn, mais pb avec tests unitaires
-//
-//	TopoDS_Face aFace = TopoDS::Face(m_shape);
-//	Handle(Geom_Surface) surface = BRep_Tool::Surface(aFace);
-//	double U1, U2, V1, V2;
-//	//surface->Bounds(U1, U2, V1, V2);
-//	BRepTools::UVBounds(aFace, U1, U2, V1, V2);
-//
-//	// projector
-//	GeomAPI_ProjectPointOnSurf proj;
-//	proj.Init(surface, U1, U2, V1, V2, tol);
-//
-//	//gp_Pnt aPnt = BRep_Tool::Pnt(TopoDS::Vertex(anOriginal));
-//	proj.Perform(aPnt);
-//	if (!proj.IsDone()) {
-//		Standard_ConstructionError::Raise
-//		("Projection aborted : the algorithm failed");
-//	}
-//	int nbPoints = proj.NbPoints();
-//	if (nbPoints < 1) {
-//		Standard_ConstructionError::Raise("No solution found");
-//	}
-//
-//	Quantity_Parameter U, V;
-//	proj.LowerDistanceParameters(U, V);
-//	gp_Pnt2d aProjPnt (U, V);
-//
-//	// classifier
-//	BRepClass_FaceClassifier aClsf (aFace, aProjPnt, tol);
-//	if (aClsf.State() != TopAbs_IN && aClsf.State() != TopAbs_ON) {
-//		bool isSol = false;
-//		double minDist = RealLast();
-//		for (int i = 1; i <= nbPoints; i++) {
-//			Quantity_Parameter Ui, Vi;
-//			proj.Parameters(i, Ui, Vi);
-//			aProjPnt = gp_Pnt2d(Ui, Vi);
-//			aClsf.Perform(aFace, aProjPnt, tol);
-//			if (aClsf.State() == TopAbs_IN || aClsf.State() == TopAbs_ON) {
-//				isSol = true;
-//				double dist = proj.Distance(i);
-//				if (dist < minDist) {
-//					minDist = dist;
-//					U = Ui;
-//					V = Vi;
-//				}
-//			}
-//		}
-//		if (!isSol) {
-//			Standard_ConstructionError::Raise("No solution found");
-//		}
-//	}
-//
-//	gp_Pnt surfPnt = surface->Value(U, V);
-//
-//	//aShape = BRepBuilderAPI_MakeVertex(surfPnt).Shape();
-//
-//
-//	P.setXYZ(surfPnt.X(), surfPnt.Y(), surfPnt.Z());
 }
 /*----------------------------------------------------------------------------*/
 void OCCGeomRepresentation::project(const Utils::Math::Point& P1, Utils::Math::Point& P2,
@@ -1776,7 +1744,64 @@ void OCCGeomRepresentation::project(const Utils::Math::Point& P1, Utils::Math::P
     projectPointOn(P2);
 }
 /*----------------------------------------------------------------------------*/
+void OCCGeomRepresentation::project(std::vector<Utils::Math::Point>& points,
+		const Surface* S)
+{
+	OCCProjector* projector = getProjector();
+	for (uint i=0; i<points.size(); i++)
+		projectPointOn(points[i], projector);
+}
+/*----------------------------------------------------------------------------*/
+void OCCGeomRepresentation::project(std::vector<Utils::Math::Point>& points,
+		const Curve* C)
+{
+	OCCProjector* projector = getProjector();
+	for (uint i=0; i<points.size(); i++)
+		projectPointOn(points[i], projector);
+}
+/*----------------------------------------------------------------------------*/
+OCCProjector* OCCGeomRepresentation::getProjector()
+{
+	if (!OCCProjector::isHandled(m_shape))
+		return 0;
+
+	TkUtil::AutoMutex autoMutex (&m_projectorMutex);
+
+	// les threads de executeEnParallele sont créés à chaque appel, leurs
+	// projecteurs disparaissent avec eux
+	if (Utils::dansExecutionParallele()){
+		OCCProjector*& projector = projecteursDuThread.projecteurs[m_projectorsId];
+		if (projector == 0)
+			projector = new OCCProjector(m_shape);
+		return projector;
+	}
+
+	OCCProjector*& projector = m_projectors[std::this_thread::get_id()];
+	if (projector == 0)
+		projector = new OCCProjector(m_shape);
+	return projector;
+}
+/*----------------------------------------------------------------------------*/
+void OCCGeomRepresentation::resetProjector()
+{
+	TkUtil::AutoMutex autoMutex (&m_projectorMutex);
+	for (std::map<std::thread::id, OCCProjector*>::iterator iter = m_projectors.begin();
+			iter != m_projectors.end(); ++iter)
+		delete iter->second;
+	m_projectors.clear();
+	// les projecteurs des threads en cours ne seront plus retrouvés
+	m_projectorsId = nouvelIdentifiantProjecteurs();
+}
+/*----------------------------------------------------------------------------*/
 void OCCGeomRepresentation::projectPointOn( Utils::Math::Point& P)
+{
+	if(m_shape.ShapeType()==TopAbs_VERTEX)
+		projectPointOn(P, 0);
+	else
+		projectPointOn(P, getProjector());
+}
+/*----------------------------------------------------------------------------*/
+void OCCGeomRepresentation::projectPointOn( Utils::Math::Point& P, OCCProjector* projector)
 {
 
 	if(m_shape.ShapeType()==TopAbs_VERTEX)
@@ -1784,6 +1809,14 @@ void OCCGeomRepresentation::projectPointOn( Utils::Math::Point& P)
 		gp_Pnt pnt = BRep_Tool::Pnt(TopoDS::Vertex(m_shape));
 		P.setXYZ(pnt.X(), pnt.Y(), pnt.Z());
 	}
+	else if (projector)
+	{
+		// projecteur persistant sur la face ou l'arête
+		gp_Pnt pnt(P.getX(),P.getY(),P.getZ());
+		gp_Pnt pnt2;
+		projector->project(pnt, pnt2);
+		P.setXYZ(pnt2.X(), pnt2.Y(), pnt2.Z());
+	}
 	else
 	{
 		gp_Pnt pnt(P.getX(),P.getY(),P.getZ());
@@ -1809,6 +1842,32 @@ void OCCGeomRepresentation::projectPointOn( Utils::Math::Point& P)
 void OCCGeomRepresentation::normal(const Utils::Math::Point& P1, Utils::Math::Vector& V2, const Surface* S)
 {
 	//std::cout<<"OCCGeomRepresentation::normal avec m_shape "<<(m_shape.IsNull()?"vide":"non vide")<<std::endl;
+	if (!m_shape.IsNull() && m_shape.ShapeType()==TopAbs_FACE){
+		// projection avec le projecteur persistant pour en déduire les paramètres
+		gp_Pnt pnt(P1.getX(),P1.getY(),P1.getZ());
+		gp_Pnt pnt2;
+		Standard_Real U, V;
+		OCCProjector::SupportType support;
+		OCCProjector* projector = getProjector();
+		support = projector->project(pnt, pnt2);
+		projector->getLastParameters(U, V);
+		const Handle(Geom_Surface)& brepSurface = projector->getSurface();
+
+		if (support == OCCProjector::IsInFace){
+			gp_Pnt out_pnt;
+			gp_Vec du, dv;
+			brepSurface->D1(U,V,out_pnt,du,dv);
+
+			gp_Vec n=du.Crossed(dv);
+			V2.setXYZ(n.X(), n.Y(), n.Z());
+		}
+		else {
+			// solution sur le bord de la surface, normale inconnue pour OCC
+			V2.setXYZ(0, 0, 0);
+		}
+		return;
+	}
+
 	// projection pour en déduire les paramètres
 	gp_Pnt pnt(P1.getX(),P1.getY(),P1.getZ());
 	TopoDS_Vertex Vtx = BRepBuilderAPI_MakeVertex(pnt);
@@ -2088,6 +2147,30 @@ void OCCGeomRepresentation::getPoint(const double& p, Utils::Math::Point& Pt,
     Pt.setXYZ(res.X(), res.Y(), res.Z());
 }
 /*----------------------------------------------------------------------------*/
+void OCCGeomRepresentation::getPoints(const std::vector<double>& params,
+        std::vector<Utils::Math::Point>& points, const bool in01)
+{
+    if(m_shape.ShapeType()!=TopAbs_EDGE)
+    	MGX_FORBIDDEN("cas d'un wire");
+
+    BRepAdaptor_Curve brepCurve(TopoDS::Edge(m_shape));
+    double f = 0.0;
+    double l = 1.0;
+    if (in01){
+        f = brepCurve.FirstParameter();
+        l = brepCurve.LastParameter();
+        //p dans [0,1] a positionner dans [f,l]
+        if (f>l)
+            std::swap(f, l);
+    }
+
+    points.resize(params.size());
+    for (uint i=0; i<params.size(); i++){
+        gp_Pnt res = brepCurve.Value(in01 ? f+params[i]*(l-f) : params[i]);
+        points[i].setXYZ(res.X(), res.Y(), res.Z());
+    }
+}
+/*----------------------------------------------------------------------------*/
 //#define _DEBUG_INTERSECTION
 void OCCGeomRepresentation::getIntersection(gp_Pln& plan_cut, Utils::Math::Point& Pt)
 {
@@ -2557,6 +2640,7 @@ void OCCGeomRepresentation::translate(const Utils::Math::Vector& V)
 
     //on stocke le résultat de la translation (maj de la shape interne)
     m_shape = translat.Shape();
+    resetProjector();
 }
 /*----------------------------------------------------------------------------*/
 void OCCGeomRepresentation::scale(const double F, const Point& center)
@@ -2580,6 +2664,7 @@ void OCCGeomRepresentation::scale(const double F, const Point& center)
 
     //on stocke le résultat de la translation (maj de la shape interne)
     m_shape = scaling.Shape();
+    resetProjector();
 }
 /*----------------------------------------------------------------------------*/
 void OCCGeomRepresentation::scale(const double factorX,
@@ -2607,6 +2692,7 @@ void OCCGeomRepresentation::scale(const double factorX,
 
     //on stocke le résultat de la translation (maj de la shape interne)
     m_shape = scaling.Shape();
+    resetProjector();
 }
 /*----------------------------------------------------------------------------*/
 void OCCGeomRepresentation::rotate(const Utils::Math::Point& P1,
@@ -2630,6 +2716,7 @@ void OCCGeomRepresentation::rotate(const Utils::Math::Point& P1,
 
     //on stocke le résultat de la translation (maj de la shape interne)
     m_shape = rotat.Shape();
+    resetProjector();
 }
 /*----------------------------------------------------------------------------*/
 void OCCGeomRepresentation::mirror(const Utils::Math::Plane& plane)
@@ -2650,6 +2737,7 @@ void OCCGeomRepresentation::mirror(const Utils::Math::Plane& plane)
 
     //on stocke le résultat de la transformation (maj de la shape interne)
     m_shape = trans.Shape();
+    resetProjector();
 }
 /*----------------------------------------------------------------------------*/
 GeomRepresentation* OCCGeomRepresentation::clone() const
@@ -3108,6 +3196,48 @@ buildIncrementalBRepMesh(TopoDS_Shape& shape, const double& deflection)
     return deflection;
 }
 /*----------------------------------------------------------------------------*/
+void OCCGeomRepresentation::
+buildIncrementalBRepMesh(const TopTools_IndexedMapOfShape& faces, const double& deflection)
+{
+    // la triangulation est portée par la TShape, une face déjà maillée
+    // (par exemple inchangée par une opération précédente) n'est pas remaillée
+    // si sa flèche est au moins aussi fine que celle demandée (une face
+    // triangulée à la volée avec une flèche plus grossière est remaillée)
+    BRep_Builder builder;
+    TopoDS_Compound compound;
+    builder.MakeCompound(compound);
+    int nbFaces = 0;
+    for (int i = 1; i <= faces.Extent(); i++){
+        const TopoDS_Shape& sh = faces(i);
+        if (sh.IsNull() || sh.ShapeType() != TopAbs_FACE)
+            continue;
+        TopLoc_Location aLoc;
+        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(TopoDS::Face(sh), aLoc);
+        if (!triangulation.IsNull()){
+            // la flèche stockée est absolue, celle demandée est relative
+            // à la plus grande dimension de la boite englobante de la face
+            Bnd_Box bounds;
+            BRepBndLib::Add(sh, bounds);
+            Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+            bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+            Standard_Real dim = std::max(xMax-xMin, std::max(yMax-yMin, zMax-zMin));
+            if (triangulation->Deflection() <= deflection*dim)
+                continue;
+        }
+        builder.Add(compound, sh);
+        nbFaces++;
+    }
+#ifdef _DEBUG2
+    std::cout<<"buildIncrementalBRepMesh "<<nbFaces<<" faces à mailler sur "<<faces.Extent()<<std::endl;
+#endif
+    if (nbFaces == 0)
+        return;
+
+    // une seule passe pour toutes les faces, en parallèle, avec une flèche
+    // relative à la taille de chacune des faces
+    BRepMesh_IncrementalMesh mesher(compound, deflection, Standard_True, 0.5, Standard_True);
+}
+/*----------------------------------------------------------------------------*/
 double OCCGeomRepresentation::getPrecision()
 {
 	if(m_shape.ShapeType()==TopAbs_VERTEX){
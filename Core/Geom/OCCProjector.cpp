@@ -0,0 +1,231 @@
+/*----------------------------------------------------------------------------*/
+/** \file OCCProjector.cpp
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Geom/OCCProjector.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <algorithm>
+#include <cmath>
+/*----------------------------------------------------------------------------*/
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepTools.hxx>
+#include <BRepBndLib.hxx>
+#include <Bnd_Box.hxx>
+#include <Precision.hxx>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+/*----------------------------------------------------------------------------*/
+OCCProjector::OCCProjector(const TopoDS_Shape& shape)
+: m_shape(shape)
+, m_tolerance(Precision::Confusion())
+, m_faceTolerance(Precision::Confusion())
+, m_hint(0.0, 0.0)
+, m_hasHint(false)
+{
+	if (m_shape.ShapeType() == TopAbs_FACE)
+		initFace();
+	else if (m_shape.ShapeType() == TopAbs_EDGE)
+		initEdge(m_shape);
+	else
+		throw TkUtil::Exception("Erreur interne, OCCProjector ne projette que sur une face ou une arête");
+
+	TopTools_IndexedMapOfShape vertices;
+	TopExp::MapShapes(m_shape, TopAbs_VERTEX, vertices);
+	for (int i=1; i<=vertices.Extent(); i++)
+		m_vertices.push_back(BRep_Tool::Pnt(TopoDS::Vertex(vertices(i))));
+}
+/*----------------------------------------------------------------------------*/
+OCCProjector::~OCCProjector()
+{
+	for (uint i=0; i<m_edges.size(); i++)
+		delete m_edges[i];
+}
+/*----------------------------------------------------------------------------*/
+bool OCCProjector::isHandled(const TopoDS_Shape& shape)
+{
+	return !shape.IsNull()
+			&& (shape.ShapeType() == TopAbs_FACE || shape.ShapeType() == TopAbs_EDGE);
+}
+/*----------------------------------------------------------------------------*/
+void OCCProjector::initFace()
+{
+	m_face = TopoDS::Face(m_shape);
+	m_surface = BRep_Tool::Surface(m_face);
+	m_faceTolerance = BRep_Tool::Tolerance(m_face);
+	// même tolérance que BRepExtrema_ExtPF
+	m_tolerance = std::min(m_faceTolerance, Precision::Confusion());
+
+	double U1, U2, V1, V2;
+	BRepTools::UVBounds(m_face, U1, U2, V1, V2);
+	m_surfaceProjector.Init(m_surface, U1, U2, V1, V2, m_tolerance);
+
+	m_analysis = new ShapeAnalysis_Surface(m_surface);
+
+	// les arêtes du bord (une seule fois pour les arêtes de couture)
+	TopTools_IndexedMapOfShape edges;
+	TopExp::MapShapes(m_face, TopAbs_EDGE, edges);
+	for (int i=1; i<=edges.Extent(); i++)
+		initEdge(edges(i));
+}
+/*----------------------------------------------------------------------------*/
+void OCCProjector::initEdge(const TopoDS_Shape& shape)
+{
+	TopoDS_Edge edge = TopoDS::Edge(shape);
+	// une arête dégénérée se réduit à un sommet, pris en compte par ailleurs
+	if (BRep_Tool::Degenerated(edge))
+		return;
+
+	double first, last;
+	Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, first, last);
+	if (curve.IsNull())
+		return;
+
+	EdgeProjector* ep = new EdgeProjector();
+	ep->curve = curve;
+	ep->projector.Init(curve, first, last);
+
+	Bnd_Box box;
+	BRepBndLib::Add(edge, box, Standard_False);
+	box.Enlarge(Precision::Confusion());
+	box.Get(ep->xmin, ep->ymin, ep->zmin, ep->xmax, ep->ymax, ep->zmax);
+
+	m_edges.push_back(ep);
+}
+/*----------------------------------------------------------------------------*/
+double OCCProjector::squareDistanceToBox(const gp_Pnt& P, const EdgeProjector& ep)
+{
+	double dx = std::max(0.0, std::max(ep.xmin-P.X(), P.X()-ep.xmax));
+	double dy = std::max(0.0, std::max(ep.ymin-P.Y(), P.Y()-ep.ymax));
+	double dz = std::max(0.0, std::max(ep.zmin-P.Z(), P.Z()-ep.zmax));
+	return dx*dx+dy*dy+dz*dz;
+}
+/*----------------------------------------------------------------------------*/
+double OCCProjector::projectInFace(const gp_Pnt& P, gp_Pnt& res, double& u, double& v,
+		double& bound)
+{
+	double bestD2 = RealLast();
+	bound = RealLast();
+
+	// recherche locale depuis le projeté précédent, le point obtenu n'est
+	// qu'une borne (il peut n'être qu'un extremum local) qui permet d'éviter
+	// des classifications et d'écarter des arêtes
+	if (m_hasHint){
+		gp_Pnt2d uv = m_analysis->NextValueOfUV(m_hint, P, m_tolerance);
+		m_classifier.Perform(m_face, uv, m_faceTolerance);
+		if (m_classifier.State() == TopAbs_IN || m_classifier.State() == TopAbs_ON){
+			bound = P.SquareDistance(m_surface->Value(uv.X(), uv.Y()));
+			u = uv.X();
+			v = uv.Y();
+		}
+	}
+
+	// recherche exhaustive, seuls les extrema dans la face sont retenus, ceux
+	// plus loin que la borne ne peuvent pas être le plus proche
+	m_surfaceProjector.Perform(P);
+	if (!m_surfaceProjector.IsDone())
+		return bestD2;
+
+	double limit = RealLast();
+	if (bound < RealLast()){
+		limit = std::sqrt(bound) + m_tolerance;
+		limit *= limit;
+	}
+	for (int i=1; i<=m_surfaceProjector.NbPoints(); i++){
+		double dist = m_surfaceProjector.Distance(i);
+		if (dist*dist >= bestD2 || dist*dist > limit)
+			continue;
+
+		double ui, vi;
+		m_surfaceProjector.Parameters(i, ui, vi);
+		m_classifier.Perform(m_face, gp_Pnt2d(ui, vi), m_faceTolerance);
+		if (m_classifier.State() == TopAbs_IN || m_classifier.State() == TopAbs_ON){
+			bestD2 = dist*dist;
+			res = m_surfaceProjector.Point(i);
+			u = ui;
+			v = vi;
+		}
+	}
+
+	return bestD2;
+}
+/*----------------------------------------------------------------------------*/
+OCCProjector::SupportType OCCProjector::project(const gp_Pnt& P, gp_Pnt& res)
+{
+	// les sommets
+	double vertexD2 = RealLast();
+	gp_Pnt vertexPnt;
+	for (uint i=0; i<m_vertices.size(); i++){
+		double d2 = P.SquareDistance(m_vertices[i]);
+		if (d2 < vertexD2){
+			vertexD2 = d2;
+			vertexPnt = m_vertices[i];
+		}
+	}
+
+	// l'intérieur de la face
+	double faceD2 = RealLast();
+	gp_Pnt facePnt;
+	double u = 0.0, v = 0.0;
+	double faceBound = RealLast();
+	if (!m_surface.IsNull())
+		faceD2 = projectInFace(P, facePnt, u, v, faceBound);
+
+	// les arêtes, celles dont la boite est plus loin que le meilleur
+	// candidat courant ne peuvent pas donner mieux
+	double edgeD2 = RealLast();
+	gp_Pnt edgePnt;
+	double bound = std::min(vertexD2, std::min(faceD2, faceBound));
+	for (uint i=0; i<m_edges.size(); i++){
+		EdgeProjector* ep = m_edges[i];
+		if (bound < RealLast()){
+			double limit = std::sqrt(bound) + m_tolerance;
+			if (squareDistanceToBox(P, *ep) > limit*limit)
+				continue;
+		}
+		ep->projector.Perform(P);
+		if (ep->projector.NbPoints() == 0)
+			continue;
+		double dist = ep->projector.LowerDistance();
+		if (dist*dist < edgeD2){
+			edgeD2 = dist*dist;
+			edgePnt = ep->projector.NearestPoint();
+			bound = std::min(bound, edgeD2);
+		}
+	}
+
+	if (std::min(vertexD2, std::min(faceD2, edgeD2)) == RealLast())
+		throw TkUtil::Exception("Echec d'une projection d'un point sur une courbe ou surface!!");
+
+	if (faceD2 < RealLast() || faceBound < RealLast()){
+		m_hint.SetCoord(u, v);
+		m_hasHint = true;
+	}
+
+	// en cas d'égalité (à la tolérance près), comme BRepExtrema, on privilégie
+	// le sommet puis l'arête
+	double dMin = std::sqrt(std::min(vertexD2, std::min(faceD2, edgeD2)));
+	if (vertexD2 < RealLast() && std::sqrt(vertexD2) <= dMin + m_tolerance){
+		res = vertexPnt;
+		return IsVertex;
+	}
+	if (edgeD2 < RealLast() && std::sqrt(edgeD2) <= dMin + m_tolerance){
+		res = edgePnt;
+		return IsOnEdge;
+	}
+	res = facePnt;
+	return IsInFace;
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Geom
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
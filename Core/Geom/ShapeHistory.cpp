@@ -0,0 +1,120 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ShapeHistory.cpp
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Geom/ShapeHistory.h"
+/*----------------------------------------------------------------------------*/
+#include <TopExp.hxx>
+#include <TopTools_ListIteratorOfListOfShape.hxx>
+#include <Standard_Failure.hxx>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+/*----------------------------------------------------------------------------*/
+ShapeHistory::ShapeHistory()
+{
+}
+/*----------------------------------------------------------------------------*/
+void ShapeHistory::clear()
+{
+    m_inputs.Clear();
+    m_known.clear();
+    m_deleted.clear();
+    m_modified.clear();
+    m_generated.clear();
+    m_images.Clear();
+}
+/*----------------------------------------------------------------------------*/
+void ShapeHistory::record(BRepBuilderAPI_MakeShape& op,
+        const std::vector<TopoDS_Shape>& inputs)
+{
+    clear();
+
+    for (uint i=0; i<inputs.size(); i++){
+        TopExp::MapShapes(inputs[i], TopAbs_VERTEX, m_inputs);
+        TopExp::MapShapes(inputs[i], TopAbs_EDGE, m_inputs);
+        TopExp::MapShapes(inputs[i], TopAbs_FACE, m_inputs);
+        TopExp::MapShapes(inputs[i], TopAbs_SOLID, m_inputs);
+    }
+
+    const int nb = m_inputs.Extent();
+    m_known.resize(nb, false);
+    m_deleted.resize(nb, false);
+    m_modified.resize(nb);
+    m_generated.resize(nb);
+
+    for (int i=1; i<=nb; i++){
+        const TopoDS_Shape& sh = m_inputs(i);
+        // les listes retournées par OCC sont réutilisées d'un appel à
+        // l'autre, on les recopie
+        try {
+            m_deleted[i-1] = op.IsDeleted(sh);
+            m_modified[i-1] = op.Modified(sh);
+            m_generated[i-1] = op.Generated(sh);
+            m_known[i-1] = true;
+        }
+        catch (const Standard_Failure&){
+            m_deleted[i-1] = false;
+            m_modified[i-1].Clear();
+            m_generated[i-1].Clear();
+            continue;
+        }
+        for (TopTools_ListIteratorOfListOfShape it(m_modified[i-1]); it.More(); it.Next())
+            m_images.Add(it.Value());
+        for (TopTools_ListIteratorOfListOfShape it(m_generated[i-1]); it.More(); it.Next())
+            m_images.Add(it.Value());
+    }
+}
+/*----------------------------------------------------------------------------*/
+bool ShapeHistory::isKnown(const TopoDS_Shape& sh) const
+{
+    const int ind = m_inputs.FindIndex(sh);
+    return ind != 0 && m_known[ind-1];
+}
+/*----------------------------------------------------------------------------*/
+bool ShapeHistory::isDeleted(const TopoDS_Shape& sh) const
+{
+    const int ind = m_inputs.FindIndex(sh);
+    return ind != 0 && m_deleted[ind-1];
+}
+/*----------------------------------------------------------------------------*/
+const TopTools_ListOfShape& ShapeHistory::modified(const TopoDS_Shape& sh) const
+{
+    const int ind = m_inputs.FindIndex(sh);
+    return ind == 0 ? m_empty : m_modified[ind-1];
+}
+/*----------------------------------------------------------------------------*/
+const TopTools_ListOfShape& ShapeHistory::generated(const TopoDS_Shape& sh) const
+{
+    const int ind = m_inputs.FindIndex(sh);
+    return ind == 0 ? m_empty : m_generated[ind-1];
+}
+/*----------------------------------------------------------------------------*/
+bool ShapeHistory::isImage(const TopoDS_Shape& sh) const
+{
+    return m_images.Contains(sh) && !m_inputs.Contains(sh);
+}
+/*----------------------------------------------------------------------------*/
+size_t ShapeHistory::getMemorySize() const
+{
+    // une shape dans une liste ou une map : la shape et un noeud
+    const size_t shape = sizeof(TopoDS_Shape) + 2*sizeof(void*);
+
+    size_t nb = m_inputs.Extent() + m_images.Extent();
+    for (uint i=0; i<m_modified.size(); i++)
+        nb += m_modified[i].Extent() + m_generated[i].Extent();
+
+    return sizeof(ShapeHistory) + nb*shape
+            + m_modified.capacity()*sizeof(TopTools_ListOfShape)
+            + m_generated.capacity()*sizeof(TopTools_ListOfShape)
+            + (m_known.capacity()+m_deleted.capacity())/8;
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Geom
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -240,6 +240,15 @@ void Surface::project(Utils::Math::Point& P) const
 	}
 }
 /*----------------------------------------------------------------------------*/
+void Surface::project(std::vector<Utils::Math::Point>& points) const
+{
+	if (getComputationalProperties().size() == 1)
+		getComputationalProperty()->project(points,this);
+	else
+		for (uint i=0; i<points.size(); i++)
+			project(points[i]);
+}
+/*----------------------------------------------------------------------------*/
 void Surface::project(const Utils::Math::Point& P1, Utils::Math::Point& P2) const
 {
 	if (getComputationalProperties().size() == 1)
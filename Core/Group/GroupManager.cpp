@@ -2210,7 +2210,7 @@ void GroupManager::addProjectionOnPZ0(const std::string& nom)
     getContext().getCommandManager().addCommand(command, Utils::Command::DO);
 }
 /*----------------------------------------------------------------------------*/
-void GroupManager::addCartesianPerturbation(const std::string& nom, PyObject* py_obj)
+void GroupManager::addCartesianPerturbation(const std::string& nom, PyObject* py_obj, bool batch)
 {
 	PyObject* pyName = PyObject_GetAttrString(py_obj, "func_name");
 #ifdef _DEBUG2
@@ -2232,19 +2232,22 @@ void GroupManager::addCartesianPerturbation(const std::string& nom, PyObject* py
 
 	// création de l'objet qui va modifier le maillage
 	Mesh::MeshModificationItf* modif = new Mesh::MeshModificationByPythonFunction(py_obj,
-			Mesh::MeshModificationByPythonFunction::cartesian);
+			Mesh::MeshModificationByPythonFunction::cartesian, batch);
 	CommandAddMeshModification* command = new CommandAddMeshModification(getLocalContext(), grp, modif);
 
     // trace dans le script
     TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
     cmd << getContextAlias() << "." << "getGroupManager().addCartesianPerturbation (\""
-        << nom<<"\", "<<PyString_AsString(pyName)<<")";
+        << nom<<"\", "<<PyString_AsString(pyName);
+    if (batch)
+        cmd << ", True";
+    cmd << ")";
     command->setScriptCommand(cmd);
 
     getContext().getCommandManager().addCommand(command, Utils::Command::DO);
 }
 /*----------------------------------------------------------------------------*/
-void GroupManager::addPolarPerturbation(const std::string& nom, PyObject* py_obj)
+void GroupManager::addPolarPerturbation(const std::string& nom, PyObject* py_obj, bool batch)
 {
 	PyObject* pyName = PyObject_GetAttrString(py_obj, "func_name");
 #ifdef _DEBUG2
@@ -2266,13 +2269,16 @@ void GroupManager::addPolarPerturbation(const std::string& nom, PyObject* py_obj
 
 	// création de l'objet qui va modifier le maillage
 	Mesh::MeshModificationItf* modif = new Mesh::MeshModificationByPythonFunction(py_obj,
-			Mesh::MeshModificationByPythonFunction::polar);
+			Mesh::MeshModificationByPythonFunction::polar, batch);
 	CommandAddMeshModification* command = new CommandAddMeshModification(getLocalContext(), grp, modif);
 
     // trace dans le script
     TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
     cmd << getContextAlias() << "." << "getGroupManager().addPolarPerturbation (\""
-        << nom<<"\", "<<PyString_AsString(pyName)<<")";
+        << nom<<"\", "<<PyString_AsString(pyName);
+    if (batch)
+        cmd << ", True";
+    cmd << ")";
     command->setScriptCommand(cmd);
 
     getContext().getCommandManager().addCommand(command, Utils::Command::DO);
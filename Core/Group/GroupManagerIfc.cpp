@@ -189,12 +189,12 @@ void GroupManagerIfc::addProjectionOnPZ0(const std::string& nom)
 	throw TkUtil::Exception ("GroupManagerIfc::addProjectionOnPZ0 should be overloaded.");
 }
 /*----------------------------------------------------------------------------*/
-void GroupManagerIfc::addCartesianPerturbation(const std::string& nom, PyObject* py_obj)
+void GroupManagerIfc::addCartesianPerturbation(const std::string& nom, PyObject* py_obj, bool batch)
 {
 	throw TkUtil::Exception ("GroupManagerIfc::addCartesianPerturbation should be overloaded.");
 }
 /*----------------------------------------------------------------------------*/
-void GroupManagerIfc::addPolarPerturbation(const std::string& nom, PyObject* py_obj)
+void GroupManagerIfc::addPolarPerturbation(const std::string& nom, PyObject* py_obj, bool batch)
 {
 	throw TkUtil::Exception ("GroupManagerIfc::addPolarPerturbation should be overloaded.");
 }
@@ -177,6 +177,43 @@ void CommandComposite::internalRedo()
     startingOrcompletionLog (false);
 }
 /*----------------------------------------------------------------------------*/
+size_t CommandComposite::getMemoryFootprint ( ) const
+{
+    size_t taille = CommandInternal::getMemoryFootprint()
+            + m_commands.capacity()*sizeof(CommandInternal*);
+    for (std::vector<CommandInternal*>::const_iterator iter = m_commands.begin();
+            iter != m_commands.end(); ++iter)
+        taille += (*iter)->getMemoryFootprint();
+    return taille;
+}
+/*----------------------------------------------------------------------------*/
+size_t CommandComposite::getReleasableMemory ( ) const
+{
+    size_t taille = 0;
+    for (std::vector<CommandInternal*>::const_iterator iter = m_commands.begin();
+            iter != m_commands.end(); ++iter)
+        taille += (*iter)->getReleasableMemory();
+
+    // l'InfoCommand de la composition reprend celles des commandes
+    if (taille != 0)
+        taille += CommandInternal::getMemoryFootprint() - sizeof(CommandInternal);
+    return taille;
+}
+/*----------------------------------------------------------------------------*/
+bool CommandComposite::releaseUndoData ( )
+{
+    bool libere = false;
+    for (std::vector<CommandInternal*>::iterator iter = m_commands.begin();
+            iter != m_commands.end(); ++iter)
+        if ((*iter)->releaseUndoData())
+            libere = true;
+
+    // l'InfoCommand de la composition référence les entités détruites
+    if (libere)
+        releaseInternalUndoData();
+    return libere;
+}
+/*----------------------------------------------------------------------------*/
 } // end namespace Internal
 /*----------------------------------------------------------------------------*/
 } // end namespace Mgx3D
@@ -10,6 +10,7 @@
 #include "Internal/ContextIfc.h"
 #include "Utils/Common.h"
 #include "Internal/CommandInternal.h"
+#include "Mesh/MeshEntity.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/InformationLog.h>
 #include <TkUtil/TraceLog.h>
@@ -116,6 +117,8 @@ Utils::CommandIfc::status CommandInternal::execute()
         internalExecute();
 
         if (Command::CANCELED != getStatus ( )){
+            meshEntitiesModified();
+
             // met à jour l'état de la visibilité des entités
             if (getContext().isGraphical())
                 getContext().getLocalGroupManager().updateDisplayProperties(&getInfoCommand());
@@ -245,6 +248,8 @@ Utils::Command::status CommandInternal::undo ( )
     // ce qui est propre à la commande
     internalUndo();
 
+    meshEntitiesModified();
+
     // met à jour l'état de la visibilité des entités
     if (getContext().isGraphical())
         getContext().getLocalGroupManager().updateDisplayProperties(&getInfoCommand());
@@ -276,6 +281,7 @@ Utils::Command::status CommandInternal::redo ( )
     internalRedo();
 
     if (Command::CANCELED != getStatus ( )){
+        meshEntitiesModified();
 
         // met à jour l'état de la visibilité des entités
         if (getContext().isGraphical())
@@ -291,6 +297,36 @@ Utils::Command::status CommandInternal::redo ( )
     return getStatus ( );
 } // Command::redo
 
+/*----------------------------------------------------------------------------*/
+size_t CommandInternal::getMemoryFootprint ( ) const
+{
+    return sizeof(*this)
+            + getInfoCommand().getMemoryFootprint()
+            + (m_name_manager_before.capacity()+m_name_manager_after.capacity())*sizeof(unsigned long);
+}
+/*----------------------------------------------------------------------------*/
+void CommandInternal::releaseInternalUndoData()
+{
+    // les groupes détruits ne le sont pas ici, une commande ultérieure a pu
+    // les réutiliser (ils restent gérés par le GroupManager)
+    m_info_command.clear();
+
+    // sinon la destruction de la commande remettrait les id comme avant elle
+    std::vector<unsigned long>().swap(m_name_manager_before);
+    std::vector<unsigned long>().swap(m_name_manager_after);
+}
+/*----------------------------------------------------------------------------*/
+void CommandInternal::meshEntitiesModified()
+{
+    InfoCommand& icmd = getInfoCommand();
+    for (uint i=0; i<icmd.getNbMeshInfoEntity(); i++){
+        Mesh::MeshEntity* me = 0;
+        InfoCommand::type t;
+        icmd.getMeshInfoEntity(i, me, t);
+        if (0 != me)
+            me->meshModified();
+    }
+}
 /*----------------------------------------------------------------------------*/
 } // end namespace Internal
 /*----------------------------------------------------------------------------*/
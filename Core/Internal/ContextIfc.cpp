@@ -12,6 +12,8 @@
 #include <iostream>
 /*----------------------------------------------------------------------------*/
 #include "Internal/NameManager.h"
+#include "Utils/CommandManagerIfc.h"
+#include "Utils/UndoRedoManagerIfc.h"
 
 #include <TkUtil/Mutex.h>
 #include <TkUtil/Exception.h>
@@ -82,6 +84,10 @@ void ContextIfc::load (const Preferences::Section& contextSection)
 
 		Preferences::PreferencesHelper::getBoolean (
 				                optimizingSection, memorizeEdgePreMesh);
+
+		Preferences::PreferencesHelper::getUnsignedLong (
+				                optimizingSection, undoMemoryBudget);
+		setUndoMemoryBudget (undoMemoryBudget.getValue ( ));
 	}
 	catch (...)
 	{
@@ -110,8 +116,24 @@ void ContextIfc::saveConfiguration (Preferences::Section& contextSection)
 									scriptingSection, displayScriptOutputs);
 	Preferences::PreferencesHelper::updateBoolean (
 			                        optimizingSection, memorizeEdgePreMesh);
+	Preferences::PreferencesHelper::updateUnsignedLong (
+			                        optimizingSection, undoMemoryBudget);
 }
 
+/*----------------------------------------------------------------------------*/
+void ContextIfc::setUndoMemoryBudget (unsigned long megaBytes)
+{
+	undoMemoryBudget.setValue (megaBytes);
+	try
+	{
+		getCommandManager ( ).getUndoManager ( ).setMemoryBudget (
+										(size_t)megaBytes * 1024 * 1024);
+	}
+	catch (...)
+	{	// pas de gestionnaire de commandes (ou d'annulation) associé
+	}
+}	// ContextIfc::setUndoMemoryBudget
+
 /*----------------------------------------------------------------------------*/
 ContextIfc::ContextIfc(const std::string& name)
 : m_name (name),
@@ -132,7 +154,10 @@ displayScriptOutputs (
 		TkUtil::UTF8String ("true si le programme doit afficher les sorties des commandes script, false dans le cas contraire.", TkUtil::Charset::UTF_8)),
 memorizeEdgePreMesh (
 		TkUtil::UTF8String ("memorizeEdgePreMesh", TkUtil::Charset::UTF_8), true,
-		TkUtil::UTF8String ("true si le programme doit mémoriser le prémaillage des arêtes, false dans le cas contraire.", TkUtil::Charset::UTF_8))
+		TkUtil::UTF8String ("true si le programme doit mémoriser le prémaillage des arêtes, false dans le cas contraire.", TkUtil::Charset::UTF_8)),
+undoMemoryBudget (
+		TkUtil::UTF8String ("undoMemoryBudget", TkUtil::Charset::UTF_8), 0,
+		TkUtil::UTF8String ("Mémoire maximale (en Mo) conservée pour annuler les commandes, 0 pour illimité. Au delà les commandes les plus anciennes ne peuvent plus être annulées.", TkUtil::Charset::UTF_8))
 
 {
 	// Enregistrement auprès de la liste des contextes. On en profite pour
@@ -172,7 +197,10 @@ displayScriptOutputs (
 		TkUtil::UTF8String ("true si le programme doit afficher les sorties des commandes script, false dans le cas contraire.", TkUtil::Charset::UTF_8)),
 memorizeEdgePreMesh (
 		TkUtil::UTF8String ("memorizeEdgePreMesh", TkUtil::Charset::UTF_8), true,
-		TkUtil::UTF8String ("true si le programme doit mémoriser le prémaillage des arêtes, false dans le cas contraire.", TkUtil::Charset::UTF_8))
+		TkUtil::UTF8String ("true si le programme doit mémoriser le prémaillage des arêtes, false dans le cas contraire.", TkUtil::Charset::UTF_8)),
+undoMemoryBudget (
+		TkUtil::UTF8String ("undoMemoryBudget", TkUtil::Charset::UTF_8), 0,
+		TkUtil::UTF8String ("Mémoire maximale (en Mo) conservée pour annuler les commandes, 0 pour illimité. Au delà les commandes les plus anciennes ne peuvent plus être annulées.", TkUtil::Charset::UTF_8))
 {
     MGX_FORBIDDEN ("ContextIfc copy constructor is not allowed.");
 }	// ContextIfc::ContextIfc
@@ -443,6 +443,19 @@ void InfoCommand::clear()
     m_sys_coord_entities_info.clear();
 }
 /*----------------------------------------------------------------------------*/
+size_t InfoCommand::getMemoryFootprint() const
+{
+    // un noeud de std::map : la valeur, 3 pointeurs et la couleur
+    const size_t noeud = 4*sizeof(void*);
+
+    return m_geom_entities_info.capacity()*sizeof(GeomEntityInfo)
+            + m_topo_entities_info.size()*(sizeof(std::pair<Topo::TopoEntity* const, type>)+noeud)
+            + m_mesh_entities_info.capacity()*sizeof(MeshEntityInfo)
+            + m_group_entities_info.size()*(sizeof(std::pair<Group::GroupEntity* const, type>)+noeud)
+            + m_sys_coord_entities_info.capacity()*sizeof(SysCoordEntityInfo)
+            + m_structured_mesh_entities_info.capacity()*sizeof(StructuredMeshEntityInfo);
+}
+/*----------------------------------------------------------------------------*/
 TkUtil::UTF8String & operator << (TkUtil::UTF8String & o, const InfoCommand & ic)
 {
     o<< "InfoCommand GeomEntities: "<<"\n";
@@ -20,11 +20,14 @@ namespace Internal {
 /*----------------------------------------------------------------------------*/
 InternalEntity::InternalEntity(Internal::Context& ctx,
 		Utils::Property* prop,
-		Utils::DisplayProperties* disp)
-: Entity(ctx.newUniqueId(), prop, disp, ctx.getLogStream())
+		Utils::DisplayProperties* disp,
+		bool registered)
+: Entity(registered ? ctx.newUniqueId() : 0, prop, disp, ctx.getLogStream())
 , m_context(ctx)
+, m_registered(registered)
 {
-	m_context.add(getUniqueId(), this);
+	if (m_registered)
+		m_context.add(getUniqueId(), this);
 #ifdef _DEBUG2
 	std::cout<<"Construction de "<<getName()<<", id = "<<getUniqueId()<<std::endl;
 #endif
@@ -36,7 +39,8 @@ InternalEntity::~InternalEntity()
 	std::cout<<"Destruction de "<<getName()<<", id = "<<getUniqueId()<<std::endl;
 #endif
 	try {
-		m_context.remove(getUniqueId());
+		if (m_registered)
+			m_context.remove(getUniqueId());
 	}
 	catch (const TkUtil::Exception& exc) {
 		std::cerr<<exc.getMessage()<<std::endl;
@@ -11,6 +11,7 @@
 #include "Mesh/Cloud.h"
 #include "Mesh/MeshDisplayRepresentation.h"
 #include "Mesh/MeshImplementation.h"
+#include "Mesh/NodeFilter.h"
 #include "Mesh/CommandCreateMesh.h"
 #include "Utils/Common.h"
 #include "Utils/Bounds.h"
@@ -214,29 +215,41 @@ void Cloud::getGMDSNodes(std::vector<gmds::Node >& ANodes) const
     gmds::IGMesh& gmdsMesh = meshImpl->getGMDSMesh();
 
     // ajout d'un filtre pour éviter de mettre 2 fois (ou plus) un même noeud
-    std::map<gmds::TCellID, uint> filtre;
+    size_t nb_nodes = vertices.size();
+    for(unsigned int iCoEdge=0; iCoEdge<coEdges.size(); iCoEdge++)
+        nb_nodes += coEdges[iCoEdge]->nodes().size();
+    NodeSet filtre(gmdsMesh.getMaxLocalID(0)+1, nb_nodes);
 
     for(unsigned int iVertex=0; iVertex<vertices.size(); iVertex++) {
         gmds::TCellID node  = vertices[iVertex]->getNode();
 
-        if (filtre[node] == 0){
+        if (filtre.insert(node))
         	ANodes.push_back(gmdsMesh.get<gmds::Node>(node));
-        	filtre[node] = 1;
-        }
     }
 
     for(unsigned int iCoEdge=0; iCoEdge<coEdges.size(); iCoEdge++) {
-        std::vector<gmds::TCellID> nodes  = coEdges[iCoEdge]->nodes();
+        const std::vector<gmds::TCellID>& nodes  = coEdges[iCoEdge]->nodes();
 
-        for(unsigned int iNode=0; iNode<nodes.size(); iNode++) {
-            if (filtre[nodes[iNode]] == 0){
+        for(unsigned int iNode=0; iNode<nodes.size(); iNode++)
+            if (filtre.insert(nodes[iNode]))
                 ANodes.push_back(gmdsMesh.get<gmds::Node>(nodes[iNode]));
-                filtre[nodes[iNode]] = 1;
-            }
-        }
     }
 }
 /*----------------------------------------------------------------------------*/
+void Cloud::getGMDSNodesView(MeshGroupView<gmds::Node>& view) const
+{
+    std::vector<Topo::CoEdge* > coEdges;
+    getCoEdges(coEdges);
+    std::vector<Topo::Vertex* > vertices;
+    getVertices(vertices);
+
+    for(unsigned int iVertex=0; iVertex<vertices.size(); iVertex++)
+        view.add(vertices[iVertex]->getNode());
+
+    for(unsigned int iCoEdge=0; iCoEdge<coEdges.size(); iCoEdge++)
+        view.add(coEdges[iCoEdge]->nodes());
+}
+/*----------------------------------------------------------------------------*/
 void Cloud::
 saveMeshCloudTopoProperty(Internal::InfoCommand* icmd)
 {
@@ -16,18 +16,22 @@
 #include "Mesh/MeshModificationByPythonFunction.h"
 #include "Mesh/MeshModificationBySepa.h"
 #include "Mesh/MeshModificationByProjectionOnP0.h"
+#include "Mesh/NodeFilter.h"
 
 #include "Smoothing/SurfacicSmoothing.h"
 #include "Smoothing/VolumicSmoothing.h"
 
 #include "Utils/Command.h"
+#include "Utils/ParallelExecution.h"
 #include "Internal/Context.h"
 #include "Internal/InfoCommand.h"
 #include "Group/Group2D.h"
 #include "Group/Group3D.h"
 #include "Topo/TopoHelper.h"
+#include "Topo/Vertex.h"
 #include "Topo/CoEdge.h"
 #include "Topo/CoFace.h"
+#include "Topo/Block.h"
 #include "Topo/CoEdgeMeshingProperty.h"
 #include "Geom/Surface.h"
 #include "Geom/Volume.h"
@@ -98,6 +102,8 @@ EdgePreMesherTask::~EdgePreMesherTask ( )
 /*----------------------------------------------------------------------------*/
 void EdgePreMesherTask::execute ( )
 {
+	// les calculs parallèles imbriqués restent dans ce thread
+	Utils::TacheParallele	tacheParallele;
 	Mesh::CommandCreateMesh*	cmdCreateMesh	=
 					dynamic_cast<Mesh::CommandCreateMesh*>(getCommand ( ));
 	try
@@ -204,6 +210,8 @@ FacePreMesherTask::~FacePreMesherTask ( )
 /*----------------------------------------------------------------------------*/
 void FacePreMesherTask::execute ( )
 {
+	// les calculs parallèles imbriqués restent dans ce thread
+	Utils::TacheParallele	tacheParallele;
 	Mesh::CommandCreateMesh*	cmdCreateMesh	=
 					dynamic_cast<Mesh::CommandCreateMesh*>(getCommand ( ));
 	try
@@ -440,6 +448,83 @@ void CommandCreateMesh::permInternalsStats()
     PERM_PROPERTY (CloudPropertyInfo,       m_cloud_property_info);
 
 #undef PERM_PROPERTY
+
+	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+    message << "Mémoire pour l'annulation de la commande "<<getScriptComments()
+            <<", entités de maillage créées: "
+            <<(long)m_created_nodes.size()<<" noeuds, "
+            <<(long)m_created_edges.size()<<" bras, "
+            <<(long)m_created_faces.size()<<" polygones, "
+            <<(long)m_created_regions.size()<<" polyèdres, en "
+            <<(long)(m_created_nodes.intervals().size()+m_created_edges.intervals().size()
+                    +m_created_faces.intervals().size()+m_created_regions.intervals().size())
+            <<" intervalles, soit "<<(long)getCreatedMeshMemorySize()<<" octets";
+    getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+}
+/*----------------------------------------------------------------------------*/
+size_t CommandCreateMesh::getCreatedMeshMemorySize() const
+{
+    return m_created_nodes.getMemorySize() + m_created_edges.getMemorySize()
+            + m_created_faces.getMemorySize() + m_created_regions.getMemorySize();
+}
+/*----------------------------------------------------------------------------*/
+size_t CommandCreateMesh::getMemoryFootprint ( ) const
+{
+    size_t taille = Internal::CommandInternal::getMemoryFootprint()
+            + getCreatedMeshMemorySize();
+
+#define PROPERTY_SIZE(T,P,L) \
+    taille += L.capacity()*sizeof(T) + L.size()*sizeof(P);
+
+    PROPERTY_SIZE (VertexPropertyInfo,        Topo::VertexMeshingData,       m_vertex_property_info);
+    PROPERTY_SIZE (CoEdgePropertyInfo,        Topo::CoEdgeMeshingData,       m_coedge_property_info);
+    PROPERTY_SIZE (CoFacePropertyInfo,        Topo::CoFaceMeshingData,       m_coface_property_info);
+    PROPERTY_SIZE (CoFaceMeshingPropertyInfo, Topo::CoFaceMeshingProperty,   m_coface_mesh_property_info);
+    PROPERTY_SIZE (BlockPropertyInfo,         Topo::BlockMeshingData,        m_block_property_info);
+    PROPERTY_SIZE (BlockMeshingPropertyInfo,  Topo::BlockMeshingProperty,    m_block_mesh_property_info);
+    PROPERTY_SIZE (VolumePropertyInfo,        Topo::MeshVolumeTopoProperty,  m_volume_property_info);
+    PROPERTY_SIZE (SurfacePropertyInfo,       Topo::MeshSurfaceTopoProperty, m_surface_property_info);
+    PROPERTY_SIZE (LinePropertyInfo,          Topo::MeshLineTopoProperty,    m_line_property_info);
+    PROPERTY_SIZE (CloudPropertyInfo,         Topo::MeshCloudTopoProperty,   m_cloud_property_info);
+
+#undef PROPERTY_SIZE
+
+    return taille;
+}
+/*----------------------------------------------------------------------------*/
+bool CommandCreateMesh::releaseUndoData ( )
+{
+    TkUtil::AutoReferencedMutex autoMutex (getMutex ( ));
+
+    if (Command::DONE != getStatus ( ))
+        return false;
+
+    deleteInternalsStats();
+
+    // les intervalles ne servent qu'à détruire le maillage lors d'un undo
+    m_created_nodes.clear();
+    m_created_edges.clear();
+    m_created_faces.clear();
+    m_created_regions.clear();
+
+    // les groupes créés restent au MeshManager, la destruction de la
+    // commande ne doit plus les détruire
+    m_created_clouds.clear();
+    m_created_lines.clear();
+    m_created_surfaces.clear();
+    m_created_volumes.clear();
+
+    releaseInternalUndoData();
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+size_t CommandCreateMesh::getReleasableMemory ( ) const
+{
+    if (Command::DONE != getStatus ( ))
+        return 0;
+
+    // tout sauf la commande elle-même
+    return getMemoryFootprint() - sizeof(Internal::CommandInternal);
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateMesh::mesh(std::vector<Topo::Block* >& blocs)
@@ -460,6 +545,9 @@ void CommandCreateMesh::preMesh(const std::vector<Topo::Block*>& blocks)
 #ifdef _DEBUG_THREAD
 		std::cout << "CommandCreateMesh::preMesh. Lancement du pré-maillage des blocs dans des threads. NB_BLOCKS=" << blocks.size ( ) << std::endl;
 #endif
+		// les gros blocs sont prémaillés hors des tâches, leur remplissage
+		// transfini se répartit alors lui-même sur les threads disponibles
+		std::vector<Topo::Block*>	gros_blocs;
 		clearTasks ( );
 		for (std::vector<Topo::Block*>::const_iterator it = blocks.begin ( );
 		     blocks.end ( ) != it; it++)
@@ -468,6 +556,12 @@ void CommandCreateMesh::preMesh(const std::vector<Topo::Block*>& blocks)
 				break;
 			if ((*it)->getMeshLaw ( ) <= Topo::BlockMeshingProperty::transfinite)
 			{
+				if ((*it)->isStructured ( ) && (*it)->getNbInternalMeshingNodes ( )
+						>= MeshImplementation::NB_NOEUDS_MIN_TRANSFINI_PARALLELE)
+				{
+					gros_blocs.push_back (*it);
+					continue;
+				}
 				BlockPreMesherTask*	task	= new BlockPreMesherTask(this, *it);
 				addTask (task);
 			}	// if ((*it)->getMeshLaw ( ) <= Topo::BlockMeshingProperty::transfinite)
@@ -476,6 +570,14 @@ void CommandCreateMesh::preMesh(const std::vector<Topo::Block*>& blocks)
 		waitTasksExecution ( );
 		evaluateTasksCompletion ( );
 		clearTasks ( );
+
+		for (std::vector<Topo::Block*>::const_iterator it = gros_blocs.begin ( );
+		     gros_blocs.end ( ) != it; it++)
+		{
+			if (Command::CANCELED == getStatus ( ))
+				break;
+			preMesh (*it);
+		}
 #ifdef _DEBUG_THREAD
 		std::cout << "CommandCreateMesh::preMesh. Achèvement avec succès du pré-maillage des blocs dans des threads." << std::endl;
 #endif
@@ -600,29 +702,35 @@ void CommandCreateMesh::preMesh(const std::vector<Topo::CoEdge*>& aretes)
 #ifdef _DEBUG_THREAD
 		std::cout << "CommandCreateMesh::preMesh. Lancement du pré-maillage des arêtes dans des threads. NB_EDGE=" << aretes.size ( ) << std::endl;
 #endif
-		clearTasks ( );
+		// [EB] les projections OCC se font avec un projecteur par thread
+		// et les courbes temporaires pour les projections sur les surfaces ne passent
+		// plus par le NameManager. Seul le cas OCAF nécessite encore de sérialiser
+		// ces arêtes (les labels OCAF sont partagés).
+		bool serializeSurfaceProj = (getContext().getGeomKernel() == Internal::ContextIfc::WITHOCAF);
+
+		// les arêtes interpolées sont traitées par vagues successives,
+		// une fois que les arêtes dont elles dépendent sont prémaillées
+		std::vector<Topo::CoEdge*> vague;
+		std::vector<Topo::CoEdge*> enAttente;
 		for (std::vector<Topo::CoEdge*>::const_iterator it = aretes.begin ( );
 				aretes.end ( ) != it; it++)
-		{
-			if (Command::CANCELED == getStatus ( ))
-				break;
-			Geom::GeomEntity* ge = (*it)->getGeomAssociation();
-			bool treadSafe = true;
-//			// [EB] pas de multi-threading pour les constructions des points des arêtes
-//			//      qui font appel à la construction d'une courbe temporaire via OCC.
-//			//      Création d'entité qui ne peut être faite dans des threads concurrents
-//			if (ge && ge->getType() == Utils::Entity::GeomSurface)
-//				treadSafe = false;
-			// [EB] pas de multi-threading pour les constructions des points des arêtes
-			// pour les arêtes interpolées
 			if ((*it)->getMeshingProperty()->getMeshLaw() == Topo::CoEdgeMeshingProperty::interpolate
 					|| (*it)->getMeshingProperty()->getMeshLaw() == Topo::CoEdgeMeshingProperty::globalinterpolate)
-				treadSafe = false;
-			if (treadSafe){
+				enAttente.push_back(*it);
+			else
+				vague.push_back(*it);
+
+		while (!vague.empty() && Command::CANCELED != getStatus ( )){
+			clearTasks ( );
+			for (std::vector<Topo::CoEdge*>::const_iterator it = vague.begin ( );
+					vague.end ( ) != it; it++)
+			{
+				if (Command::CANCELED == getStatus ( ))
+					break;
+				Geom::GeomEntity* ge = (*it)->getGeomAssociation();
 				nbFaits += 1.0;
 				EdgePreMesherTask*	task	= new EdgePreMesherTask (this, *it);
-				// une seule tache à fois qui utilise les projection de segment sur surface OCC
-				if (ge && ge->getType() == Utils::Entity::GeomSurface)
+				if (serializeSurfaceProj && ge && ge->getType() == Utils::Entity::GeomSurface)
 					task->setConcurrencyFlag(1);
 				else
 					nbMTThreads+=1;
@@ -630,12 +738,34 @@ void CommandCreateMesh::preMesh(const std::vector<Topo::CoEdge*>& aretes)
 #ifdef _DEBUG_THREAD
 				std::cout << " addTask pour "<<(*it)->getName()<<std::endl;
 #endif
+			}	// for (std::vector<Topo::CoEdge*>::const_iterator it = vague.begin ( );
+
+			waitTasksExecution ( );
+			evaluateTasksCompletion ( );
+			clearTasks ( );
+
+			// vague suivante : les arêtes interpolées dont toutes les références sont prémaillées
+			std::vector<Topo::CoEdge*> resteEnAttente;
+			vague.clear();
+			for (std::vector<Topo::CoEdge*>::const_iterator it = enAttente.begin ( );
+					enAttente.end ( ) != it; it++)
+			{
+				std::vector<Topo::CoEdge*> refs;
+				(*it)->getInterpolationReferences(refs);
+				bool pret = true;
+				for (uint i=0; i<refs.size() && pret; i++)
+					if (!refs[i]->isPreMeshed() && !refs[i]->isMeshed())
+						pret = false;
+				if (pret)
+					vague.push_back(*it);
+				else
+					resteEnAttente.push_back(*it);
 			}
-		}	// for (std::vector<Topo::CoEdge*>::const_iterator it = aretes.begin ( );
+			enAttente = resteEnAttente;
+		} // while (!vague.empty())
 
-		waitTasksExecution ( );
-		evaluateTasksCompletion ( );
-		clearTasks ( );
+		// les éventuelles arêtes restantes (références circulaires) sont traitées
+		// en séquentiel, ce qui permet de remonter l'erreur adéquate
 
 #ifdef _DEBUG_THREAD
 		std::cout << "CommandCreateMesh::preMesh. Achèvement avec succès du pré-maillage des arêtes dans des threads." << std::endl;
@@ -680,25 +810,37 @@ void CommandCreateMesh::mesh(Topo::Vertex* sommet)
 void CommandCreateMesh::addCreatedNode(gmds::TCellID id)
 {
     if (m_strategy == MeshManager::MODIFIABLE)
-        m_created_nodes.push_back(id);
+        m_created_nodes.add(id);
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateMesh::addCreatedEdge(gmds::TCellID id)
 {
     if (m_strategy == MeshManager::MODIFIABLE)
-        m_created_edges.push_back(id);
+        m_created_edges.add(id);
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateMesh::addCreatedFace(gmds::TCellID id)
 {
     if (m_strategy == MeshManager::MODIFIABLE)
-        m_created_faces.push_back(id);
+        m_created_faces.add(id);
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateMesh::addCreatedRegion(gmds::TCellID id)
 {
     if (m_strategy == MeshManager::MODIFIABLE)
-        m_created_regions.push_back(id);
+        m_created_regions.add(id);
+}
+/*----------------------------------------------------------------------------*/
+void CommandCreateMesh::addCreatedNodes(const std::vector<gmds::TCellID>& ids, size_t first)
+{
+    if (m_strategy == MeshManager::MODIFIABLE)
+        m_created_nodes.add(ids, first);
+}
+/*----------------------------------------------------------------------------*/
+void CommandCreateMesh::addCreatedRegions(const std::vector<gmds::TCellID>& ids, size_t first)
+{
+    if (m_strategy == MeshManager::MODIFIABLE)
+        m_created_regions.add(ids, first);
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateMesh::addNewCloud(const std::string& name)
@@ -992,6 +1134,75 @@ deleteCreatedMeshGroups()
     }
 }
 /*----------------------------------------------------------------------------*/
+/// données pour le lissage d'une des surfaces d'un groupe
+struct LissageSurface {
+	Geom::Surface* surface;
+	std::vector<gmds::Face> polygones;
+	std::vector<gmds::Node> nodes;
+	/// marque par polygone (indicée comme polygones)
+	std::vector<bool> isPolyInverted;
+	/// noeuds au bord de la surface de maillage, figés
+	std::vector<gmds::TCellID> fixes;
+};
+/*----------------------------------------------------------------------------*/
+/// données pour le lissage d'un des volumes d'un groupe
+struct LissageVolume {
+	Geom::Volume* volume;
+	std::vector<gmds::Region> polyedres;
+	std::vector<gmds::Node> nodes;
+	/// noeuds au bord du volume de maillage, figés
+	std::vector<gmds::TCellID> fixes;
+};
+/*----------------------------------------------------------------------------*/
+/** remplit le filtre pour le lissage: 1 pour les noeuds, 2 pour ceux figés
+ */
+template<typename TLissage>
+static void remplirFiltre(NodeFilter& filtre, const TLissage& lissage)
+{
+	for (uint i=0; i<lissage.nodes.size(); i++)
+		filtre.setIfUnmarked(lissage.nodes[i].getID(), 1);
+	for (uint i=0; i<lissage.fixes.size(); i++)
+		filtre.set(lissage.fixes[i], 2);
+}
+/*----------------------------------------------------------------------------*/
+/** vrai si aucun noeud déplaçable d'un des lissages (non figé pour
+ *  celui-ci) n'est présent dans un autre des lissages.
+ *  Les lissages peuvent alors être faits en même temps avec un filtre commun
+ *  (cf remplirFiltre), un noeud figé pour l'un n'étant déplaçable pour aucun
+ */
+template<typename TLissage>
+static bool sontIndependants(const std::vector<TLissage>& lissages, size_t maxId)
+{
+	if (lissages.size() < 2)
+		return false;
+
+	// indice+1 du lissage contenant le noeud, partage pour plusieurs
+	const uint partage = (uint)-1;
+	NodeFilter proprietaire(maxId);
+	for (uint j=0; j<lissages.size(); j++){
+		const std::vector<gmds::Node>& nds = lissages[j].nodes;
+		for (uint i=0; i<nds.size(); i++){
+			gmds::TCellID id = nds[i].getID();
+			if (!proprietaire.setIfUnmarked(id, j+1) && proprietaire.get(id) != j+1)
+				proprietaire.set(id, partage);
+		}
+	}
+
+	NodeFilter fixe(maxId);
+	for (uint j=0; j<lissages.size(); j++){
+		fixe.reset();
+		for (uint i=0; i<lissages[j].fixes.size(); i++)
+			fixe.set(lissages[j].fixes[i], 1);
+		const std::vector<gmds::Node>& nds = lissages[j].nodes;
+		for (uint i=0; i<nds.size(); i++){
+			gmds::TCellID id = nds[i].getID();
+			if (!fixe.isMarked(id) && proprietaire.get(id) == partage)
+				return false;
+		}
+	}
+	return true;
+}
+/*----------------------------------------------------------------------------*/
 void CommandCreateMesh::
 meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 {
@@ -1005,11 +1216,6 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 	// filtre pour identifier les cofaces à mailler (marque à 1)
 	std::map<Topo::CoFace*, uint> filtre_cofaces;
 
-	// filtre sur les noeuds gmds pour les perturbations:
-	// 0 pour les nouveaux,
-	// 1 pour les anciens (ceux créés avant cette commande)
-	std::map<gmds::TCellID, uint> filtre_nodes_pert;
-
 	for (std::list<Topo::CoFace*>::iterator iter1 = list_cofaces.begin();
 			iter1 != list_cofaces.end(); ++iter1){
 		Topo::CoFace* coface = *iter1;
@@ -1046,8 +1252,11 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 #endif
 
 	gmds::IGMesh& gmds_mesh = getMeshManager().getMesh()->getGMDSMesh();
-	// les noeuds déjà dans gmds
-	std::vector<gmds::Node> nodes;
+
+	// filtre sur les noeuds gmds pour les perturbations:
+	// 0 pour les nouveaux,
+	// 1 pour les anciens (ceux créés avant cette commande)
+	NodeFilter filtre_nodes_pert(gmds_mesh.getMaxLocalID(0)+1);
 
 	// on marque les noeuds déjà présents
 	//std::cout<<"Nb Nodes : "<<gmds_mesh.getNbNodes()<<std::endl;
@@ -1055,7 +1264,7 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 
 	for (;!iter1.isDone();iter1.next()){
 		//std::cout<<"Node "<<iter1.value().getID()<<" fixé "<<std::endl;
-		filtre_nodes_pert[iter1.value().getID()] = 1;
+		filtre_nodes_pert.set(iter1.value().getID(), 1);
 	}
 
 	// application de la modif pour chacun des groupes 2D
@@ -1176,18 +1385,21 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 			}
 			else if (lissageSurf){
 
+				// filtre pour ne pas référencer plusieurs fois un noeud dans une surface
+				NodeFilter filtre_nodes_vus(gmds_mesh.getMaxLocalID(0)+1);
 
 				// le lissage dépend de la surface sur laquelle se fait la projection
-				for (std::vector<Geom::Surface*>::iterator iter2 = surfaces.begin();
-						iter2 != surfaces.end(); ++iter2){
-					Geom::Surface* surface = *iter2;
+				std::vector<LissageSurface> lissages(surfaces.size());
+				for (uint j=0; j<surfaces.size(); j++){
+					Geom::Surface* surface = surfaces[j];
+					LissageSurface& lissage = lissages[j];
+					lissage.surface = surface;
 					std::vector<Topo::CoFace*> cofaces;
 					surface->get(cofaces);
 
 					// marque par coface pour savoir si elle est dans le même sens (normale) que les autres
 					std::map<Topo::CoFace*, bool> isCoFaceInverted;
 					Topo::TopoHelper::computeInvertedDir(cofaces, isCoFaceInverted);
-					std::map<gmds::TCellID, bool> isPolyInverted;
 
 					// ensemble des cofaces d'une surface du groupe qui sont maillées à la fin
 					std::vector<Topo::CoFace*> meshed_cofaces;
@@ -1199,15 +1411,7 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 							meshed_cofaces.push_back(coface);
 					} // end for iter3
 
-					// la liste des polygones dans ces cofaces
-					std::vector<gmds::Face> polygones;
-					// la liste des noeuds dans ces cofaces
-					std::vector<gmds::Node> nodes;
-
-					// filtre sur les noeuds gmds pour les lissages:
-					// 1 pour les nouveaux,
-					// 2 pour les noeuds au bord d'une surface de maillage
-					std::map<gmds::TCellID, uint> filtre_nodes_lisse;
+					filtre_nodes_vus.reset();
 
 					for (std::vector<Topo::CoFace*>::iterator iter3 = meshed_cofaces.begin();
 							iter3 != meshed_cofaces.end(); ++iter3){
@@ -1217,50 +1421,78 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 						std::vector<gmds::TCellID>& l_poly = coface->faces();
 
                         for(unsigned int i_poly=0;i_poly<l_poly.size();i_poly++){
-                            polygones.push_back(gmds_mesh.get<gmds::Face>(l_poly[i_poly]));
-                            isPolyInverted[l_poly[i_poly]] = isInverted;
+                            lissage.polygones.push_back(gmds_mesh.get<gmds::Face>(l_poly[i_poly]));
+                            lissage.isPolyInverted.push_back(isInverted);
                         }
 
 						for (std::vector<gmds::TCellID>::iterator iter4 = l_nds.begin();
 								iter4 != l_nds.end(); ++iter4)
-							if (filtre_nodes_lisse[*iter4] == 0){
-								filtre_nodes_lisse[*iter4] = 1;
-								nodes.push_back(gmds_mesh.get<gmds::Node>(*iter4));
-						}
+							if (filtre_nodes_vus.setIfUnmarked(*iter4, 1))
+								lissage.nodes.push_back(gmds_mesh.get<gmds::Node>(*iter4));
 					}
 
 
 					std::vector<Topo::CoEdge*> border_meshed_coedges;
 					border_meshed_coedges = Topo::TopoHelper::getBorder(meshed_cofaces);
 
-					// on marque les noeuds des arêtes au bord à 2 pour ne pas les déplacer
+					// on mémorise les noeuds des arêtes au bord pour ne pas les déplacer
 					for (std::vector<Topo::CoEdge*>::iterator iter3 = border_meshed_coedges.begin();
 							iter3 != border_meshed_coedges.end(); ++iter3){
 						std::vector<gmds::TCellID>& nodes = (*iter3)->nodes();
-						for (std::vector<gmds::TCellID>::iterator iter4 = nodes.begin();
-								iter4 != nodes.end(); ++iter4)
-							filtre_nodes_lisse[*iter4] = 2;
+						lissage.fixes.insert(lissage.fixes.end(), nodes.begin(), nodes.end());
 					} // end for iter3
+				} // end for j
+
+				// filtre sur les noeuds gmds pour les lissages:
+				// 1 pour les nouveaux,
+				// 2 pour les noeuds au bord d'une surface de maillage
+				// (remis à zéro pour chaque surface)
+				NodeFilter filtre_nodes_lisse(gmds_mesh.getMaxLocalID(0)+1);
+
+				// les lissages (et les projections) ne se font en parallèle que si les
+				// threads sont autorisés et hors OCAF (projections non réentrantes)
+				bool parallele = (true == threadingEnabled ( ))
+						&& getContext().getGeomKernel() != Internal::ContextIfc::WITHOCAF;
+
+				// les surfaces sont lissées en même temps si aucune ne déplace des noeuds
+				// d'une autre et si le lisseur est réentrant
+				bool enParallele = parallele
+						&& lissageSurf->getNbIterations() != 0
+						&& lissageSurf->isReentrant()
+						&& sontIndependants(lissages, gmds_mesh.getMaxLocalID(0)+1);
+
+				// applique le lissage uniquement aux noeuds internes aux surfaces (non marqués à 2)
+				auto lisse = [&](uint j){
+					lissageSurf->applyModification(lissages[j].nodes, lissages[j].polygones,
+							filtre_nodes_lisse, lissages[j].isPolyInverted, 2, lissages[j].surface,
+							parallele);
+				};
+				if (enParallele){
+					// filtre commun, valable pour chaque surface vu leur indépendance
+					for (uint j=0; j<lissages.size(); j++)
+						remplirFiltre(filtre_nodes_lisse, lissages[j]);
+					Utils::executeEnParallele(lissages.size(), lisse);
+				}
+				else
+					for (uint j=0; j<lissages.size(); j++){
+						filtre_nodes_lisse.reset();
+						remplirFiltre(filtre_nodes_lisse, lissages[j]);
 #ifdef _DEBUG2
-					{
-						// stats sur le nombre de noeuds à 1 et ceux à 2
-						uint mq1 = 0;
-						uint mq2 = 0;
-						for (std::map<gmds::TCellID, uint>::iterator iter=filtre_nodes_lisse.begin();
-								iter!=filtre_nodes_lisse.end(); ++iter)
-							if (iter->second == 1)
-								mq1++;
-							else if (iter->second == 2)
-								mq2++;
-						std::cout<<"CommandCreateMesh::meshAndModify, filtre_nodes_lisse avec "<<mq1<<" noeuds à bouger et "<<mq2<<" figés"<<std::endl;
-
-					}
+						{
+							// stats sur le nombre de noeuds à 1 et ceux à 2
+							uint mq1 = 0;
+							uint mq2 = 0;
+							const std::vector<gmds::TCellID>& marked = filtre_nodes_lisse.marked();
+							for (uint i=0; i<marked.size(); i++)
+								if (filtre_nodes_lisse.get(marked[i]) == 1)
+									mq1++;
+								else if (filtre_nodes_lisse.get(marked[i]) == 2)
+									mq2++;
+							std::cout<<"CommandCreateMesh::meshAndModify, filtre_nodes_lisse avec "<<mq1<<" noeuds à bouger et "<<mq2<<" figés"<<std::endl;
+						}
 #endif
-					// applique le lissage uniquement aux noeuds internes à la surface (non marqués à 2)
-					lissageSurf->applyModification(nodes, polygones, filtre_nodes_lisse, isPolyInverted, 2, surface);
-
-				} // end for iter2
-
+						lisse(j);
+					}
 
 			}
 			else
@@ -1360,10 +1592,15 @@ modify(std::vector<Topo::Block*>& list_blocks)
 
 			if (lissageVol){
 
+				// filtre pour ne pas référencer plusieurs fois un noeud dans un volume
+				NodeFilter filtre_nodes_vus(gmds_mesh.getMaxLocalID(0)+1);
+
 				// le lissage dépend du volume sur lequel se fait la projection
-				for (std::vector<Geom::Volume*>::iterator iter2 = volumes.begin();
-						iter2 != volumes.end(); ++iter2){
-					Geom::Volume* volume = *iter2;
+				std::vector<LissageVolume> lissages(volumes.size());
+				for (uint j=0; j<volumes.size(); j++){
+					Geom::Volume* volume = volumes[j];
+					LissageVolume& lissage = lissages[j];
+					lissage.volume = volume;
 					std::vector<Topo::Block*> blocks;
 					volume->get(blocks);
 
@@ -1377,15 +1614,7 @@ modify(std::vector<Topo::Block*>& list_blocks)
 							meshed_blocks.push_back(block);
 					} // end for iter3
 
-					// la liste des polygedres dans ces blocs
-					std::vector<gmds::Region> polygedres;
-					// la liste des noeuds dans ces blocs
-					std::vector<gmds::Node> nodes;
-
-					// filtre sur les noeuds gmds pour les lissages:
-					// 1 pour les nouveaux,
-					// 2 pour les noeuds au bord d'un volume de maillage
-					std::map<gmds::TCellID, uint> filtre_nodes_lisse;
+					filtre_nodes_vus.reset();
 
 					for (std::vector<Topo::Block*>::iterator iter3 = meshed_blocks.begin();
 							iter3 != meshed_blocks.end(); ++iter3){
@@ -1394,35 +1623,60 @@ modify(std::vector<Topo::Block*>& list_blocks)
 						std::vector<gmds::TCellID>& l_poly = block->regions();
 
 						for(unsigned int i_poly=0;i_poly<l_poly.size();i_poly++){
-						    polygedres.push_back(gmds_mesh.get<gmds::Region>(l_poly[i_poly]));
+						    lissage.polyedres.push_back(gmds_mesh.get<gmds::Region>(l_poly[i_poly]));
 						}
 
 
 						for (std::vector<gmds::TCellID>::iterator iter4 = l_nds.begin();
 								iter4 != l_nds.end(); ++iter4)
-							if (filtre_nodes_lisse[*iter4] == 0){
-								filtre_nodes_lisse[*iter4] = 1;
-								nodes.push_back(gmds_mesh.get<gmds::Node>(*iter4));
-						}
+							if (filtre_nodes_vus.setIfUnmarked(*iter4, 1))
+								lissage.nodes.push_back(gmds_mesh.get<gmds::Node>(*iter4));
 					}
 
 
 					std::vector<Topo::CoFace*> border_meshed_cofaces;
 					border_meshed_cofaces = Topo::TopoHelper::getBorder(meshed_blocks);
 
-					// on marque les noeuds des arêtes au bord à 2 pour ne pas les déplacer
+					// on mémorise les noeuds des faces au bord pour ne pas les déplacer
 					for (std::vector<Topo::CoFace*>::iterator iter3 = border_meshed_cofaces.begin();
 							iter3 != border_meshed_cofaces.end(); ++iter3){
 						std::vector<gmds::TCellID>& nodes = (*iter3)->nodes();
-						for (std::vector<gmds::TCellID>::iterator iter4 = nodes.begin();
-								iter4 != nodes.end(); ++iter4)
-							filtre_nodes_lisse[*iter4] = 2;
+						lissage.fixes.insert(lissage.fixes.end(), nodes.begin(), nodes.end());
 					} // end for iter3
-
-					// applique le lissage uniquement aux noeuds internes au volume (non marqués à 2)
-					lissageVol->applyModification(nodes, polygedres, filtre_nodes_lisse, 2, volume);
-
-				} // end for iter2
+				} // end for j
+
+				// filtre sur les noeuds gmds pour les lissages:
+				// 1 pour les nouveaux,
+				// 2 pour les noeuds au bord d'un volume de maillage
+				// (remis à zéro pour chaque volume)
+				NodeFilter filtre_nodes_lisse(gmds_mesh.getMaxLocalID(0)+1);
+
+				// les lissages ne se font en parallèle que si les threads sont autorisés
+				bool parallele = (true == threadingEnabled ( ));
+
+				// les volumes sont lissés en même temps si aucun ne déplace des noeuds d'un autre
+				// et si le lisseur est réentrant (NativeSmoothing)
+				bool enParallele = parallele
+						&& lissageVol->isReentrant()
+						&& sontIndependants(lissages, gmds_mesh.getMaxLocalID(0)+1);
+
+				// applique le lissage uniquement aux noeuds internes aux volumes (non marqués à 2)
+				auto lisse = [&](uint j){
+					lissageVol->applyModification(lissages[j].nodes, lissages[j].polyedres,
+							filtre_nodes_lisse, 2, lissages[j].volume, parallele);
+				};
+				if (enParallele){
+					// filtre commun, valable pour chaque volume vu leur indépendance
+					for (uint j=0; j<lissages.size(); j++)
+						remplirFiltre(filtre_nodes_lisse, lissages[j]);
+					Utils::executeEnParallele(lissages.size(), lisse);
+				}
+				else
+					for (uint j=0; j<lissages.size(); j++){
+						filtre_nodes_lisse.reset();
+						remplirFiltre(filtre_nodes_lisse, lissages[j]);
+						lisse(j);
+					}
 
 			}
 			else if (pert){
@@ -1430,7 +1684,7 @@ modify(std::vector<Topo::Block*>& list_blocks)
 				// filtre sur les noeuds gmds pour les perturbations:
 				// 0 pour les nouveaux,
 				// 1 pour les anciens (ceux créés avant cette commande)
-				std::map<gmds::TCellID, uint> filtre_nodes_pert;
+				NodeFilter filtre_nodes_pert;
 				// actuellement on bouge tous les noeuds ...
 
 				// récupération des noeuds associés à ce groupe
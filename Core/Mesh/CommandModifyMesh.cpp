@@ -11,6 +11,12 @@
 #include "Mesh/CommandModifyMesh.h"
 #include "Mesh/MeshItf.h"
 #include "Mesh/MeshManager.h"
+#include "Mesh/NodeFilter.h"
+#include "Mesh/Volume.h"
+#include "Mesh/Surface.h"
+#include "Mesh/Line.h"
+#include "Mesh/Cloud.h"
+#include "Topo/Block.h"
 
 /// TkUtil
 #include <TkUtil/Exception.h>
@@ -20,6 +26,8 @@
 #include "Utils/Command.h"
 #include "Internal/Context.h"
 #include "Internal/InfoCommand.h"
+
+#include <GMDS/IG/IGMesh.h>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -40,19 +48,122 @@ CommandModifyMesh::~CommandModifyMesh()
 void CommandModifyMesh::
 internalExecute()
 {
+	gmds::IGMesh& gmds_mesh = getContext().getLocalMeshManager().getMesh()->getGMDSMesh();
+
+	// sauvegarde des positions des noeuds des blocs maillés (seuls concernés par le lissage)
+	std::vector<Topo::Block*> blocks;
+	getContext().getLocalTopoManager().getBlocks(blocks);
+	NodeFilter filtre_nodes(gmds_mesh.getMaxLocalID(0)+1);
+	std::vector<gmds::TCellID> nodes;
+	for (uint i=0; i<blocks.size(); i++)
+		if (blocks[i]->isMeshed()){
+			std::vector<gmds::TCellID>& l_nds = blocks[i]->nodes();
+			for (uint j=0; j<l_nds.size(); j++)
+				if (filtre_nodes.setIfUnmarked(l_nds[j], 1))
+					nodes.push_back(l_nds[j]);
+		}
+	std::vector<double> coords_before;
+	_getCoords(nodes, coords_before);
+
 	getContext().getLocalMeshManager().getMesh()->smooth();
+
+	std::vector<double> coords_after;
+	_getCoords(nodes, coords_after);
+
+	// on ne conserve que les noeuds déplacés
+	m_nodes.clear();
+	m_coords_before.clear();
+	m_coords_after.clear();
+	filtre_nodes.reset();
+	for (uint i=0; i<nodes.size(); i++)
+		if (coords_before[3*i] != coords_after[3*i]
+		 || coords_before[3*i+1] != coords_after[3*i+1]
+		 || coords_before[3*i+2] != coords_after[3*i+2]){
+			m_nodes.push_back(nodes[i]);
+			filtre_nodes.set(nodes[i], 1);
+			for (uint k=0; k<3; k++){
+				m_coords_before.push_back(coords_before[3*i+k]);
+				m_coords_after.push_back(coords_after[3*i+k]);
+			}
+		}
+
+	// les groupes de mailles contenant un noeud déplacé sont à réafficher
+	std::vector<Mesh::MeshEntity*> me;
+	std::vector<Mesh::Volume*> mvol;
+	getContext().getLocalMeshManager().getVolumes(mvol);
+	for (uint i=0; i<mvol.size(); i++)
+		me.push_back(mvol[i]);
+	std::vector<Mesh::Surface*> msurf;
+	getContext().getLocalMeshManager().getSurfaces(msurf);
+	for (uint i=0; i<msurf.size(); i++)
+		me.push_back(msurf[i]);
+	std::vector<Mesh::Line*> mline;
+	getContext().getLocalMeshManager().getLines(mline);
+	for (uint i=0; i<mline.size(); i++)
+		me.push_back(mline[i]);
+	std::vector<Mesh::Cloud*> mcloud;
+	getContext().getLocalMeshManager().getClouds(mcloud);
+	for (uint i=0; i<mcloud.size(); i++)
+		me.push_back(mcloud[i]);
+
+	if (!m_nodes.empty())
+		for (uint i=0; i<me.size(); i++){
+			std::vector<gmds::Node> grp_nodes;
+			_getGMDSNodes(me[i], grp_nodes);
+			for (uint j=0; j<grp_nodes.size(); j++)
+				if (filtre_nodes.isMarked(grp_nodes[j].getID())){
+					getInfoCommand().addMeshInfoEntity(me[i], Internal::InfoCommand::DISPMODIFIED);
+					break;
+				}
+		}
 }
 /*----------------------------------------------------------------------------*/
 void CommandModifyMesh::
 internalUndo()
 {
-	throw TkUtil::Exception (TkUtil::UTF8String ("CommandModifyMesh::internalUndo pas encore implémenté.", TkUtil::Charset::UTF_8));
+	_setCoords(m_coords_before);
 }
 /*----------------------------------------------------------------------------*/
 void CommandModifyMesh::
 internalRedo()
 {
-	throw TkUtil::Exception (TkUtil::UTF8String ("CommandModifyMesh::internalRedo pas encore implémenté.", TkUtil::Charset::UTF_8));
+	_setCoords(m_coords_after);
+}
+/*----------------------------------------------------------------------------*/
+void CommandModifyMesh::
+_getCoords(const std::vector<gmds::TCellID>& nodes, std::vector<double>& coords)
+{
+	gmds::IGMesh& gmds_mesh = getContext().getLocalMeshManager().getMesh()->getGMDSMesh();
+	coords.resize(3*nodes.size());
+	for (uint i=0; i<nodes.size(); i++){
+		gmds::Node nd = gmds_mesh.get<gmds::Node>(nodes[i]);
+		coords[3*i]   = nd.X();
+		coords[3*i+1] = nd.Y();
+		coords[3*i+2] = nd.Z();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void CommandModifyMesh::
+_setCoords(const std::vector<double>& coords)
+{
+	gmds::IGMesh& gmds_mesh = getContext().getLocalMeshManager().getMesh()->getGMDSMesh();
+	for (uint i=0; i<m_nodes.size(); i++){
+		gmds::Node nd = gmds_mesh.get<gmds::Node>(m_nodes[i]);
+		nd.setXYZ(coords[3*i], coords[3*i+1], coords[3*i+2]);
+	}
+}
+/*----------------------------------------------------------------------------*/
+void CommandModifyMesh::
+_getGMDSNodes(Mesh::MeshEntity* me, std::vector<gmds::Node>& nodes)
+{
+	if (Mesh::Volume* vol = dynamic_cast<Mesh::Volume*>(me))
+		vol->getGMDSNodes(nodes);
+	else if (Mesh::Surface* surf = dynamic_cast<Mesh::Surface*>(me))
+		surf->getGMDSNodes(nodes);
+	else if (Mesh::Line* line = dynamic_cast<Mesh::Line*>(me))
+		line->getGMDSNodes(nodes);
+	else if (Mesh::Cloud* cloud = dynamic_cast<Mesh::Cloud*>(me))
+		cloud->getGMDSNodes(nodes);
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
@@ -11,6 +11,7 @@
 #include "Mesh/Compare2Meshes.h"
 #include "Utils/Common.h"
 #include "Utils/MgxNumeric.h"
+#include "Utils/ParallelExecution.h"
 #include "Internal/Context.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
@@ -19,512 +20,570 @@
 /*----------------------------------------------------------------------------*/
 #include "GMDS/IG/IGMesh.h"
 /*----------------------------------------------------------------------------*/
+#include <functional>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+/*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
-Compare2Meshes::Compare2Meshes(Internal::Context* context, gmds::IGMesh& mesh1, gmds::IGMesh& mesh2)
+/// nombre de cellules traitées par tâche lors des appariements
+#define NB_CELLULES_TACHE_COMPARAISON 50000
+/// nombre maximum de cases de la grille de hachage par direction (clé sur 21 bits)
+#define NB_CASES_MAX_COMPARAISON 2000000
+/*----------------------------------------------------------------------------*/
+/// exécute tache(début, fin) sur des tranches de [0, nb[
+static void executeParTranches(size_t nb, const std::function<void(size_t, size_t)>& tache)
+{
+    Utils::executeParTranches(nb, NB_CELLULES_TACHE_COMPARAISON, tache);
+}
+/*----------------------------------------------------------------------------*/
+/// clé calculée à partir des id (triés) des noeuds d'une maille
+static uint64_t getCleNoeuds(const std::vector<gmds::TCellID>& ids)
+{
+    uint64_t cle = 14695981039346656037ULL;
+    for (uint i=0; i<ids.size(); i++){
+        cle ^= (uint64_t)ids[i];
+        cle *= 1099511628211ULL;
+    }
+    return cle;
+}
+/*----------------------------------------------------------------------------*/
+/** vrai si nds2 contient les noeuds de nds1 dans le même ordre, à une
+ *  permutation circulaire près, et aussi dans l'ordre inverse si
+ *  orientationLibre
+ */
+static bool memeConnectivite(const std::vector<gmds::TCellID>& nds1,
+        const std::vector<gmds::TCellID>& nds2, bool orientationLibre)
+{
+    const size_t nb = nds1.size();
+    if (nds2.size() != nb)
+        return false;
+    if (nb == 0)
+        return true;
+    for (size_t dec=0; dec<nb; dec++){
+        if (nds2[dec] != nds1[0])
+            continue;
+        bool egal = true;
+        for (size_t j=1; j<nb && egal; j++)
+            egal = (nds2[(dec+j)%nb] == nds1[j]);
+        if (egal)
+            return true;
+        if (orientationLibre){
+            egal = true;
+            for (size_t j=1; j<nb && egal; j++)
+                egal = (nds2[(dec+nb-j)%nb] == nds1[j]);
+            if (egal)
+                return true;
+        }
+    }
+    return false;
+}
+/*----------------------------------------------------------------------------*/
+/// comparaison suivant la clé seulement
+static bool compareCle(const std::pair<uint64_t, size_t>& p, uint64_t cle)
+{
+    return p.first < cle;
+}
+/*----------------------------------------------------------------------------*/
+/// dimension des cellules gmds
+template<typename TCell> static int getDim();
+template<> int getDim<gmds::Node>() {return 0;}
+template<> int getDim<gmds::Edge>() {return 1;}
+template<> int getDim<gmds::Face>() {return 2;}
+template<> int getDim<gmds::Region>() {return 3;}
+/*----------------------------------------------------------------------------*/
+/// ajoute au rapport une cellule non appariée
+static void addUnmatched(std::vector<gmds::TCellID>& unmatched, long& nb, gmds::TCellID id)
+{
+    if (unmatched.size() < Compare2Meshes::getMaxNbIds())
+        unmatched.push_back(id);
+    nb++;
+}
+/*----------------------------------------------------------------------------*/
+Compare2Meshes::Compare2Meshes(Internal::Context* context, gmds::IGMesh& mesh1, gmds::IGMesh& mesh2,
+        double tolerance)
 : m_context(context)
 , m_gmds_mesh1(mesh1)
 , m_gmds_mesh2(mesh2)
+, m_tolerance(tolerance)
 {
+    if (m_tolerance <= 0.0)
+        m_tolerance = std::sqrt(Utils::Math::MgxNumeric::mgxDoubleEpsilon);
 }
 /*----------------------------------------------------------------------------*/
 bool Compare2Meshes::perform()
 {
-    bool ok = true;
-
-    // nombre de noeuds
-    if (m_gmds_mesh1.getNbNodes() != m_gmds_mesh2.getNbNodes()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message <<"Comparaison de 2 maillages: nombre de noeuds différents "
-                <<(long)m_gmds_mesh1.getNbNodes()<<" != "<<(long)m_gmds_mesh2.getNbNodes();
-        getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-        ok = false;
-    }
+    m_report = Report();
+    m_report.tolerance = m_tolerance;
 
-    // nombre de bras
-    if (m_gmds_mesh1.getNbEdges() != m_gmds_mesh2.getNbEdges()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message <<"Comparaison de 2 maillages: nombre de bras différents "
-                <<(long)m_gmds_mesh1.getNbEdges()<<" != "<<(long)m_gmds_mesh2.getNbEdges();
-        getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-        ok = false;
-    }
-
-    // nombre de polygones (tous confondus)
-    if (m_gmds_mesh1.getNbFaces() != m_gmds_mesh2.getNbFaces()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message <<"Comparaison de 2 maillages: nombre de polygones différents "
-                <<(long)m_gmds_mesh1.getNbFaces()<<" != "<<(long)m_gmds_mesh2.getNbFaces();
-        getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-        ok = false;
-    }
+    // LES NOEUDS
+    // ==========
+    matchNodes();
 
-    // nombre de polyèdres (tous confondus)
-    if (m_gmds_mesh1.getNbRegions() != m_gmds_mesh2.getNbRegions()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message <<"Comparaison de 2 maillages: nombre de polyèdres différents "
-                <<(long)m_gmds_mesh1.getNbRegions()<<" != "<<(long)m_gmds_mesh2.getNbRegions();
-        getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-        ok = false;
-    }
-
-    // nombre de nuages (de noeuds)
-    if (m_gmds_mesh1.getNbClouds() != m_gmds_mesh2.getNbClouds()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message <<"Comparaison de 2 maillages: nombre de nuages différents "
-                <<(long)m_gmds_mesh1.getNbClouds()<<" != "<<(long)m_gmds_mesh2.getNbClouds();
-        getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-        ok = false;
-    }
-
-    // nombre de lignes (de bras)
-    if (m_gmds_mesh1.getNbLines() != m_gmds_mesh2.getNbLines()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message <<"Comparaison de 2 maillages: nombre de lignes différents "
-                <<(long)m_gmds_mesh1.getNbLines()<<" != "<<(long)m_gmds_mesh2.getNbLines();
-        getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-        ok = false;
+    // LES ELEMENTS
+    // ============
+    // appariement des bras, des polygones et des polyèdres par leurs noeuds
+    std::vector<gmds::TCellID> edge_1to2;
+    std::vector<double> edge_deviation;
+    {
+        std::vector<gmds::TCellID> ids1, ids2;
+        for (gmds::IGMesh::edge_iterator it = m_gmds_mesh1.edges_begin(); !it.isDone(); it.next())
+            ids1.push_back(it.value().getID());
+        for (gmds::IGMesh::edge_iterator it = m_gmds_mesh2.edges_begin(); !it.isDone(); it.next())
+            ids2.push_back(it.value().getID());
+
+        edge_1to2.resize(m_gmds_mesh1.getMaxLocalID(1)+1, gmds::NullID);
+        edge_deviation.resize(edge_1to2.size(), 0.0);
+        m_report.meshes.push_back(CellsReport("", 1));
+        matchCells<gmds::Edge>(ids1, ids2, edge_1to2, edge_deviation, m_report.meshes.back());
     }
 
-    // nombre de surfaces (de polygones)
-    if (m_gmds_mesh1.getNbSurfaces() != m_gmds_mesh2.getNbSurfaces()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message <<"Comparaison de 2 maillages: nombre de surfaces différents "
-                <<(long)m_gmds_mesh1.getNbSurfaces()<<" != "<<(long)m_gmds_mesh2.getNbSurfaces();
-        getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-        ok = false;
+    std::vector<gmds::TCellID> face_1to2;
+    std::vector<double> face_deviation;
+    {
+        std::vector<gmds::TCellID> ids1, ids2;
+        for (gmds::IGMesh::face_iterator it = m_gmds_mesh1.faces_begin(); !it.isDone(); it.next())
+            ids1.push_back(it.value().getID());
+        for (gmds::IGMesh::face_iterator it = m_gmds_mesh2.faces_begin(); !it.isDone(); it.next())
+            ids2.push_back(it.value().getID());
+
+        face_1to2.resize(m_gmds_mesh1.getMaxLocalID(2)+1, gmds::NullID);
+        face_deviation.resize(face_1to2.size(), 0.0);
+        m_report.meshes.push_back(CellsReport("", 2));
+        matchCells<gmds::Face>(ids1, ids2, face_1to2, face_deviation, m_report.meshes.back());
     }
 
-    // nombre de volumes (de polyèdres)
-    if (m_gmds_mesh1.getNbVolumes() != m_gmds_mesh2.getNbVolumes()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message <<"Comparaison de 2 maillages: nombre de volumes différents "
-                <<(long)m_gmds_mesh1.getNbVolumes()<<" != "<<(long)m_gmds_mesh2.getNbVolumes();
-        getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-        ok = false;
+    std::vector<gmds::TCellID> region_1to2;
+    std::vector<double> region_deviation;
+    {
+        std::vector<gmds::TCellID> ids1, ids2;
+        for (gmds::IGMesh::region_iterator it = m_gmds_mesh1.regions_begin(); !it.isDone(); it.next())
+            ids1.push_back(it.value().getID());
+        for (gmds::IGMesh::region_iterator it = m_gmds_mesh2.regions_begin(); !it.isDone(); it.next())
+            ids2.push_back(it.value().getID());
+
+        region_1to2.resize(m_gmds_mesh1.getMaxLocalID(3)+1, gmds::NullID);
+        region_deviation.resize(region_1to2.size(), 0.0);
+        m_report.meshes.push_back(CellsReport("", 3));
+        matchCells<gmds::Region>(ids1, ids2, region_1to2, region_deviation, m_report.meshes.back());
     }
 
-    // LES COORDONNEES
-    // ===============
-    // Comparaison des coordonnées des noeuds dans l'ordre,
-    // seulement s'il y en a autant de part et d'autre
-    if (m_gmds_mesh1.getNbNodes() == m_gmds_mesh2.getNbNodes()) {
-        uint nb_vtx_err = 0;
-        gmds::IGMesh::node_iterator itNd1 = m_gmds_mesh1.nodes_begin();
-        gmds::IGMesh::node_iterator itNd2 = m_gmds_mesh2.nodes_begin();
-
-        double errMax = 0.0;
-        uint idMax = 0;
-        uint i = 0;
-        for (; !itNd1.isDone(); itNd1.next(), itNd2.next(), i++){
-            gmds::Node nd1 = itNd1.value();
-            gmds::Node nd2 = itNd2.value();
-
-            double x1 = nd1.X();
-            double x2 = nd2.X();
-            double y1 = nd1.Y();
-            double y2 = nd2.Y();
-            double z1 = nd1.Z();
-            double z2 = nd2.Z();
-
-            double err = ((x1 - x2) * (x1 - x2)) + ((y1 - y2) * (y1 - y2)) + ((z1 - z2) * (z1 - z2));
-
-            if (!Utils::Math::MgxNumeric::isNearlyZero(err)){
-                nb_vtx_err += 1;
-                if (err > errMax){
-                	errMax = err;
-                	idMax = i;
-                }
-            }
-        } // end for itNd1 et itNd2
-
-        if (nb_vtx_err){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message <<"Comparaison de 2 maillages: positions des noeuds différentes pour "
-                    <<(long)nb_vtx_err<<" sur "<<(long)m_gmds_mesh1.getNbNodes();
-            message <<", plus grande erreur de "<<errMax<<" pour l'indice "<<(long)idMax;
-            getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-            //std::cerr<<message<<std::endl;
-            ok = false;
-        }
-
-    } // end if (m_gmds_mesh1.getNbNodes() != m_gmds_mesh2.getNbNodes())
-
-
-    // LES ELEMENTS
-    // ============
-    // Comparaison de la topologie des polygones et des polyèdres
-    // comparaison en nombre de noeuds et id de ces derniers
-    // On fait l'impasse sur les bras
-    if (m_gmds_mesh1.getNbFaces() == m_gmds_mesh2.getNbFaces()){
-        uint nb_poly_err = 0;
-        gmds::IGMesh::face_iterator itPoly1 = m_gmds_mesh1.faces_begin();
-        gmds::IGMesh::face_iterator itPoly2 = m_gmds_mesh2.faces_begin();
-
-        for (; !itPoly1.isDone(); itPoly1.next(), itPoly2.next()){
-            gmds::Face p1 = itPoly1.value();
-            gmds::Face p2 = itPoly2.value();
-
-            if (p1.getNbNodes() != p2.getNbNodes()){
-                nb_poly_err += 1;
-            }
-            else {
-                std::vector<gmds::TCellID> ids1 = p1.getIDs<gmds::Node>();
-                std::vector<gmds::TCellID> ids2 = p2.getIDs<gmds::Node>();
-                bool okId = true;
-                for (uint i=0; i<ids1.size(); i++)
-                    if (ids1[i] != ids2[i])
-                        okId = false;
-                if (!okId)
-                    nb_poly_err += 1;
-            }
-
-        } // end for itPoly1 et itPoly2
-
-        if (nb_poly_err){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message <<"Comparaison de 2 maillages: polygones topologiquement différents: "
-                    <<(long)nb_poly_err<<" sur "<<(long)m_gmds_mesh1.getNbFaces();
-            getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-            ok = false;
-        }
-
-    } // end if (m_gmds_mesh1.getNbFaces() == m_gmds_mesh2.getNbFaces())
-
-    if (m_gmds_mesh1.getNbRegions() == m_gmds_mesh2.getNbRegions()){
-        uint nb_poly_err = 0;
-        gmds::IGMesh::region_iterator itPoly1 = m_gmds_mesh1.regions_begin();
-        gmds::IGMesh::region_iterator itPoly2 = m_gmds_mesh2.regions_begin();
-
-        for (; !itPoly1.isDone(); itPoly1.next(), itPoly2.next()){
-            gmds::Region p1 = itPoly1.value();
-            gmds::Region p2 = itPoly2.value();
-
-            if (p1.getNbNodes() != p2.getNbNodes()){
-                nb_poly_err += 1;
-            }
-            else {
-                std::vector<gmds::TCellID> ids1 = p1.getIDs<gmds::Node>();
-                std::vector<gmds::TCellID> ids2 = p2.getIDs<gmds::Node>();
-                bool okId = true;
-                for (uint i=0; i<ids1.size(); i++)
-                    if (ids1[i] != ids2[i])
-                        okId = false;
-                if (!okId)
-                    nb_poly_err += 1;
-            }
-
-        } // end for itPoly1 et itPoly2
-
-        if (nb_poly_err){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message <<"Comparaison de 2 maillages: polyèdres topologiquement différents: "
-                    <<(long)nb_poly_err<<" sur "<<(long)m_gmds_mesh1.getNbRegions();
-            getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-            ok = false;
-        }
-
-    } // end if (m_gmds_mesh1.getNbRegions() == m_gmds_mesh2.getNbRegions())
-
     // LES GROUPES
     // ===========
 
     // Comparaison des nuages
     // ----------------------
     {
-        // comparaison des noms des groupes
-        gmds::IGMesh::clouds_iterator itGrp1 = m_gmds_mesh1.clouds_begin();
-        gmds::IGMesh::clouds_iterator itGrp2 = m_gmds_mesh2.clouds_begin();
         std::vector<std::string> liste1;
         std::vector<std::string> liste2;
-        for (; itGrp1 != m_gmds_mesh1.clouds_end(); ++itGrp1)
-            liste1.push_back(itGrp1->name());
-        for (; itGrp2 != m_gmds_mesh2.clouds_end(); ++itGrp2)
-            liste2.push_back(itGrp2->name());
+        for (gmds::IGMesh::clouds_iterator itGrp = m_gmds_mesh1.clouds_begin(); itGrp != m_gmds_mesh1.clouds_end(); ++itGrp)
+            liste1.push_back(itGrp->name());
+        for (gmds::IGMesh::clouds_iterator itGrp = m_gmds_mesh2.clouds_begin(); itGrp != m_gmds_mesh2.clouds_end(); ++itGrp)
+            liste2.push_back(itGrp->name());
 
         std::vector<std::string> common;
-        std::vector<std::string> add1;
-        std::vector<std::string> add2;
-
-        diff(liste1, liste2, common, add1, add2);
-        if (!add1.empty() || !add2.empty()){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message <<"Comparaison de 2 maillages: il n'y a pas les même nuages: il y en a "
-                    << (long)common.size()<< " en commun sur "
-                    <<(long)liste1.size()<< " et "<<(long)liste2.size();
-            if (!add1.empty()){
-                message << "\n  le premier maillage contient en plus de la partie commune les nuages :";
-                for (uint i=0; i<add1.size(); i++)
-                    message << " "<<add1[i];
-            }
-            if (!add2.empty()){
-                message << "\n  le deuxième maillage contient en plus de la partie commune les nuages :";
-                for (uint i=0; i<add2.size(); i++)
-                    message << " "<<add2[i];
-            }
-            getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-            ok = false;
-        }
+        diff(liste1, liste2, common, m_report.groupsOnly1, m_report.groupsOnly2);
 
-        // comparaison du contenu des groupes en communs (id des éléments seulement, dans le même ordre)
         for (uint i=0; i<common.size(); i++){
-            gmds::IGMesh::cloud& grp1 = m_gmds_mesh1.getCloud(common[i]);
-            gmds::IGMesh::cloud& grp2 = m_gmds_mesh2.getCloud(common[i]);
-            std::vector<gmds::Node> cells1 = grp1.cells();
-            std::vector<gmds::Node> cells2 = grp2.cells();
-
-            if (cells1.size() == cells2.size()){
-                std::vector<gmds::Node>::iterator ic1 = cells1.begin();
-                std::vector<gmds::Node>::iterator ic2 = cells2.begin();
-                uint nb_id_diff = 0;
-                for (; ic1 != cells1.end(); ++ic1, ++ic2)
-                    if ((*ic1).getID() != (*ic2).getID()){
-//                        std::cout<<common[i]<<": noeud id "<<(*ic1)->getID()<<" != "<<(*ic2)->getID()<<std::endl;
-                        nb_id_diff += 1;
-                    }
-
-                if (nb_id_diff){
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message <<"Comparaison de 2 maillages: noeuds du nuage "<<common[i]<< " différents: "
-                            <<(long)nb_id_diff<<" noeuds de différents sur "<<(long)cells1.size();
-                    getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-                    ok = false;
-                }
-            }
-            else {
-				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                message <<"Comparaison de 2 maillages: tailles du nuage "<<common[i]<< " différentes "
-                        <<(long)cells1.size()<<" != "<<(long)cells2.size();
-                getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-                ok = false;
-            }
-
-        } // end for i<common.size()
-
-    } // fin de Comparaison des nuages
+            m_report.groups.push_back(CellsReport(common[i], 0));
+            compareGroup<gmds::Node>(m_gmds_mesh1.getCloud(common[i]).cells(),
+                    m_gmds_mesh2.getCloud(common[i]).cells(),
+                    m_node_1to2, m_node_deviation, m_report.groups.back());
+        }
+    }
 
     // Comparaison des lignes
     // ----------------------
     {
-        // comparaison des noms des groupes
-        gmds::IGMesh::lines_iterator itGrp1 = m_gmds_mesh1.lines_begin();
-        gmds::IGMesh::lines_iterator itGrp2 = m_gmds_mesh2.lines_begin();
         std::vector<std::string> liste1;
         std::vector<std::string> liste2;
-        for (; itGrp1 != m_gmds_mesh1.lines_end(); ++itGrp1)
-            liste1.push_back(itGrp1->name());
-        for (; itGrp2 != m_gmds_mesh2.lines_end(); ++itGrp2)
-            liste2.push_back(itGrp2->name());
+        for (gmds::IGMesh::lines_iterator itGrp = m_gmds_mesh1.lines_begin(); itGrp != m_gmds_mesh1.lines_end(); ++itGrp)
+            liste1.push_back(itGrp->name());
+        for (gmds::IGMesh::lines_iterator itGrp = m_gmds_mesh2.lines_begin(); itGrp != m_gmds_mesh2.lines_end(); ++itGrp)
+            liste2.push_back(itGrp->name());
 
         std::vector<std::string> common;
-        std::vector<std::string> add1;
-        std::vector<std::string> add2;
-
-        diff(liste1, liste2, common, add1, add2);
-        if (!add1.empty() || !add2.empty()){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message <<"Comparaison de 2 maillages: il n'y a pas les même lignes: il y en a "
-                    << (long)common.size()<< " en commun sur "
-                    <<(long)liste1.size()<< " et "<<(long)liste2.size();
-            if (!add1.empty()){
-                message << "\n  le premier maillage contient en plus de la partie commune les lignes :";
-                for (uint i=0; i<add1.size(); i++)
-                    message << " "<<add1[i];
-            }
-            if (!add2.empty()){
-                message << "\n  le deuxième maillage contient en plus de la partie commune les lignes :";
-                for (uint i=0; i<add2.size(); i++)
-                    message << " "<<add2[i];
-            }
-            getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-            ok = false;
-        }
+        diff(liste1, liste2, common, m_report.groupsOnly1, m_report.groupsOnly2);
 
-        // comparaison du contenu des groupes en communs (id des éléments seulement, dans le même ordre)
         for (uint i=0; i<common.size(); i++){
-            gmds::IGMesh::line& grp1 = m_gmds_mesh1.getLine(common[i]);
-            gmds::IGMesh::line& grp2 = m_gmds_mesh2.getLine(common[i]);
-            std::vector<gmds::Edge> cells1 = grp1.cells();
-            std::vector<gmds::Edge> cells2 = grp2.cells();
-
-            if (cells1.size() == cells2.size()){
-                std::vector<gmds::Edge>::iterator ic1 = cells1.begin();
-                std::vector<gmds::Edge>::iterator ic2 = cells2.begin();
-                uint nb_id_diff = 0;
-                for (; ic1 != cells1.end(); ++ic1, ++ic2)
-                    if ((*ic1).getID() != (*ic2).getID())
-                        nb_id_diff += 1;
-
-                if (nb_id_diff){
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message <<"Comparaison de 2 maillages: bras de la surface "<<common[i]<< " différents: "
-                            <<(long)nb_id_diff<<" bras de différents sur "<<(long)cells1.size();
-                    getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-                    ok = false;
-                }
-            }
-            else {
-				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                message <<"Comparaison de 2 maillages: tailles de la ligne "<<common[i]<< " différentes "
-                        <<(long)cells1.size()<<" != "<<(long)cells2.size();
-                getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-                ok = false;
-            }
-
-        } // end for i<common.size()
-
-    } // fin de Comparaison des lignes
-
+            m_report.groups.push_back(CellsReport(common[i], 1));
+            compareGroup<gmds::Edge>(m_gmds_mesh1.getLine(common[i]).cells(),
+                    m_gmds_mesh2.getLine(common[i]).cells(),
+                    edge_1to2, edge_deviation, m_report.groups.back());
+        }
+    }
 
     // Comparaison des surfaces
     // ------------------------
     {
-        // comparaison des noms des groupes
-        gmds::IGMesh::surfaces_iterator itGrp1 = m_gmds_mesh1.surfaces_begin();
-        gmds::IGMesh::surfaces_iterator itGrp2 = m_gmds_mesh2.surfaces_begin();
         std::vector<std::string> liste1;
         std::vector<std::string> liste2;
-        for (; itGrp1 != m_gmds_mesh1.surfaces_end(); ++itGrp1)
-            liste1.push_back(itGrp1->name());
-        for (; itGrp2 != m_gmds_mesh2.surfaces_end(); ++itGrp2)
-            liste2.push_back(itGrp2->name());
+        for (gmds::IGMesh::surfaces_iterator itGrp = m_gmds_mesh1.surfaces_begin(); itGrp != m_gmds_mesh1.surfaces_end(); ++itGrp)
+            liste1.push_back(itGrp->name());
+        for (gmds::IGMesh::surfaces_iterator itGrp = m_gmds_mesh2.surfaces_begin(); itGrp != m_gmds_mesh2.surfaces_end(); ++itGrp)
+            liste2.push_back(itGrp->name());
 
         std::vector<std::string> common;
-        std::vector<std::string> add1;
-        std::vector<std::string> add2;
-
-        diff(liste1, liste2, common, add1, add2);
-        if (!add1.empty() || !add2.empty()){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message <<"Comparaison de 2 maillages: il n'y a pas les même surfaces: il y en a "
-                    << (long)common.size()<< " en commun sur "
-                    <<(long)liste1.size()<< " et "<<(long)liste2.size();
-            if (!add1.empty()){
-                message << "\n  le premier maillage contient en plus de la partie commune les surfaces :";
-                for (uint i=0; i<add1.size(); i++)
-                    message << " "<<add1[i];
-            }
-            if (!add2.empty()){
-                message << "\n  le deuxième maillage contient en plus de la partie commune les surfaces :";
-                for (uint i=0; i<add2.size(); i++)
-                    message << " "<<add2[i];
-            }
-            getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-            ok = false;
-        }
+        diff(liste1, liste2, common, m_report.groupsOnly1, m_report.groupsOnly2);
 
-        // comparaison du contenu des groupes en communs (id des éléments seulement, dans le même ordre)
         for (uint i=0; i<common.size(); i++){
-            gmds::IGMesh::surface& grp1 = m_gmds_mesh1.getSurface(common[i]);
-            gmds::IGMesh::surface& grp2 = m_gmds_mesh2.getSurface(common[i]);
-            std::vector<gmds::Face> cells1 = grp1.cells();
-            std::vector<gmds::Face> cells2 = grp2.cells();
-
-            if (cells1.size() == cells2.size()){
-                std::vector<gmds::Face>::iterator ic1 = cells1.begin();
-                std::vector<gmds::Face>::iterator ic2 = cells2.begin();
-                uint nb_id_diff = 0;
-                for (; ic1 != cells1.end(); ++ic1, ++ic2)
-                    if ((*ic1).getID() != (*ic2).getID())
-                        nb_id_diff += 1;
-
-                if (nb_id_diff){
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message <<"Comparaison de 2 maillages: polygones de la surface "<<common[i]<< " différents: "
-                            <<(long)nb_id_diff<<" polygones de différents sur "<<(long)cells1.size();
-                    getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-                    ok = false;
-                }
-            }
-            else {
-				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                message <<"Comparaison de 2 maillages: tailles de la surface "<<common[i]<< " différentes "
-                        <<(long)cells1.size()<<" != "<<(long)cells2.size();
-                getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-                ok = false;
-            }
-
-        } // end for i<common.size()
-
-    } // fin de Comparaison des surfaces
-
+            m_report.groups.push_back(CellsReport(common[i], 2));
+            compareGroup<gmds::Face>(m_gmds_mesh1.getSurface(common[i]).cells(),
+                    m_gmds_mesh2.getSurface(common[i]).cells(),
+                    face_1to2, face_deviation, m_report.groups.back());
+        }
+    }
 
     // Comparaison des volumes
     // -----------------------
     {
-        // comparaison des noms des groupes
-        gmds::IGMesh::volumes_iterator itGrp1 = m_gmds_mesh1.volumes_begin();
-        gmds::IGMesh::volumes_iterator itGrp2 = m_gmds_mesh2.volumes_begin();
         std::vector<std::string> liste1;
         std::vector<std::string> liste2;
-        for (; itGrp1 != m_gmds_mesh1.volumes_end(); ++itGrp1)
-            liste1.push_back(itGrp1->name());
-        for (; itGrp2 != m_gmds_mesh2.volumes_end(); ++itGrp2)
-            liste2.push_back(itGrp2->name());
+        for (gmds::IGMesh::volumes_iterator itGrp = m_gmds_mesh1.volumes_begin(); itGrp != m_gmds_mesh1.volumes_end(); ++itGrp)
+            liste1.push_back(itGrp->name());
+        for (gmds::IGMesh::volumes_iterator itGrp = m_gmds_mesh2.volumes_begin(); itGrp != m_gmds_mesh2.volumes_end(); ++itGrp)
+            liste2.push_back(itGrp->name());
 
         std::vector<std::string> common;
-        std::vector<std::string> add1;
-        std::vector<std::string> add2;
-
-        diff(liste1, liste2, common, add1, add2);
-        if (!add1.empty() || !add2.empty()){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message <<"Comparaison de 2 maillages: il n'y a pas les même volumes: il y en a "
-                    << (long)common.size()<< " en commun sur "
-                    <<(long)liste1.size()<< " et "<<(long)liste2.size();
-            if (!add1.empty()){
-                message << "\n  le premier maillage contient en plus de la partie commune les volumes :";
-                for (uint i=0; i<add1.size(); i++)
-                    message << " "<<add1[i];
-            }
-            if (!add2.empty()){
-                message << "\n  le deuxième maillage contient en plus de la partie commune les volumes :";
-                for (uint i=0; i<add2.size(); i++)
-                    message << " "<<add2[i];
-            }
-            getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-            ok = false;
-        }
+        diff(liste1, liste2, common, m_report.groupsOnly1, m_report.groupsOnly2);
 
-        // comparaison du contenu des groupes en communs (id des éléments seulement, dans le même ordre)
         for (uint i=0; i<common.size(); i++){
-            gmds::IGMesh::volume& grp1 = m_gmds_mesh1.getVolume(common[i]);
-            gmds::IGMesh::volume& grp2 = m_gmds_mesh2.getVolume(common[i]);
-            std::vector<gmds::Region> cells1 = grp1.cells();
-            std::vector<gmds::Region> cells2 = grp2.cells();
-
-            if (cells1.size() == cells2.size()){
-                std::vector<gmds::Region>::iterator ic1 = cells1.begin();
-                std::vector<gmds::Region>::iterator ic2 = cells2.begin();
-                uint nb_id_diff = 0;
-                for (; ic1 != cells1.end(); ++ic1, ++ic2)
-                    if ((*ic1).getID() != (*ic2).getID())
-                        nb_id_diff += 1;
-
-                if (nb_id_diff){
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message <<"Comparaison de 2 maillages: polyèdres du volume "<<common[i]<< " différents: "
-                            <<(long)nb_id_diff<<" polyèdres de différents sur "<<(long)cells1.size();
-                    getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-                    ok = false;
-                }
-            }
-            else {
-				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                message <<"Comparaison de 2 maillages: tailles du volume "<<common[i]<< " différentes "
-                        <<(long)cells1.size()<<" != "<<(long)cells2.size();
-                getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-                ok = false;
-            }
+            m_report.groups.push_back(CellsReport(common[i], 3));
+            compareGroup<gmds::Region>(m_gmds_mesh1.getVolume(common[i]).cells(),
+                    m_gmds_mesh2.getVolume(common[i]).cells(),
+                    region_1to2, region_deviation, m_report.groups.back());
+        }
+    }
 
-        } // end for i<common.size()
+    bool ok = m_report.isOk();
+    getContext().getLogStream()->log (TkUtil::TraceLog (m_report.toString(),
+            ok ? TkUtil::Log::INFORMATION : TkUtil::Log::ERROR));
 
-    } // fin de Comparaison des surfaces
+    return ok;
+}
+/*----------------------------------------------------------------------------*/
+void Compare2Meshes::matchNodes()
+{
+    // coordonnées des noeuds des 2 maillages
+    std::vector<gmds::TCellID> ids1, ids2;
+    std::vector<double> xyz1, xyz2;
+    double bmin[3] = {0.0, 0.0, 0.0};
+    double bmax[3] = {0.0, 0.0, 0.0};
+    bool vide = true;
+    for (uint m=0; m<2; m++){
+        gmds::IGMesh& mesh = (m == 0 ? m_gmds_mesh1 : m_gmds_mesh2);
+        std::vector<gmds::TCellID>& ids = (m == 0 ? ids1 : ids2);
+        std::vector<double>& xyz = (m == 0 ? xyz1 : xyz2);
+        ids.reserve(mesh.getNbNodes());
+        xyz.reserve(3*mesh.getNbNodes());
+        for (gmds::IGMesh::node_iterator itNd = mesh.nodes_begin(); !itNd.isDone(); itNd.next()){
+            gmds::Node nd = itNd.value();
+            double pt[3] = {nd.X(), nd.Y(), nd.Z()};
+            ids.push_back(nd.getID());
+            for (uint d=0; d<3; d++){
+                xyz.push_back(pt[d]);
+                if (vide || pt[d] < bmin[d]) bmin[d] = pt[d];
+                if (vide || pt[d] > bmax[d]) bmax[d] = pt[d];
+            }
+            vide = false;
+        }
+    }
 
+    // pas de la grille de hachage: de l'ordre de la distance entre noeuds, au moins
+    // la tolérance pour que la recherche se limite aux cases voisines
+    double etendue = std::max(bmax[0]-bmin[0], std::max(bmax[1]-bmin[1], bmax[2]-bmin[2]));
+    double pas = (ids2.empty() ? etendue : etendue / std::cbrt((double)ids2.size()));
+    pas = std::max(pas, std::max(m_tolerance, etendue / NB_CASES_MAX_COMPARAISON));
+
+    auto getCase = [&](const double* pt, long* ijk){
+        for (uint d=0; d<3; d++)
+            ijk[d] = (long)std::floor((pt[d]-bmin[d])/pas);
+    };
+    auto getCle = [](const long* ijk) -> uint64_t {
+        return ((uint64_t)ijk[0]<<42) | ((uint64_t)ijk[1]<<21) | (uint64_t)ijk[2];
+    };
+
+    // les noeuds du deuxième maillage triés suivant leur case
+    std::vector<std::pair<uint64_t, size_t> > grille(ids2.size());
+    executeParTranches(ids2.size(), [&](size_t deb, size_t fin){
+        for (size_t i=deb; i<fin; i++){
+            long ijk[3];
+            getCase(&xyz2[3*i], ijk);
+            grille[i] = std::make_pair(getCle(ijk), i);
+        }
+    });
+    std::sort(grille.begin(), grille.end());
+
+    // appariement des noeuds du premier maillage avec le plus proche dans la tolérance
+    m_node_1to2.assign(m_gmds_mesh1.getMaxLocalID(0)+1, gmds::NullID);
+    m_node_deviation.assign(m_node_1to2.size(), 0.0);
+    std::vector<size_t> indice2(ids1.size(), ids2.size());
+    const double tol2 = m_tolerance*m_tolerance;
+    executeParTranches(ids1.size(), [&](size_t deb, size_t fin){
+        for (size_t i=deb; i<fin; i++){
+            const double* pt = &xyz1[3*i];
+            long ijk[3];
+            getCase(pt, ijk);
+            double dist2Min = tol2;
+            size_t plusProche = ids2.size();
+            for (long di=-1; di<=1; di++)
+                for (long dj=-1; dj<=1; dj++)
+                    for (long dk=-1; dk<=1; dk++){
+                        long voisin[3] = {ijk[0]+di, ijk[1]+dj, ijk[2]+dk};
+                        if (voisin[0] < 0 || voisin[1] < 0 || voisin[2] < 0)
+                            continue;
+                        uint64_t cle = getCle(voisin);
+                        std::vector<std::pair<uint64_t, size_t> >::const_iterator iter =
+                                std::lower_bound(grille.begin(), grille.end(), cle, compareCle);
+                        for (; iter != grille.end() && iter->first == cle; ++iter){
+                            const double* pt2 = &xyz2[3*iter->second];
+                            double dist2 = (pt[0]-pt2[0])*(pt[0]-pt2[0])
+                                    + (pt[1]-pt2[1])*(pt[1]-pt2[1])
+                                    + (pt[2]-pt2[2])*(pt[2]-pt2[2]);
+                            if (dist2 <= dist2Min){
+                                dist2Min = dist2;
+                                plusProche = iter->second;
+                            }
+                        }
+                    }
+            if (plusProche != ids2.size()){
+                indice2[i] = plusProche;
+                m_node_1to2[ids1[i]] = ids2[plusProche];
+                m_node_deviation[ids1[i]] = std::sqrt(dist2Min);
+            }
+        }
+    });
+
+    // un noeud du deuxième maillage n'est apparié qu'avec un seul noeud du premier,
+    // le plus proche (le premier à égalité), les autres (noeuds doublés) ne
+    // sont pas appariés
+    std::vector<size_t> meilleur1(ids2.size(), ids1.size());
+    for (size_t i=0; i<ids1.size(); i++){
+        size_t j = indice2[i];
+        if (j != ids2.size() && (meilleur1[j] == ids1.size()
+                || m_node_deviation[ids1[i]] < m_node_deviation[ids1[meilleur1[j]]]))
+            meilleur1[j] = i;
+    }
+    for (size_t i=0; i<ids1.size(); i++)
+        if (indice2[i] != ids2.size() && meilleur1[indice2[i]] != i){
+            indice2[i] = ids2.size();
+            m_node_1to2[ids1[i]] = gmds::NullID;
+            m_node_deviation[ids1[i]] = 0.0;
+        }
+    std::vector<size_t>().swap(meilleur1);
+
+    // le rapport
+    m_report.meshes.push_back(CellsReport("", 0));
+    CellsReport& report = m_report.meshes.back();
+    report.nbCells1 = ids1.size();
+    report.nbCells2 = ids2.size();
+    std::vector<char> apparie2(ids2.size(), 0);
+    double somme = 0.0;
+    for (size_t i=0; i<ids1.size(); i++)
+        if (indice2[i] == ids2.size())
+            addUnmatched(report.unmatched1, report.nbUnmatched1, ids1[i]);
+        else {
+            apparie2[indice2[i]] = 1;
+            double ecart = m_node_deviation[ids1[i]];
+            report.maxDeviation = std::max(report.maxDeviation, ecart);
+            somme += ecart;
+        }
+    for (size_t i=0; i<ids2.size(); i++)
+        if (!apparie2[i])
+            addUnmatched(report.unmatched2, report.nbUnmatched2, ids2[i]);
+    if (report.nbCells1 > report.nbUnmatched1)
+        report.meanDeviation = somme / (report.nbCells1 - report.nbUnmatched1);
+}
+/*----------------------------------------------------------------------------*/
+template<typename TCell>
+void Compare2Meshes::matchCells(const std::vector<gmds::TCellID>& ids1, const std::vector<gmds::TCellID>& ids2,
+        std::vector<gmds::TCellID>& map1to2, std::vector<double>& deviation,
+        CellsReport& report)
+{
+    // les mailles du deuxième maillage triées suivant la clé de leurs noeuds
+    std::vector<std::pair<uint64_t, size_t> > index2(ids2.size());
+    executeParTranches(ids2.size(), [&](size_t deb, size_t fin){
+        for (size_t i=deb; i<fin; i++){
+            std::vector<gmds::TCellID> nds = m_gmds_mesh2.get<TCell>(ids2[i]).template getIDs<gmds::Node>();
+            std::sort(nds.begin(), nds.end());
+            index2[i] = std::make_pair(getCleNoeuds(nds), i);
+        }
+    });
+    std::sort(index2.begin(), index2.end());
+
+    // les polyèdres doivent avoir la même orientation, les bras et les polygones
+    // peuvent être parcourus dans l'autre sens
+    const bool orientationLibre = (getDim<TCell>() < 3);
+
+    /* recherche pour la maille i du premier maillage d'une maille du deuxième
+     * ayant les noeuds appariés dans le même ordre (à une permutation
+     * circulaire près), parmi celles non encore prises si pris est fourni.
+     * Retourne l'indice dans ids2, ids2.size() si aucune
+     */
+    auto chercher = [&](size_t i, const std::vector<char>* pris, double& ecart) -> size_t {
+        std::vector<gmds::TCellID> nds = m_gmds_mesh1.get<TCell>(ids1[i]).template getIDs<gmds::Node>();
+        ecart = 0.0;
+        for (uint j=0; j<nds.size(); j++){
+            ecart = std::max(ecart, m_node_deviation[nds[j]]);
+            nds[j] = m_node_1to2[nds[j]];
+            if (nds[j] == gmds::NullID)
+                return ids2.size();
+        }
+        std::vector<gmds::TCellID> nds_tries(nds);
+        std::sort(nds_tries.begin(), nds_tries.end());
+        uint64_t cle = getCleNoeuds(nds_tries);
+
+        std::vector<std::pair<uint64_t, size_t> >::const_iterator iter =
+                std::lower_bound(index2.begin(), index2.end(), cle, compareCle);
+        for (; iter != index2.end() && iter->first == cle; ++iter){
+            if (pris && (*pris)[iter->second])
+                continue;
+            std::vector<gmds::TCellID> nds2 = m_gmds_mesh2.get<TCell>(ids2[iter->second]).template getIDs<gmds::Node>();
+            if (memeConnectivite(nds, nds2, orientationLibre))
+                return iter->second;
+        }
+        return ids2.size();
+    };
+
+    // appariement des mailles du premier maillage, via les noeuds appariés
+    std::vector<size_t> indice2(ids1.size(), ids2.size());
+    executeParTranches(ids1.size(), [&](size_t deb, size_t fin){
+        for (size_t i=deb; i<fin; i++){
+            double ecart;
+            indice2[i] = chercher(i, 0, ecart);
+            if (indice2[i] != ids2.size()){
+                map1to2[ids1[i]] = ids2[indice2[i]];
+                deviation[ids1[i]] = ecart;
+            }
+        }
+    });
+
+    // le rapport
+    report.nbCells1 = ids1.size();
+    report.nbCells2 = ids2.size();
+    std::vector<char> apparie2(ids2.size(), 0);
+    double somme = 0.0;
+    for (size_t i=0; i<ids1.size(); i++){
+        // une maille du deuxième maillage n'est appariée qu'une fois, en cas de
+        // mailles doublées on en cherche une autre encore libre
+        if (indice2[i] != ids2.size() && apparie2[indice2[i]]){
+            double ecart;
+            indice2[i] = chercher(i, &apparie2, ecart);
+            map1to2[ids1[i]] = (indice2[i] == ids2.size() ? gmds::NullID : ids2[indice2[i]]);
+        }
+        if (indice2[i] == ids2.size())
+            addUnmatched(report.unmatched1, report.nbUnmatched1, ids1[i]);
+        else {
+            apparie2[indice2[i]] = 1;
+            report.maxDeviation = std::max(report.maxDeviation, deviation[ids1[i]]);
+            somme += deviation[ids1[i]];
+        }
+    }
+    for (size_t i=0; i<ids2.size(); i++)
+        if (!apparie2[i])
+            addUnmatched(report.unmatched2, report.nbUnmatched2, ids2[i]);
+    if (report.nbCells1 > report.nbUnmatched1)
+        report.meanDeviation = somme / (report.nbCells1 - report.nbUnmatched1);
+}
+/*----------------------------------------------------------------------------*/
+template<typename TCell>
+void Compare2Meshes::compareGroup(const std::vector<TCell>& cells1, const std::vector<TCell>& cells2,
+        const std::vector<gmds::TCellID>& map1to2, const std::vector<double>& deviation,
+        CellsReport& report)
+{
+    report.nbCells1 = cells1.size();
+    report.nbCells2 = cells2.size();
+
+    // état des mailles du deuxième maillage: 1 dans le groupe, 2 dans le groupe et appariée
+    std::vector<char> etat2(m_gmds_mesh2.getMaxLocalID(getDim<TCell>())+1, 0);
+    for (size_t i=0; i<cells2.size(); i++)
+        etat2[cells2[i].getID()] = 1;
+
+    double somme = 0.0;
+    for (size_t i=0; i<cells1.size(); i++){
+        gmds::TCellID id1 = cells1[i].getID();
+        gmds::TCellID id2 = map1to2[id1];
+        if (id2 != gmds::NullID && etat2[id2]){
+            etat2[id2] = 2;
+            report.maxDeviation = std::max(report.maxDeviation, deviation[id1]);
+            somme += deviation[id1];
+        }
+        else
+            addUnmatched(report.unmatched1, report.nbUnmatched1, id1);
+    }
+    for (size_t i=0; i<cells2.size(); i++)
+        if (etat2[cells2[i].getID()] == 1)
+            addUnmatched(report.unmatched2, report.nbUnmatched2, cells2[i].getID());
+    if (report.nbCells1 > report.nbUnmatched1)
+        report.meanDeviation = somme / (report.nbCells1 - report.nbUnmatched1);
+}
+/*----------------------------------------------------------------------------*/
+bool Compare2Meshes::Report::isOk() const
+{
+    if (!groupsOnly1.empty() || !groupsOnly2.empty())
+        return false;
+    for (uint i=0; i<meshes.size(); i++)
+        if (!meshes[i].isOk())
+            return false;
+    for (uint i=0; i<groups.size(); i++)
+        if (!groups[i].isOk())
+            return false;
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+/// ajoute la description d'une comparaison
+static void addToString(TkUtil::UTF8String& message, const Compare2Meshes::CellsReport& report)
+{
+    static const char* nomsMailles[] = {"noeuds", "bras", "polygones", "polyèdres"};
+    static const char* nomsGroupes[] = {"nuage", "ligne", "surface", "volume"};
+
+    message << "\n  ";
+    if (report.name.empty())
+        message << nomsMailles[report.dim];
+    else
+        message << nomsGroupes[report.dim] << " " << report.name;
+    message << " : " << report.nbCells1 << " / " << report.nbCells2
+            << ", non appariés " << report.nbUnmatched1 << " / " << report.nbUnmatched2
+            << ", écart max " << report.maxDeviation << ", moyen " << report.meanDeviation;
+
+    for (uint m=0; m<2; m++){
+        const std::vector<gmds::TCellID>& unmatched = (m == 0 ? report.unmatched1 : report.unmatched2);
+        if (unmatched.empty())
+            continue;
+        message << "\n    non appariés dans le " << (m == 0 ? "premier" : "deuxième") << " maillage (id) :";
+        for (uint i=0; i<unmatched.size(); i++)
+            message << " " << (long)unmatched[i];
+        if ((m == 0 ? report.nbUnmatched1 : report.nbUnmatched2) > (long)unmatched.size())
+            message << " ...";
+    }
+}
+/*----------------------------------------------------------------------------*/
+TkUtil::UTF8String Compare2Meshes::Report::toString() const
+{
+    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+    message << "Comparaison de 2 maillages (tolérance " << tolerance << ") : "
+            << (isOk() ? "identiques" : "différents");
+
+    for (uint i=0; i<meshes.size(); i++)
+        addToString(message, meshes[i]);
+    for (uint i=0; i<groups.size(); i++)
+        addToString(message, groups[i]);
+
+    if (!groupsOnly1.empty()){
+        message << "\n  le premier maillage contient en plus de la partie commune les groupes :";
+        for (uint i=0; i<groupsOnly1.size(); i++)
+            message << " " << groupsOnly1[i];
+    }
+    if (!groupsOnly2.empty()){
+        message << "\n  le deuxième maillage contient en plus de la partie commune les groupes :";
+        for (uint i=0; i<groupsOnly2.size(); i++)
+            message << " " << groupsOnly2[i];
+    }
 
-    return ok;
+    return message;
 }
 /*----------------------------------------------------------------------------*/
 void Compare2Meshes::
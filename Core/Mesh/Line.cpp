@@ -11,6 +11,7 @@
 #include "Mesh/Line.h"
 #include "Mesh/MeshDisplayRepresentation.h"
 #include "Mesh/MeshImplementation.h"
+#include "Mesh/NodeFilter.h"
 #include "Mesh/CommandCreateMesh.h"
 #include "Utils/Common.h"
 #include "Utils/Bounds.h"
@@ -185,10 +186,19 @@ void Line::getGMDSEdges(std::vector<gmds::Edge >& AEdges) const
     }
 }
 /*----------------------------------------------------------------------------*/
+void Line::getGMDSEdgesView(MeshGroupView<gmds::Edge>& view) const
+{
+    std::vector<Topo::CoEdge* > coEdges;
+    getCoEdges(coEdges);
+
+    for(unsigned int iCoEdge=0; iCoEdge<coEdges.size(); iCoEdge++)
+        view.add(coEdges[iCoEdge]->edges());
+}
+/*----------------------------------------------------------------------------*/
 void Line::getGMDSNodes(std::vector<gmds::Node >& ANodes) const
 {
-	std::map<gmds::TCellID, uint> filtre;
 	std::vector<gmds::Edge> AEdges;
+	getGMDSEdges(AEdges);
 
     Mesh::MeshItf*              meshItf     = getMeshManager ( ).getMesh ( );
     Mesh::MeshImplementation*   meshImpl    =
@@ -196,15 +206,16 @@ void Line::getGMDSNodes(std::vector<gmds::Node >& ANodes) const
     CHECK_NULL_PTR_ERROR(meshImpl);
     gmds::IGMesh& gmdsMesh = meshImpl->getGMDSMesh();
 
+	NodeSet filtre(gmdsMesh.getMaxLocalID(0)+1, 2*AEdges.size());
+	std::vector<gmds::TCellID> nodes;
+
     for(std::vector<gmds::Edge>::const_iterator iter=AEdges.begin();
 			iter!=AEdges.end();++iter) {
-		std::vector<gmds::TCellID> nodes  = (iter)->getAllIDs<gmds::Node>();
-		for(unsigned int iNode=0; iNode<nodes.size(); iNode++) {
-			if (filtre[nodes[iNode]] == 0){
+		nodes.clear();
+		(iter)->getAllIDs<gmds::Node>(nodes);
+		for(unsigned int iNode=0; iNode<nodes.size(); iNode++)
+			if (filtre.insert(nodes[iNode]))
 				ANodes.push_back(gmdsMesh.get<gmds::Node>(nodes[iNode]));
-				filtre[nodes[iNode]] = 1;
-			}
-		}
 	}
 }
 /*----------------------------------------------------------------------------*/
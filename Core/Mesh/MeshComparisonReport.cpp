@@ -0,0 +1,106 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MeshComparisonReport.cpp
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Mesh/MeshComparisonReport.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/// vérifie que dim est une dimension de cellule
+static void checkDimension(int dim)
+{
+    if (dim < 0 || dim > 3){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "Dimension " << (long)dim << " non prévue pour MeshComparisonReport (0 à 3)";
+        throw TkUtil::Exception (message);
+    }
+}
+/*----------------------------------------------------------------------------*/
+MeshComparisonReport::MeshComparisonReport()
+: ok(true), tolerance(0.0)
+{
+    for (int i=0; i<4; i++){
+        nb_cells1[i] = nb_cells2[i] = 0;
+        nb_unmatched1[i] = nb_unmatched2[i] = 0;
+        max_deviation[i] = mean_deviation[i] = 0.0;
+    }
+}
+/*----------------------------------------------------------------------------*/
+bool MeshComparisonReport::isOk() const
+{
+    return ok;
+}
+/*----------------------------------------------------------------------------*/
+double MeshComparisonReport::getTolerance() const
+{
+    return tolerance;
+}
+/*----------------------------------------------------------------------------*/
+long MeshComparisonReport::getNbCells1(int dim) const
+{
+    checkDimension(dim);
+    return nb_cells1[dim];
+}
+/*----------------------------------------------------------------------------*/
+long MeshComparisonReport::getNbCells2(int dim) const
+{
+    checkDimension(dim);
+    return nb_cells2[dim];
+}
+/*----------------------------------------------------------------------------*/
+long MeshComparisonReport::getNbUnmatched1(int dim) const
+{
+    checkDimension(dim);
+    return nb_unmatched1[dim];
+}
+/*----------------------------------------------------------------------------*/
+long MeshComparisonReport::getNbUnmatched2(int dim) const
+{
+    checkDimension(dim);
+    return nb_unmatched2[dim];
+}
+/*----------------------------------------------------------------------------*/
+double MeshComparisonReport::getMaxDeviation(int dim) const
+{
+    checkDimension(dim);
+    return max_deviation[dim];
+}
+/*----------------------------------------------------------------------------*/
+double MeshComparisonReport::getMeanDeviation(int dim) const
+{
+    checkDimension(dim);
+    return mean_deviation[dim];
+}
+/*----------------------------------------------------------------------------*/
+std::vector<std::string> MeshComparisonReport::getDifferentGroups() const
+{
+    return different_groups;
+}
+/*----------------------------------------------------------------------------*/
+std::vector<std::string> MeshComparisonReport::getGroupsOnly1() const
+{
+    return groups_only1;
+}
+/*----------------------------------------------------------------------------*/
+std::vector<std::string> MeshComparisonReport::getGroupsOnly2() const
+{
+    return groups_only2;
+}
+/*----------------------------------------------------------------------------*/
+std::string MeshComparisonReport::toString() const
+{
+    return description;
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -9,6 +9,7 @@
 /*----------------------------------------------------------------------------*/
 #include "Internal/ContextIfc.h"
 #include "Mesh/MeshEntity.h"
+#include "Mesh/MeshLevelOfDetail.h"
 #include <TkUtil/MemoryError.h>
 #include "Utils/SerializedRepresentation.h"
 #include "Internal/Context.h"
@@ -25,7 +26,7 @@ MeshEntity(Internal::Context& ctx,
                   Utils::DisplayProperties* disp)
 : Internal::InternalEntity (ctx, prop, disp)
 , m_mesh_manager(&(ctx.getMeshManager())), m_bounds_to_be_calculate(true)
-, m_nodesValuesNames ( ), m_cellsValuesNames ( )
+, m_nodesValuesNames ( ), m_cellsValuesNames ( ), m_lod ( ), m_lodMutex ( )
 {
 	for (uint i=0; i<6; i++)
 		m_bounds[i] = 0.0;
@@ -37,6 +38,15 @@ MeshEntity::
     // on pourrait le supprimer du maillage, mais il risque de ne plus y être ... à suivre
 }
 /*----------------------------------------------------------------------------*/
+void MeshEntity::meshModified()
+{
+    m_bounds_to_be_calculate = true;
+
+    // une représentation en cours d'utilisation reste valide jusqu'à sa libération
+    TkUtil::AutoMutex autoMutex (&m_lodMutex);
+    m_lod.reset();
+}
+/*----------------------------------------------------------------------------*/
 void MeshEntity::getBounds (double bounds[6]) const
 {
 	Entity::getBounds (bounds);	// RAZ
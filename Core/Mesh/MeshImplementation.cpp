@@ -15,9 +15,13 @@
 
 #include "Smoothing/MesquiteMeshImplAdapter.h"
 #include "Smoothing/MesquiteDomainImplAdapter.h"
+#include "Smoothing/VolumicSmoothing.h"
+#include "Mesh/NodeFilter.h"
 
 #include "Topo/Block.h"
 #include "Topo/Face.h"
+#include "Topo/CoFace.h"
+#include "Topo/CoEdge.h"
 #include "Topo/Edge.h"
 #include "Topo/Vertex.h"
 #include "Topo/TopoHelper.h"
@@ -25,6 +29,7 @@
 #include "Utils/Common.h"
 #include "Utils/MgxNumeric.h"
 #include "Utils/MgxException.h"
+#include "Utils/ParallelExecution.h"
 
 #include "Internal/Context.h"
 #include "Geom/GeomEntity.h"
@@ -43,6 +48,7 @@
 /*----------------------------------------------------------------------------*/
 /// TkUtil
 #include <TkUtil/Exception.h>
+#include <TkUtil/File.h>
 #include <TkUtil/UTF8String.h>
 #include <TkUtil/TraceLog.h>
 
@@ -73,6 +79,13 @@
 /*----------------------------------------------------------------------------*/
 /// CGNS
 #include "cgnslib.h"
+/*----------------------------------------------------------------------------*/
+#include <thread>
+#include <exception>
+#include <unordered_map>
+#include <algorithm>
+#include <set>
+#include <fstream>
 
 /*----------------------------------------------------------------------------*/
 //#define _DEBUG_MESH
@@ -219,6 +232,7 @@ bool MeshImplementation::createGMDSGroups()
     std::cout<<"MeshImplementation::createGMDSGroups()"<<std::endl;
     // création des clouds, lines, surfaces et volumes gmds correspondants aux
     // Mgx3D::Mesh::Cloud, Line, Surface et Volume
+    // les cellules sont parcourues via des vues sur les groupes, sans copie intermédiaire
 
     std::vector<Mesh::Cloud*> clouds;
     getContext().getLocalMeshManager().getClouds(clouds);
@@ -234,21 +248,32 @@ bool MeshImplementation::createGMDSGroups()
     std::vector<gmds::IGMesh::surface*> createdGMDSSurfaces;
     std::vector<gmds::IGMesh::volume*> createdGMDSVolumes;
 
+    gmds::IGMesh& gmdsMesh = getGMDSMesh();
+
     try {
 
+    // filtre pour éviter de mettre 2 fois (ou plus) un même noeud dans un nuage
+    std::vector<bool> filtre;
+    if (!clouds.empty())
+        filtre.resize(gmdsMesh.getMaxLocalID(0)+1, false);
+
     for(unsigned int iCloud=0; iCloud<clouds.size(); iCloud++) {
         Mesh::Cloud* current_cloud = clouds[iCloud];
         // modification du nom du nuage pour éviter les conflits avec les noms de ligne
         std::string cloudName = current_cloud->getName() + std::string("ND");
-        gmds::IGMesh::cloud& cl = getGMDSMesh().newCloud(cloudName);
+        gmds::IGMesh::cloud& cl = gmdsMesh.newCloud(cloudName);
         createdGMDSClouds.push_back(&cl);
 
-        std::vector<gmds::Node> nodes;
-        current_cloud->getGMDSNodes(nodes);
+        MeshGroupView<gmds::Node> nodes;
+        current_cloud->getGMDSNodesView(nodes);
 
-        for(unsigned int iNode=0; iNode<nodes.size(); iNode++) {
-            cl.add(nodes[iNode]);
-        }
+        nodes.forEach([&](gmds::TCellID id) {
+            if (!filtre[id]){
+                cl.add(gmdsMesh.get<gmds::Node>(id));
+                filtre[id] = true;
+            }
+        });
+        nodes.forEach([&](gmds::TCellID id) {filtre[id] = false;});
     }
 
 //    std::string lineDefaultName = getContext().getLocalGroupManager().getDefaultName(1);
@@ -259,47 +284,35 @@ bool MeshImplementation::createGMDSGroups()
 //        if (lines.size() > 1 && current_line->getName() == lineDefaultName)
 //            continue;
 
-        gmds::IGMesh::line& ln = getGMDSMesh().newLine(current_line->getName());
+        gmds::IGMesh::line& ln = gmdsMesh.newLine(current_line->getName());
         createdGMDSLines.push_back(&ln);
 
-        std::vector<gmds::Edge> edges;
-        current_line->getGMDSEdges(edges);
+        MeshGroupView<gmds::Edge> edges;
+        current_line->getGMDSEdgesView(edges);
 
-        for(unsigned int iEdge=0; iEdge<edges.size(); iEdge++) {
-            ln.add(edges[iEdge]);
-        }
+        edges.forEach([&](gmds::TCellID id) {ln.add(gmdsMesh.get<gmds::Edge>(id));});
     }
 
     for(unsigned int iSurf=0; iSurf<surfaces.size(); iSurf++) {
         Mesh::Surface* current_surf = surfaces[iSurf];
-        gmds::IGMesh::surface& su = getGMDSMesh().newSurface(current_surf->getName());
+        gmds::IGMesh::surface& su = gmdsMesh.newSurface(current_surf->getName());
         createdGMDSSurfaces.push_back(&su);
 
-        std::vector<Topo::CoFace* > coFaces;
-        current_surf->getCoFaces(coFaces);
+        MeshGroupView<gmds::Face> faces;
+        current_surf->getGMDSFacesView(faces);
 
-        std::vector<gmds::Face> faces;
-        current_surf->getGMDSFaces(faces);
-
-        for(unsigned int iFace=0; iFace<faces.size(); iFace++) {
-            su.add(faces[iFace]);
-        }
+        faces.forEach([&](gmds::TCellID id) {su.add(gmdsMesh.get<gmds::Face>(id));});
     }
 
     for(unsigned int iVol=0; iVol<volumes.size(); iVol++) {
         Mesh::Volume* current_vol = volumes[iVol];
-        gmds::IGMesh::volume& vo = getGMDSMesh().newVolume(current_vol->getName());
+        gmds::IGMesh::volume& vo = gmdsMesh.newVolume(current_vol->getName());
         createdGMDSVolumes.push_back(&vo);
 
-        std::vector<Topo::Block* > blocks;
-        current_vol->getBlocks(blocks);
+        MeshGroupView<gmds::Region> regions;
+        current_vol->getGMDSRegionsView(regions);
 
-        std::vector<gmds::Region> regions;
-        current_vol->getGMDSRegions(regions);
-
-        for(unsigned int iRegion=0; iRegion<regions.size(); iRegion++) {
-            vo.add(regions[iRegion]);
-        }
+        regions.forEach([&](gmds::TCellID id) {vo.add(gmdsMesh.get<gmds::Region>(id));});
     }
 
     } // try
@@ -380,7 +393,41 @@ void MeshImplementation::readVTK(std::string nom, uint id)
 	}
 }
 /*----------------------------------------------------------------------------*/
+/// type de cellule VTK pour un type de polyèdre ou de polygone gmds, 0 si non supporté
+static int getVTKCellType(gmds::ECellType type)
+{
+	switch (type){
+	case gmds::GMDS_TETRA:    return 10; // VTK_TETRA
+	case gmds::GMDS_HEX:      return 12; // VTK_HEXAHEDRON
+	case gmds::GMDS_PRISM3:   return 13; // VTK_WEDGE
+	case gmds::GMDS_PYRAMID:  return 14; // VTK_PYRAMID
+	case gmds::GMDS_TRIANGLE: return 5;  // VTK_TRIANGLE
+	case gmds::GMDS_QUAD:     return 9;  // VTK_QUAD
+	default:
+		return 0;
+	}
+}
+/*----------------------------------------------------------------------------*/
+/// nom d'un champ VTK (sans blanc)
+static std::string getVTKName(const std::string& nom)
+{
+	std::string nom_vtk(nom);
+	std::replace(nom_vtk.begin(), nom_vtk.end(), ' ', '_');
+	return nom_vtk;
+}
+/*----------------------------------------------------------------------------*/
 void MeshImplementation::writeVTK(std::string nom)
+{
+	std::string extension = TkUtil::File(nom).getExtension();
+	std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+	if (extension == "vtk")
+		_writeLegacyVTK(nom);
+	else
+		_writeGMDSVTK(nom);
+}
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::_writeGMDSVTK(std::string nom)
 {
     // on ajoute les groupes de mailles de gmds
 	bool isCreateGMDSGroupsOK = createGMDSGroups();
@@ -406,6 +453,243 @@ void MeshImplementation::writeVTK(std::string nom)
     deleteGMDSGroups();
 }
 /*----------------------------------------------------------------------------*/
+void MeshImplementation::_writeLegacyVTK(std::string nom)
+{
+	// écriture directe au format VTK (legacy, ascii) des polyèdres, des polygones
+	// et des bras des lignes.
+	// Les groupes de mailles sont parcourus via des vues (sans création de groupes gmds)
+	// et écrits comme des champs aux mailles (volumes, surfaces et lignes)
+	// ou aux noeuds (nuages)
+	gmds::IGMesh& gmdsMesh = getGMDSMesh();
+
+	std::ofstream fichier(nom.c_str(), std::ios::out | std::ios::trunc);
+	if (!fichier.is_open()){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Pb lors de l'export VTK, impossible d'ouvrir le fichier "<<nom
+				<< "\nCela peut venir d'un chemin incorrect ou d'un problème de permissions.";
+		throw TkUtil::Exception (message);
+	}
+	fichier.precision(15);
+
+	fichier << "# vtk DataFile Version 2.0\n"
+			<< "Magix3D\n"
+			<< "ASCII\n"
+			<< "DATASET UNSTRUCTURED_GRID\n";
+
+	// les noeuds, numérotés de manière contigüe (les id gmds peuvent avoir des trous)
+	std::vector<int> indices_noeuds(gmdsMesh.getMaxLocalID(0)+1, -1);
+	fichier << "POINTS "<<(long)gmdsMesh.getNbNodes()<<" double\n";
+	int nb_noeuds = 0;
+	for (gmds::IGMesh::node_iterator itn = gmdsMesh.nodes_begin(); !itn.isDone(); itn.next()){
+		gmds::Node nd = itn.value();
+		indices_noeuds[nd.getID()] = nb_noeuds++;
+		fichier << nd.X() << " " << nd.Y() << " " << nd.Z() << "\n";
+	}
+
+	// les polyèdres puis les polygones
+	long nb_regions = 0, nb_faces = 0, taille = 0;
+	for (gmds::IGMesh::region_iterator itr = gmdsMesh.regions_begin(); !itr.isDone(); itr.next()){
+		gmds::Region r = itr.value();
+		if (getVTKCellType(r.getType()) == 0){
+			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+			message << "Pb lors de l'export VTK, type de polyèdre non supporté pour la région "<<(long)r.getID();
+			throw TkUtil::Exception (message);
+		}
+		nb_regions++;
+		taille += r.getNbNodes()+1;
+	}
+	for (gmds::IGMesh::face_iterator itf = gmdsMesh.faces_begin(); !itf.isDone(); itf.next()){
+		nb_faces++;
+		taille += itf.value().getNbNodes()+1;
+	}
+
+	// les bras des lignes, chacun une seule fois même s'il est dans plusieurs lignes
+	std::vector<Mesh::Line*> lines;
+	getContext().getLocalMeshManager().getLines(lines);
+	std::vector<gmds::TCellID> bras;
+	std::vector<char> filtre_bras(lines.empty() ? 0 : gmdsMesh.getMaxLocalID(1)+1, 0);
+	for (uint i=0; i<lines.size(); i++){
+		MeshGroupView<gmds::Edge> edges;
+		lines[i]->getGMDSEdgesView(edges);
+		edges.forEach([&](gmds::TCellID id) {
+			if (!filtre_bras[id]){
+				filtre_bras[id] = 1;
+				bras.push_back(id);
+			}
+		});
+	}
+	const long nb_bras = bras.size();
+	taille += 3*nb_bras;
+	const long nb_cellules = nb_regions+nb_faces+nb_bras;
+
+	fichier << "CELLS "<<nb_cellules<<" "<<taille<<"\n";
+	std::vector<gmds::TCellID> nds;
+	for (gmds::IGMesh::region_iterator itr = gmdsMesh.regions_begin(); !itr.isDone(); itr.next()){
+		nds = itr.value().getIDs<gmds::Node>();
+		fichier << nds.size();
+		for (uint i=0; i<nds.size(); i++)
+			fichier << " " << indices_noeuds[nds[i]];
+		fichier << "\n";
+	}
+	for (gmds::IGMesh::face_iterator itf = gmdsMesh.faces_begin(); !itf.isDone(); itf.next()){
+		nds = itf.value().getIDs<gmds::Node>();
+		fichier << nds.size();
+		for (uint i=0; i<nds.size(); i++)
+			fichier << " " << indices_noeuds[nds[i]];
+		fichier << "\n";
+	}
+	for (long j=0; j<nb_bras; j++){
+		nds = gmdsMesh.get<gmds::Edge>(bras[j]).getIDs<gmds::Node>();
+		fichier << "2 " << indices_noeuds[nds[0]] << " " << indices_noeuds[nds[1]] << "\n";
+	}
+	std::vector<int>().swap(indices_noeuds);
+
+	fichier << "CELL_TYPES "<<nb_cellules<<"\n";
+	for (gmds::IGMesh::region_iterator itr = gmdsMesh.regions_begin(); !itr.isDone(); itr.next())
+		fichier << getVTKCellType(itr.value().getType()) << "\n";
+	for (gmds::IGMesh::face_iterator itf = gmdsMesh.faces_begin(); !itf.isDone(); itf.next()){
+		int type = getVTKCellType(itf.value().getType());
+		fichier << (type ? type : 7) << "\n"; // VTK_POLYGON
+	}
+	for (long j=0; j<nb_bras; j++)
+		fichier << "3\n"; // VTK_LINE
+
+	// les volumes et les surfaces, un champ aux mailles par groupe
+	std::vector<Mesh::Surface*> surfaces;
+	getContext().getLocalMeshManager().getSurfaces(surfaces);
+	std::vector<Mesh::Volume*> volumes;
+	getContext().getLocalMeshManager().getVolumes(volumes);
+
+	if (nb_cellules && (!volumes.empty() || !surfaces.empty() || !lines.empty())){
+		fichier << "CELL_DATA "<<nb_cellules<<"\n";
+
+		std::vector<char> filtre_regions(volumes.empty() ? 0 : gmdsMesh.getMaxLocalID(3)+1, 0);
+		for (uint i=0; i<volumes.size(); i++){
+			MeshGroupView<gmds::Region> regions;
+			volumes[i]->getGMDSRegionsView(regions);
+			regions.forEach([&](gmds::TCellID id) {filtre_regions[id] = 1;});
+
+			fichier << "SCALARS "<<getVTKName(volumes[i]->getName())<<" int 1\nLOOKUP_TABLE default\n";
+			for (gmds::IGMesh::region_iterator itr = gmdsMesh.regions_begin(); !itr.isDone(); itr.next())
+				fichier << (int)filtre_regions[itr.value().getID()] << "\n";
+			for (long j=0; j<nb_faces+nb_bras; j++)
+				fichier << "0\n";
+
+			regions.forEach([&](gmds::TCellID id) {filtre_regions[id] = 0;});
+		}
+
+		std::vector<char> filtre_faces(surfaces.empty() ? 0 : gmdsMesh.getMaxLocalID(2)+1, 0);
+		for (uint i=0; i<surfaces.size(); i++){
+			MeshGroupView<gmds::Face> faces;
+			surfaces[i]->getGMDSFacesView(faces);
+			faces.forEach([&](gmds::TCellID id) {filtre_faces[id] = 1;});
+
+			fichier << "SCALARS "<<getVTKName(surfaces[i]->getName())<<" int 1\nLOOKUP_TABLE default\n";
+			for (long j=0; j<nb_regions; j++)
+				fichier << "0\n";
+			for (gmds::IGMesh::face_iterator itf = gmdsMesh.faces_begin(); !itf.isDone(); itf.next())
+				fichier << (int)filtre_faces[itf.value().getID()] << "\n";
+			for (long j=0; j<nb_bras; j++)
+				fichier << "0\n";
+
+			faces.forEach([&](gmds::TCellID id) {filtre_faces[id] = 0;});
+		}
+
+		// filtre_bras est remis à 0 avant d'y marquer chacune des lignes
+		for (long j=0; j<nb_bras; j++)
+			filtre_bras[bras[j]] = 0;
+		for (uint i=0; i<lines.size(); i++){
+			MeshGroupView<gmds::Edge> edges;
+			lines[i]->getGMDSEdgesView(edges);
+			edges.forEach([&](gmds::TCellID id) {filtre_bras[id] = 1;});
+
+			fichier << "SCALARS "<<getVTKName(lines[i]->getName())<<" int 1\nLOOKUP_TABLE default\n";
+			for (long j=0; j<nb_regions+nb_faces; j++)
+				fichier << "0\n";
+			for (long j=0; j<nb_bras; j++)
+				fichier << (int)filtre_bras[bras[j]] << "\n";
+
+			edges.forEach([&](gmds::TCellID id) {filtre_bras[id] = 0;});
+		}
+	}
+
+	// les nuages, un champ aux noeuds par groupe
+	std::vector<Mesh::Cloud*> clouds;
+	getContext().getLocalMeshManager().getClouds(clouds);
+
+	if (nb_noeuds && !clouds.empty()){
+		fichier << "POINT_DATA "<<nb_noeuds<<"\n";
+
+		std::vector<char> filtre_noeuds(gmdsMesh.getMaxLocalID(0)+1, 0);
+		for (uint i=0; i<clouds.size(); i++){
+			MeshGroupView<gmds::Node> noeuds;
+			clouds[i]->getGMDSNodesView(noeuds);
+			noeuds.forEach([&](gmds::TCellID id) {filtre_noeuds[id] = 1;});
+
+			fichier << "SCALARS "<<getVTKName(clouds[i]->getName())<<" int 1\nLOOKUP_TABLE default\n";
+			for (gmds::IGMesh::node_iterator itn = gmdsMesh.nodes_begin(); !itn.isDone(); itn.next())
+				fichier << (int)filtre_noeuds[itn.value().getID()] << "\n";
+
+			noeuds.forEach([&](gmds::TCellID id) {filtre_noeuds[id] = 0;});
+		}
+	}
+
+	fichier.close();
+	if (fichier.fail()){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Pb lors de l'export VTK dans le fichier "<<nom
+				<< "\nCela peut venir d'un problème de quota.";
+		throw TkUtil::Exception (message);
+	}
+}
+/*----------------------------------------------------------------------------*/
+/// nombre maximum de noeuds d'un lot de zones dont les coordonnées sont en mémoire lors de l'export CGNS
+#define NB_NOEUDS_MAX_LOT_CGNS 8000000
+/// nombre de noeuds par tâche de récupération des coordonnées
+#define NB_NOEUDS_TACHE_CGNS 100000
+/*----------------------------------------------------------------------------*/
+/// une zone (bloc structuré) de l'export CGNS
+struct ZoneCGNS {
+	Topo::Block* bloc;
+	/// nombres de noeuds par direction
+	uint ni, nj, nk;
+	/// indice (i + j*ni + k*ni*nj) des noeuds au bord du bloc
+	std::unordered_map<gmds::TCellID, uint> indices;
+	/// coordonnées, présentes le temps d'écrire le lot de la zone
+	std::vector<double> xx, yy, zz;
+};
+/*----------------------------------------------------------------------------*/
+/// récupère les coordonnées des noeuds des zones [first, last[
+static void gatherCGNSCoords(gmds::IGMesh& gmdsMesh,
+		std::vector<ZoneCGNS>& zones, uint first, uint last)
+{
+	// découpage en tâches de taille bornée, y compris pour les gros blocs
+	std::vector<uint> tache_zone;
+	std::vector<uint> tache_debut;
+	for (uint iz=first; iz<last; iz++){
+		uint nbNoeuds = zones[iz].ni*zones[iz].nj*zones[iz].nk;
+		zones[iz].xx.resize(nbNoeuds);
+		zones[iz].yy.resize(nbNoeuds);
+		zones[iz].zz.resize(nbNoeuds);
+		for (uint deb=0; deb<nbNoeuds; deb+=NB_NOEUDS_TACHE_CGNS){
+			tache_zone.push_back(iz);
+			tache_debut.push_back(deb);
+		}
+	}
+
+	Utils::executeEnParallele(tache_zone.size(), [&](uint t){
+		ZoneCGNS& zone = zones[tache_zone[t]];
+		const std::vector<gmds::TCellID>& l_nds = zone.bloc->nodes();
+		uint fin = std::min(tache_debut[t]+NB_NOEUDS_TACHE_CGNS, (uint)l_nds.size());
+		for (uint i=tache_debut[t]; i<fin; i++){
+			gmds::Node current = gmdsMesh.get<gmds::Node>(l_nds[i]);
+			zone.xx[i] = current.X();
+			zone.yy[i] = current.Y();
+			zone.zz[i] = current.Z();
+		}
+	});
+}
+/*----------------------------------------------------------------------------*/
 void MeshImplementation::writeCGNS(std::string nom)
 {
 //#define _DEBUG_CGNS
@@ -418,33 +702,18 @@ void MeshImplementation::writeCGNS(std::string nom)
 	getContext().getLocalTopoManager().getBlocks(blocks, true);
 	gmds::IGMesh& gmdsMesh = getGMDSMesh();
 
-	int index_file, icelldim, iphysdim, index_base;
-
-	// cas 3D uniquement pour le moment
-	icelldim = 3;
-	iphysdim = 3;
-
-	if (cg_open(nom.c_str(), CG_MODE_WRITE, &index_file))
-		throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_open", TkUtil::Charset::UTF_8));
-
-	// un seul "noeud" basename dans l'arbre
-	char basename[33];
-	strcpy(basename,"BaseMGX3D");
-
-	if (cg_base_write(index_file,basename,icelldim,iphysdim,&index_base))
-		throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_base_write", TkUtil::Charset::UTF_8));
-
-	// on ajoute un à un tous les blocks maillés et structurés
+	// sélection des blocs maillés et structurés, chacun donne une zone,
+	// les autres blocs maillés (non structurés ou dégénérés) sont regroupés
+	// dans une zone non structurée
+	std::vector<ZoneCGNS> zones;
+	std::map<Topo::Block*, uint> zone_bloc;
+	std::vector<Topo::Block*> blocs_non_structures;
 	for (uint i=0; i<blocks.size(); i++){
 		Topo::Block* bloc = blocks[i];
-		if (bloc->isMeshed() && bloc->isStructured()){
-
-			if (bloc->getNbVertices() != 8){
-				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-				message << "Erreur dans MeshImplementation::writeCGNS, cas dégénéré non implémenté pour "
-						<<bloc->getName();
-				throw TkUtil::Exception (message);
-			}
+		if (bloc->isMeshed() && (!bloc->isStructured() || bloc->getNbVertices() != 8)){
+			blocs_non_structures.push_back(bloc);
+		}
+		else if (bloc->isMeshed() && bloc->isStructured()){
 
 			// nombres de bras par direction
 			uint ni, nj, nk;
@@ -453,10 +722,6 @@ void MeshImplementation::writeCGNS(std::string nom)
 			ni++; nj++; nk++;
 			uint nbNoeuds = ni*nj*nk;
 
-			double* xx = new double[nbNoeuds];
-			double* yy = new double[nbNoeuds];
-			double* zz = new double[nbNoeuds];
-
 			std::vector<gmds::TCellID>& l_nds = bloc->nodes();
 			if (l_nds.size() != nbNoeuds){
 				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
@@ -464,381 +729,480 @@ void MeshImplementation::writeCGNS(std::string nom)
 						<< (short)l_nds.size() << " != "<<(short)nbNoeuds<<" pour "<<bloc->getName();
 				throw TkUtil::Exception (message);
 			}
-			for (uint i=0; i<nbNoeuds; i++){
-				gmds::Node current = gmdsMesh.get<gmds::Node>(l_nds[i]);
-				xx[i] = current.X();
-				yy[i] = current.Y();
-				zz[i] = current.Z();
-			}
 
-			cgsize_t isize[9];
-			char zonename[33];
-			int index_coord, index_zone;
-
-			strcpy(zonename, bloc->getName().c_str());
-
-			/* vertex size */
-			isize[0]=ni;
-			isize[1]=nj;
-			isize[2]=nk;
-			/* cell size */
-			isize[3+0]=isize[0]-1;
-			isize[3+1]=isize[1]-1;
-			isize[3+2]=isize[2]-1;
-			/* boundary vertex size (always zero for structured grids) */
-			isize[6+0]=0;
-			isize[6+1]=0;
-			isize[6+2]=0;
+			zone_bloc[bloc] = zones.size();
+			zones.push_back(ZoneCGNS());
+			zones.back().bloc = bloc;
+			zones.back().ni = ni;
+			zones.back().nj = nj;
+			zones.back().nk = nk;
+		}
+		else {
+			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+			message << "Attention, pas de sauvegarde pour " <<bloc->getName();
+		    getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::WARNING));
+		}
+	} // end for i<blocks.size()
+
+	// indices des noeuds au bord des blocs, pour les raccords entre zones
+	Utils::executeEnParallele(zones.size(), [&](uint iz){
+		_buildIndexNodeMap(zones[iz].bloc->nodes(), zones[iz].ni, zones[iz].nj, zones[iz].nk,
+				zones[iz].indices);
+	});
+
+	// découpage en lots de zones consécutives au nombre de noeuds borné,
+	// lots[l] est la première zone du lot l, le dernier élément est zones.size()
+	std::vector<uint> lots;
+	uint nbNoeudsLot = 0;
+	for (uint iz=0; iz<zones.size(); iz++){
+		uint nbNoeuds = zones[iz].ni*zones[iz].nj*zones[iz].nk;
+		if (lots.empty() || nbNoeudsLot+nbNoeuds > NB_NOEUDS_MAX_LOT_CGNS){
+			lots.push_back(iz);
+			nbNoeudsLot = 0;
+		}
+		nbNoeudsLot += nbNoeuds;
+	}
+	lots.push_back(zones.size());
+
+	int index_file, icelldim, iphysdim, index_base;
+
+	// cas 3D uniquement pour le moment
+	icelldim = 3;
+	iphysdim = 3;
+
+	// format HDF5 pour le fichier multi-zones
+	// le type de fichier est global à la lib cgns, il n'est utilisé qu'à
+	// l'ouverture et on revient ensuite au type par défaut (CG_FILE_NONE,
+	// variable d'environnement CGNS_FILETYPE ou format de compilation)
+	if (cg_set_file_type(CG_FILE_HDF5)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Format HDF5 non disponible pour le CGNS, utilisation du format par défaut";
+		getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::WARNING));
+	}
+
+	int erreur_open = cg_open(nom.c_str(), CG_MODE_WRITE, &index_file);
+	cg_set_file_type(CG_FILE_NONE);
+	if (erreur_open)
+		throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_open", TkUtil::Charset::UTF_8));
+
+	// un seul "noeud" basename dans l'arbre
+	char basename[33];
+	strcpy(basename,"BaseMGX3D");
+
+	if (cg_base_write(index_file,basename,icelldim,iphysdim,&index_base))
+		throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_base_write", TkUtil::Charset::UTF_8));
+
+	// les coordonnées d'un lot sont récupérées (en parallèle) pendant l'écriture
+	// du lot précédent, seul ce thread accède au fichier
+	if (lots.size() > 1)
+		gatherCGNSCoords(gmdsMesh, zones, lots[0], lots[1]);
+
+	for (uint l=0; l+1<lots.size(); l++){
+		std::thread lot_suivant;
+		std::exception_ptr erreur_lot;
+		if (l+2 < lots.size())
+			lot_suivant = std::thread([&, l](){
+				try {
+					gatherCGNSCoords(gmdsMesh, zones, lots[l+1], lots[l+2]);
+				}
+				catch (...){
+					erreur_lot = std::current_exception();
+				}
+			});
+
+		try {
+			for (uint iz=lots[l]; iz<lots[l+1]; iz++){
+				ZoneCGNS& zone = zones[iz];
+				Topo::Block* bloc = zone.bloc;
+				uint ni = zone.ni;
+				uint nj = zone.nj;
+				uint nk = zone.nk;
+
+				cgsize_t isize[9];
+				char zonename[33];
+				int index_coord, index_zone;
+
+				strcpy(zonename, bloc->getName().c_str());
+
+				/* vertex size */
+				isize[0]=ni;
+				isize[1]=nj;
+				isize[2]=nk;
+				/* cell size */
+				isize[3+0]=isize[0]-1;
+				isize[3+1]=isize[1]-1;
+				isize[3+2]=isize[2]-1;
+				/* boundary vertex size (always zero for structured grids) */
+				isize[6+0]=0;
+				isize[6+1]=0;
+				isize[6+2]=0;
 
 #ifdef _DEBUG_CGNS
-			std::cout<<"cg_1to1_write("<<index_file<<", "<<index_base<<", "<<zonename
-					<<", ["<<isize[0]<<","<<isize[1]<<","<<isize[2]<<"])"<<std::endl;
+				std::cout<<"cg_1to1_write("<<index_file<<", "<<index_base<<", "<<zonename
+						<<", ["<<isize[0]<<","<<isize[1]<<","<<isize[2]<<"])"<<std::endl;
 #endif
-			if (cg_zone_write(index_file,index_base,zonename,isize,CGNS_ENUMT(ZoneType_t)::CGNS_ENUMT(Structured),&index_zone))
-				throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_zone_write", TkUtil::Charset::UTF_8));
+				if (cg_zone_write(index_file,index_base,zonename,isize,CGNS_ENUMT(ZoneType_t)::CGNS_ENUMT(Structured),&index_zone))
+					throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_zone_write", TkUtil::Charset::UTF_8));
 #ifdef _DEBUG_CGNS
-			std::cout<<" => index_zone = "<<index_zone<<std::endl;
+				std::cout<<" => index_zone = "<<index_zone<<std::endl;
 #endif
 
-			if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateX",xx,&index_coord))
-				throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write xx", TkUtil::Charset::UTF_8));
-			if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateY",yy,&index_coord))
-				throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write yy", TkUtil::Charset::UTF_8));
-			if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateZ",zz,&index_coord))
-				throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write zz", TkUtil::Charset::UTF_8));
-
-			delete [] xx;
-			delete [] yy;
-			delete [] zz;
-
-
-			// les relations avec les autres blocs
-			std::vector<Topo::CoFace*> cofaces;
-			bloc->getCoFaces(cofaces);
-			for (uint j=0; j<cofaces.size(); j++){
-				// on ne s'occupe que des cofaces entre 2 blocs
-				std::vector<Topo::Block*> coface_blocks;
-				cofaces[j]->getBlocks(coface_blocks);
-				if (coface_blocks.size() == 2){
-					Topo::CoFace* coface = cofaces[j];
-					Topo::Block* bloc_vois = (coface_blocks[0] == bloc?coface_blocks[1]:coface_blocks[0]);
-					cgsize_t ipnts[9]; // plus grand que nécessaire (6), ce qui permet de stocker l'"autre" sommet
-					cgsize_t ipntsdonor[9]; // autre sommet utile pour déterminer la transformation
-					int itranfrm[3];
-					int index_conn;
-
-					// initialisation par défaut ...
-					itranfrm[0] = 1;
-					itranfrm[1] = 2;
-					itranfrm[2] = 3;
-					for (uint k=0; k<9; k++){
-						ipnts[k] = 0;
-						ipntsdonor[k] = 0;
-					}
-
-					// recherche des indices de noeuds dans les blocs pour les extrémités (les sommets) des faces communes
-					std::vector<Topo::Vertex*> coface_vertices;
-					coface->getVertices(coface_vertices);
-
-					// stockage des indices par sommet
-					std::vector<std::vector<uint> > idxIJK_vertices;
-
-					// recherche des indices pour les 4 sommets et on renseigne ipnts (indices extrémas)
-					for (uint k=0; k<coface_vertices.size(); k++){
-						uint idxI, idxJ, idxK;
-						gmds::TCellID node_id = coface_vertices[k]->getNode();
-
-						_getIndexNode(node_id,
-								bloc->nodes(), ni, nj, nk,
-								idxI, idxJ, idxK);
-						std::vector<uint> idxIJK;
-						idxIJK.push_back(idxI);
-						idxIJK.push_back(idxJ);
-						idxIJK.push_back(idxK);
-						idxIJK_vertices.push_back(idxIJK);
+				if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateX",zone.xx.data(),&index_coord))
+					throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write xx", TkUtil::Charset::UTF_8));
+				if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateY",zone.yy.data(),&index_coord))
+					throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write yy", TkUtil::Charset::UTF_8));
+				if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateZ",zone.zz.data(),&index_coord))
+					throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write zz", TkUtil::Charset::UTF_8));
+
+				// libération des coordonnées de la zone
+				std::vector<double>().swap(zone.xx);
+				std::vector<double>().swap(zone.yy);
+				std::vector<double>().swap(zone.zz);
+
+
+				// les relations avec les autres blocs
+				std::vector<Topo::CoFace*> cofaces;
+				bloc->getCoFaces(cofaces);
+				for (uint j=0; j<cofaces.size(); j++){
+					// on ne s'occupe que des cofaces entre 2 blocs
+					std::vector<Topo::Block*> coface_blocks;
+					cofaces[j]->getBlocks(coface_blocks);
+					if (coface_blocks.size() == 2){
+						Topo::CoFace* coface = cofaces[j];
+						Topo::Block* bloc_vois = (coface_blocks[0] == bloc?coface_blocks[1]:coface_blocks[0]);
+						// pas de raccord 1 à 1 avec la zone non structurée
+						std::map<Topo::Block*, uint>::iterator iter_vois = zone_bloc.find(bloc_vois);
+						if (iter_vois == zone_bloc.end())
+							continue;
+						cgsize_t ipnts[9]; // plus grand que nécessaire (6), ce qui permet de stocker l'"autre" sommet
+						cgsize_t ipntsdonor[9]; // autre sommet utile pour déterminer la transformation
+						int itranfrm[3];
+						int index_conn;
+
+						// initialisation par défaut ...
+						itranfrm[0] = 1;
+						itranfrm[1] = 2;
+						itranfrm[2] = 3;
+						for (uint k=0; k<9; k++){
+							ipnts[k] = 0;
+							ipntsdonor[k] = 0;
+						}
+
+						// recherche des indices de noeuds dans les blocs pour les extrémités (les sommets) des faces communes
+						std::vector<Topo::Vertex*> coface_vertices;
+						coface->getVertices(coface_vertices);
+
+						// stockage des indices par sommet
+						std::vector<std::vector<uint> > idxIJK_vertices;
+
+						// recherche des indices pour les 4 sommets et on renseigne ipnts (indices extrémas)
+						for (uint k=0; k<coface_vertices.size(); k++){
+							uint idxI, idxJ, idxK;
+							gmds::TCellID node_id = coface_vertices[k]->getNode();
+
+							_getIndexNode(node_id,
+									zone.indices, ni, nj,
+									idxI, idxJ, idxK);
+							std::vector<uint> idxIJK;
+							idxIJK.push_back(idxI);
+							idxIJK.push_back(idxJ);
+							idxIJK.push_back(idxK);
+							idxIJK_vertices.push_back(idxIJK);
 #ifdef _DEBUG_CGNS
-						std::cout<<" relation entre "<<bloc->getName()
-								<<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
-								<<" ni "<<ni<<", nj "<<nj<<", nk "<<nk
-								<<" pour sommet "<<coface_vertices[k]->getName()<<" node_id "<<(long)node_id
-								<<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
-								<<std::endl;
+							std::cout<<" relation entre "<<bloc->getName()
+									<<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
+									<<" ni "<<ni<<", nj "<<nj<<", nk "<<nk
+									<<" pour sommet "<<coface_vertices[k]->getName()<<" node_id "<<(long)node_id
+									<<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
+									<<std::endl;
 #endif
 
-						if (k==0){
-							ipnts[0+0] = idxI;
-							ipnts[3+0] = idxI;
-							ipnts[0+1] = idxJ;
-							ipnts[3+1] = idxJ;
-							ipnts[0+2] = idxK;
-							ipnts[3+2] = idxK;
-						}
-						else {
-							if (ipnts[0+0] > idxI) ipnts[0+0] = idxI;
-							if (ipnts[3+0] < idxI) ipnts[3+0] = idxI;
-							if (ipnts[0+1] > idxJ) ipnts[0+1] = idxJ;
-							if (ipnts[3+1] < idxJ) ipnts[3+1] = idxJ;
-							if (ipnts[0+2] > idxK) ipnts[0+2] = idxK;
-							if (ipnts[3+2] < idxK) ipnts[3+2] = idxK;
+							if (k==0){
+								ipnts[0+0] = idxI;
+								ipnts[3+0] = idxI;
+								ipnts[0+1] = idxJ;
+								ipnts[3+1] = idxJ;
+								ipnts[0+2] = idxK;
+								ipnts[3+2] = idxK;
+							}
+							else {
+								if (ipnts[0+0] > idxI) ipnts[0+0] = idxI;
+								if (ipnts[3+0] < idxI) ipnts[3+0] = idxI;
+								if (ipnts[0+1] > idxJ) ipnts[0+1] = idxJ;
+								if (ipnts[3+1] < idxJ) ipnts[3+1] = idxJ;
+								if (ipnts[0+2] > idxK) ipnts[0+2] = idxK;
+								if (ipnts[3+2] < idxK) ipnts[3+2] = idxK;
+							}
+
+						} // end for k<coface_vertices.size()
+
+						// recherche à partir des extrémas du sommet et donc du noeud correspondant
+						uint ipnts1[3];  // tableau intermédiaire qui évite entre autre de définir cgsize_t dans le .h
+						uint ipnts2[3];
+						for (uint k=0; k<3; k++){
+							ipnts1[k] = ipnts[k];
+							ipnts2[k] = ipnts[3+k];
 						}
-
-					} // end for k<coface_vertices.size()
-
-					// recherche à partir des extrémas du sommet et donc du noeud correspondant
-					uint ipnts1[3];  // tableau intermédiaire qui évite entre autre de définir cgsize_t dans le .h
-					uint ipnts2[3];
-					for (uint k=0; k<3; k++){
-						ipnts1[k] = ipnts[k];
-						ipnts2[k] = ipnts[3+k];
-					}
-					uint ind_min = _getIndiceIJK(idxIJK_vertices, ipnts1);
-					uint ind_max = _getIndiceIJK(idxIJK_vertices, ipnts2);
-
-					gmds::TCellID node_min = coface_vertices[ind_min]->getNode();
-					gmds::TCellID node_max = coface_vertices[ind_max]->getNode();
-
-					// renseigne les ipntsdonor (indices extrémas dans bloc voisin)
-					uint ni_vois, nj_vois, nk_vois;
-					bloc_vois->getNbMeshingEdges(ni_vois, nj_vois, nk_vois);
-					ni_vois++; nj_vois++; nk_vois++;
-					{
-						uint idxI, idxJ, idxK;
-						_getIndexNode(node_min,
-								bloc_vois->nodes(), ni_vois, nj_vois, nk_vois,
-								idxI, idxJ, idxK);
-						ipntsdonor[0] = idxI;
-						ipntsdonor[1] = idxJ;
-						ipntsdonor[2] = idxK;
+						uint ind_min = _getIndiceIJK(idxIJK_vertices, ipnts1);
+						uint ind_max = _getIndiceIJK(idxIJK_vertices, ipnts2);
+
+						gmds::TCellID node_min = coface_vertices[ind_min]->getNode();
+						gmds::TCellID node_max = coface_vertices[ind_max]->getNode();
+
+						// renseigne les ipntsdonor (indices extrémas dans bloc voisin)
+						uint ni_vois, nj_vois, nk_vois;
+						bloc_vois->getNbMeshingEdges(ni_vois, nj_vois, nk_vois);
+						ni_vois++; nj_vois++; nk_vois++;
+						const std::unordered_map<gmds::TCellID, uint>& indices_vois =
+								zones[iter_vois->second].indices;
+						{
+							uint idxI, idxJ, idxK;
+							_getIndexNode(node_min,
+									indices_vois, ni_vois, nj_vois,
+									idxI, idxJ, idxK);
+							ipntsdonor[0] = idxI;
+							ipntsdonor[1] = idxJ;
+							ipntsdonor[2] = idxK;
 #ifdef _DEBUG_CGNS
-						std::cout<<" relation réciproque "<<bloc->getName()
-								<<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
-								<<" ni (vois) "<<ni_vois<<", nj "<<nj_vois<<", nk "<<nk_vois
-								<<" node_min "<<(long)node_min
-								<<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
-								<<std::endl;
+							std::cout<<" relation réciproque "<<bloc->getName()
+									<<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
+									<<" ni (vois) "<<ni_vois<<", nj "<<nj_vois<<", nk "<<nk_vois
+									<<" node_min "<<(long)node_min
+									<<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
+									<<std::endl;
 #endif
 
-					}
-					{
-						uint idxI, idxJ, idxK;
-						_getIndexNode(node_max,
-								bloc_vois->nodes(), ni_vois, nj_vois, nk_vois,
-								idxI, idxJ, idxK);
-						ipntsdonor[3+0] = idxI;
-						ipntsdonor[3+1] = idxJ;
-						ipntsdonor[3+2] = idxK;
+						}
+						{
+							uint idxI, idxJ, idxK;
+							_getIndexNode(node_max,
+									indices_vois, ni_vois, nj_vois,
+									idxI, idxJ, idxK);
+							ipntsdonor[3+0] = idxI;
+							ipntsdonor[3+1] = idxJ;
+							ipntsdonor[3+2] = idxK;
 #ifdef _DEBUG_CGNS
-						std::cout<<" relation réciproque "<<bloc->getName()
-								<<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
-								<<" ni (vois) "<<ni_vois<<", nj "<<nj_vois<<", nk "<<nk_vois
-								<<" node_max "<<(long)node_max
-								<<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
-								<<std::endl;
+							std::cout<<" relation réciproque "<<bloc->getName()
+									<<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
+									<<" ni (vois) "<<ni_vois<<", nj "<<nj_vois<<", nk "<<nk_vois
+									<<" node_max "<<(long)node_max
+									<<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
+									<<std::endl;
 #endif
-					}
-
-					char connectname[33];
-					strcpy(connectname, coface->getName().c_str());
-
-					char donorname[33];
-					strcpy(donorname, bloc_vois->getName().c_str());
-
-					// on met les indices ++ pour être >0
-					for (uint k=0; k<6; k++){
-						ipnts[k]++;
-						ipntsdonor[k]++;
-					}
-
-					// calcul de itranfrm
-					uint isize_vois[3];
-					isize_vois[0] = ni_vois;
-					isize_vois[1] = nj_vois;
-					isize_vois[2] = nk_vois;
-					// un filtre pour identifier les directions traitées
-					bool filtre[3] = {false, false, false};
-					// idem pour bloc voisin
-					bool filtre_vois[3] = {false, false, false};
-
-					// recherche indice dans tableau de 2 valeurs identiques et non marquée dans filtre
-					uint ind1, ind2;
-					uint val1, val2;
-					for (uint k=0; k<3; k++){
-						ipnts1[k] = ipnts[k];
-						ipnts2[k] = ipnts[3+k];
-					}
-					_getIndicesIdAndVal(ipnts1, ipnts2, filtre, ind1, val1);
-					filtre[ind1] = true;
-
-					for (uint k=0; k<3; k++){
-						ipnts1[k] = ipntsdonor[k];
-						ipnts2[k] = ipntsdonor[3+k];
-					}
-					_getIndicesIdAndVal(ipnts1, ipnts2, filtre_vois, ind2, val2);
-					filtre_vois[ind2] = true;
+						}
+
+						char connectname[33];
+						strcpy(connectname, coface->getName().c_str());
+
+						char donorname[33];
+						strcpy(donorname, bloc_vois->getName().c_str());
+
+						// on met les indices ++ pour être >0
+						for (uint k=0; k<6; k++){
+							ipnts[k]++;
+							ipntsdonor[k]++;
+						}
+
+						// calcul de itranfrm
+						uint isize_vois[3];
+						isize_vois[0] = ni_vois;
+						isize_vois[1] = nj_vois;
+						isize_vois[2] = nk_vois;
+						// un filtre pour identifier les directions traitées
+						bool filtre[3] = {false, false, false};
+						// idem pour bloc voisin
+						bool filtre_vois[3] = {false, false, false};
+
+						// recherche indice dans tableau de 2 valeurs identiques et non marquée dans filtre
+						uint ind1, ind2;
+						uint val1, val2;
+						for (uint k=0; k<3; k++){
+							ipnts1[k] = ipnts[k];
+							ipnts2[k] = ipnts[3+k];
+						}
+						_getIndicesIdAndVal(ipnts1, ipnts2, filtre, ind1, val1);
+						filtre[ind1] = true;
+
+						for (uint k=0; k<3; k++){
+							ipnts1[k] = ipntsdonor[k];
+							ipnts2[k] = ipntsdonor[3+k];
+						}
+						_getIndicesIdAndVal(ipnts1, ipnts2, filtre_vois, ind2, val2);
+						filtre_vois[ind2] = true;
 
 #ifdef _DEBUG_CGNS
-					std::cout<<"_getIndicesIdAndVal => "<<ind1<<", "<<val1<<std::endl;
-					std::cout<<"_getIndicesIdAndVal => "<<ind2<<", "<<val2<<std::endl;
+						std::cout<<"_getIndicesIdAndVal => "<<ind1<<", "<<val1<<std::endl;
+						std::cout<<"_getIndicesIdAndVal => "<<ind2<<", "<<val2<<std::endl;
 #endif
 
-					// repère si val1 est au min ou au max
-					bool is_val1_min;
-					if (val1 == 1)
-						is_val1_min = true;
-					else if (isize[ind1] == val1)
-						is_val1_min = false;
-					else {
-						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-						message << "Erreur dans cg_1to1_write, "
-								<< " val1 = "<<(short)val1<<" n'est ni au min ni au max "<<(short)isize[ind1];
-						throw TkUtil::Exception (message);
-					}
-
-					// idem avec val2
-					bool is_val2_min;
-					if (val2 == 1)
-						is_val2_min = true;
-					else if (isize_vois[ind2] == val2)
-						is_val2_min = false;
-					else {
-						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-						message << "Erreur dans cg_1to1_write, "
-								<< " val2 = "<<(short)val2<<" n'est ni au min ni au max "<<(short)isize_vois[ind2];
-						throw TkUtil::Exception (message);
-					}
-
-					// on en déduit une transformation (pas certain que ce ne soit pas la réciproque qu'il faille prendre ....)
-					itranfrm[ind2] = ind1+1;
-					if (is_val1_min == is_val2_min)
-						itranfrm[ind2] = -itranfrm[ind2];
-
-
-					// recherche d'un troisième sommet / ind_min ind_max
-					uint ind_autre = 0;
-					if (ind_autre == ind_min || ind_autre == ind_max)
-						ind_autre++;
-					if (ind_autre == ind_min || ind_autre == ind_max)
-						throw TkUtil::Exception (TkUtil::UTF8String ("Ereur interne dans writeCGNS, on ne trouve pas de 3ème indice", TkUtil::Charset::UTF_8));
-
-					gmds::TCellID node_other = coface_vertices[ind_autre]->getNode();
-
-					ipnts[6+0] = idxIJK_vertices[ind_autre][0]+1;
-					ipnts[6+1] = idxIJK_vertices[ind_autre][1]+1;
-					ipnts[6+2] = idxIJK_vertices[ind_autre][2]+1;
-
-					{
-						uint idxI, idxJ, idxK;
-						_getIndexNode(node_other,
-								bloc_vois->nodes(), ni_vois, nj_vois, nk_vois,
-								idxI, idxJ, idxK);
-						ipntsdonor[6+0] = idxI+1;
-						ipntsdonor[6+1] = idxJ+1;
-						ipntsdonor[6+2] = idxK+1;
+						// repère si val1 est au min ou au max
+						bool is_val1_min;
+						if (val1 == 1)
+							is_val1_min = true;
+						else if (isize[ind1] == val1)
+							is_val1_min = false;
+						else {
+							TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+							message << "Erreur dans cg_1to1_write, "
+									<< " val1 = "<<(short)val1<<" n'est ni au min ni au max "<<(short)isize[ind1];
+							throw TkUtil::Exception (message);
+						}
+
+						// idem avec val2
+						bool is_val2_min;
+						if (val2 == 1)
+							is_val2_min = true;
+						else if (isize_vois[ind2] == val2)
+							is_val2_min = false;
+						else {
+							TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+							message << "Erreur dans cg_1to1_write, "
+									<< " val2 = "<<(short)val2<<" n'est ni au min ni au max "<<(short)isize_vois[ind2];
+							throw TkUtil::Exception (message);
+						}
+
+						// on en déduit une transformation (pas certain que ce ne soit pas la réciproque qu'il faille prendre ....)
+						itranfrm[ind2] = ind1+1;
+						if (is_val1_min == is_val2_min)
+							itranfrm[ind2] = -itranfrm[ind2];
+
+
+						// recherche d'un troisième sommet / ind_min ind_max
+						uint ind_autre = 0;
+						if (ind_autre == ind_min || ind_autre == ind_max)
+							ind_autre++;
+						if (ind_autre == ind_min || ind_autre == ind_max)
+							throw TkUtil::Exception (TkUtil::UTF8String ("Ereur interne dans writeCGNS, on ne trouve pas de 3ème indice", TkUtil::Charset::UTF_8));
+
+						gmds::TCellID node_other = coface_vertices[ind_autre]->getNode();
+
+						ipnts[6+0] = idxIJK_vertices[ind_autre][0]+1;
+						ipnts[6+1] = idxIJK_vertices[ind_autre][1]+1;
+						ipnts[6+2] = idxIJK_vertices[ind_autre][2]+1;
+
+						{
+							uint idxI, idxJ, idxK;
+							_getIndexNode(node_other,
+									indices_vois, ni_vois, nj_vois,
+									idxI, idxJ, idxK);
+							ipntsdonor[6+0] = idxI+1;
+							ipntsdonor[6+1] = idxJ+1;
+							ipntsdonor[6+2] = idxK+1;
 #ifdef _DEBUG_CGNS
-						std::cout<<" relation réciproque "<<bloc->getName()
-							     <<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
-							     <<" ni (vois) "<<ni_vois<<", nj "<<nj_vois<<", nk "<<nk_vois
-							     <<" node_other "<<(long)node_other
-							     <<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
-							     <<std::endl;
+							std::cout<<" relation réciproque "<<bloc->getName()
+								     <<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
+								     <<" ni (vois) "<<ni_vois<<", nj "<<nj_vois<<", nk "<<nk_vois
+								     <<" node_other "<<(long)node_other
+								     <<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
+								     <<std::endl;
 #endif
-					}
+						}
 
 
-					// recherche itransforme entre sommets ind_min et ind_autre
-					for (uint k=0; k<3; k++){
-						ipnts1[k] = ipnts[k]; // ind_min
-						ipnts2[k] = ipnts[6+k]; // ind_autre
-					}
-					_getIndicesIdAndVal(ipnts1, ipnts2, filtre, ind1, val1);
-					filtre[ind1] = true;
+						// recherche itransforme entre sommets ind_min et ind_autre
+						for (uint k=0; k<3; k++){
+							ipnts1[k] = ipnts[k]; // ind_min
+							ipnts2[k] = ipnts[6+k]; // ind_autre
+						}
+						_getIndicesIdAndVal(ipnts1, ipnts2, filtre, ind1, val1);
+						filtre[ind1] = true;
 
-					for (uint k=0; k<3; k++){
-						ipnts1[k] = ipntsdonor[k];
-						ipnts2[k] = ipntsdonor[6+k];
-					}
-					_getIndicesIdAndVal(ipnts1, ipnts2, filtre_vois, ind2, val2);
-					filtre_vois[ind2] = true;
+						for (uint k=0; k<3; k++){
+							ipnts1[k] = ipntsdonor[k];
+							ipnts2[k] = ipntsdonor[6+k];
+						}
+						_getIndicesIdAndVal(ipnts1, ipnts2, filtre_vois, ind2, val2);
+						filtre_vois[ind2] = true;
 
 #ifdef _DEBUG_CGNS
-					std::cout<<"_getIndicesIdAndVal => "<<ind1<<", "<<val1<<std::endl;
-					std::cout<<"_getIndicesIdAndVal => "<<ind2<<", "<<val2<<std::endl;
+						std::cout<<"_getIndicesIdAndVal => "<<ind1<<", "<<val1<<std::endl;
+						std::cout<<"_getIndicesIdAndVal => "<<ind2<<", "<<val2<<std::endl;
 #endif
 
-					is_val1_min = true; // de par la sélection de ind_min
-					uint ind_vois_min = (ipntsdonor[ind2]<ipntsdonor[ind2+3]?ipntsdonor[ind2]:ipntsdonor[ind2+3]);
-					is_val2_min = (val2 == ind_vois_min);
+						is_val1_min = true; // de par la sélection de ind_min
+						uint ind_vois_min = (ipntsdonor[ind2]<ipntsdonor[ind2+3]?ipntsdonor[ind2]:ipntsdonor[ind2+3]);
+						is_val2_min = (val2 == ind_vois_min);
 
-					// on en déduit une transformation (2ème paramètre)
-					itranfrm[ind2] = ind1+1;
-					if (is_val1_min == is_val2_min)
-						itranfrm[ind2] = -itranfrm[ind2];
+						// on en déduit une transformation (2ème paramètre)
+						itranfrm[ind2] = ind1+1;
+						if (is_val1_min == is_val2_min)
+							itranfrm[ind2] = -itranfrm[ind2];
 
 
-					// recherche itransforme entre sommets ind_max et ind_autre
-					for (uint k=0; k<3; k++){
-						ipnts1[k] = ipnts[3+k]; // ind_max
-						ipnts2[k] = ipnts[6+k]; // ind_autre
-					}
-					_getIndicesIdAndVal(ipnts1, ipnts2, filtre, ind1, val1);
-					filtre[ind1] = true;
+						// recherche itransforme entre sommets ind_max et ind_autre
+						for (uint k=0; k<3; k++){
+							ipnts1[k] = ipnts[3+k]; // ind_max
+							ipnts2[k] = ipnts[6+k]; // ind_autre
+						}
+						_getIndicesIdAndVal(ipnts1, ipnts2, filtre, ind1, val1);
+						filtre[ind1] = true;
 
-					for (uint k=0; k<3; k++){
-						ipnts1[k] = ipntsdonor[3+k];
-						ipnts2[k] = ipntsdonor[6+k];
-					}
-					_getIndicesIdAndVal(ipnts1, ipnts2, filtre_vois, ind2, val2);
-					filtre_vois[ind2] = true;
+						for (uint k=0; k<3; k++){
+							ipnts1[k] = ipntsdonor[3+k];
+							ipnts2[k] = ipntsdonor[6+k];
+						}
+						_getIndicesIdAndVal(ipnts1, ipnts2, filtre_vois, ind2, val2);
+						filtre_vois[ind2] = true;
 
 #ifdef _DEBUG_CGNS
-					std::cout<<"_getIndicesIdAndVal => "<<ind1<<", "<<val1<<std::endl;
-					std::cout<<"_getIndicesIdAndVal => "<<ind2<<", "<<val2<<std::endl;
+						std::cout<<"_getIndicesIdAndVal => "<<ind1<<", "<<val1<<std::endl;
+						std::cout<<"_getIndicesIdAndVal => "<<ind2<<", "<<val2<<std::endl;
 #endif
 
-					is_val1_min = false; // de par la sélection de ind_max
-					ind_vois_min = (ipntsdonor[ind2]<ipntsdonor[ind2+3]?ipntsdonor[ind2]:ipntsdonor[ind2+3]);
-					is_val2_min = (val2 == ind_vois_min);
+						is_val1_min = false; // de par la sélection de ind_max
+						ind_vois_min = (ipntsdonor[ind2]<ipntsdonor[ind2+3]?ipntsdonor[ind2]:ipntsdonor[ind2+3]);
+						is_val2_min = (val2 == ind_vois_min);
 
-					// on en déduit une transformation (3ème paramètre)
-					itranfrm[ind2] = ind1+1;
-					if (is_val1_min == is_val2_min)
-						itranfrm[ind2] = -itranfrm[ind2];
+						// on en déduit une transformation (3ème paramètre)
+						itranfrm[ind2] = ind1+1;
+						if (is_val1_min == is_val2_min)
+							itranfrm[ind2] = -itranfrm[ind2];
 
 
 #ifdef _DEBUG_CGNS
-					std::cout<<"cg_1to1_write("<<index_file<<", "<<index_base
-							<<", "<<index_zone<<", "<<connectname<<", "<<donorname
-							<<", ipnts ["<<ipnts[0]<<","<<ipnts[1]<<","<<ipnts[2]
-							<<"] ["<<ipnts[3]<<","<<ipnts[4]<<","<<ipnts[5]
-							<<"], ipntsdonor ["<<ipntsdonor[0]<<","<<ipntsdonor[1]<<","<<ipntsdonor[2]
-							<<"] ["<<ipntsdonor[3]<<","<<ipntsdonor[4]<<","<<ipntsdonor[5]
-							<<"], itranfrm ["<<itranfrm[0]<<","<<itranfrm[1]<<","<<itranfrm[2]
-							<<"]"<<std::endl;
+						std::cout<<"cg_1to1_write("<<index_file<<", "<<index_base
+								<<", "<<index_zone<<", "<<connectname<<", "<<donorname
+								<<", ipnts ["<<ipnts[0]<<","<<ipnts[1]<<","<<ipnts[2]
+								<<"] ["<<ipnts[3]<<","<<ipnts[4]<<","<<ipnts[5]
+								<<"], ipntsdonor ["<<ipntsdonor[0]<<","<<ipntsdonor[1]<<","<<ipntsdonor[2]
+								<<"] ["<<ipntsdonor[3]<<","<<ipntsdonor[4]<<","<<ipntsdonor[5]
+								<<"], itranfrm ["<<itranfrm[0]<<","<<itranfrm[1]<<","<<itranfrm[2]
+								<<"]"<<std::endl;
 #endif
 
-					if (cg_1to1_write(index_file,index_base,index_zone,
-							connectname,donorname,
-							ipnts,ipntsdonor,itranfrm,
-							&index_conn)){
-						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-						message << "Erreur dans cg_1to1_write\n"
-								<< "cg_get_error => "<<cg_get_error();
-						throw TkUtil::Exception (message);
-					}
+						if (cg_1to1_write(index_file,index_base,index_zone,
+								connectname,donorname,
+								ipnts,ipntsdonor,itranfrm,
+								&index_conn)){
+							TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+							message << "Erreur dans cg_1to1_write\n"
+									<< "cg_get_error => "<<cg_get_error();
+							throw TkUtil::Exception (message);
+						}
 #ifdef _DEBUG_CGNS
-					std::cout<<" => index_conn = "<<index_conn<<std::endl;
+						std::cout<<" => index_conn = "<<index_conn<<std::endl;
 #endif
 
-				} // end if (coface_blocks.size() == 2)
-			} // end for j<cofaces.size()
+					} // end if (coface_blocks.size() == 2)
+				} // end for j<cofaces.size()
 
-		} // end if (bloc->isMeshed() && bloc->isStructured())
-		else {
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-			message << "Attention, pas de sauvegarde pour " <<bloc->getName();
-		    getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::WARNING));
+			} // end for iz<lots[l+1]
+		}
+		catch (...){
+			if (lot_suivant.joinable())
+				lot_suivant.join();
+			throw;
 		}
-	} // end for i<blocks.size()
+
+		if (lot_suivant.joinable())
+			lot_suivant.join();
+		if (erreur_lot)
+			std::rethrow_exception(erreur_lot);
+	} // end for l<lots.size()-1
+
+	// la zone non structurée
+	if (!blocs_non_structures.empty())
+		_writeCGNSUnstructuredZone(index_file, index_base, blocs_non_structures);
 
 	/* close CGNS file */
 	if (cg_close(index_file))
@@ -846,85 +1210,356 @@ void MeshImplementation::writeCGNS(std::string nom)
 
 } // MeshImplementation::writeCGNS
 /*----------------------------------------------------------------------------*/
+/// type d'élément CGNS et nombre de noeuds pour un type de polyèdre ou de polygone gmds
+static bool getCGNSElementType(gmds::ECellType type, CGNS_ENUMT(ElementType_t)& cgns_type, uint& nbNoeuds)
+{
+	switch (type){
+	case gmds::GMDS_TETRA:    cgns_type = CGNS_ENUMV(TETRA_4);  nbNoeuds = 4; return true;
+	case gmds::GMDS_PYRAMID:  cgns_type = CGNS_ENUMV(PYRA_5);   nbNoeuds = 5; return true;
+	case gmds::GMDS_PRISM3:   cgns_type = CGNS_ENUMV(PENTA_6);  nbNoeuds = 6; return true;
+	case gmds::GMDS_HEX:      cgns_type = CGNS_ENUMV(HEXA_8);   nbNoeuds = 8; return true;
+	case gmds::GMDS_TRIANGLE: cgns_type = CGNS_ENUMV(TRI_3);    nbNoeuds = 3; return true;
+	case gmds::GMDS_QUAD:     cgns_type = CGNS_ENUMV(QUAD_4);   nbNoeuds = 4; return true;
+	default:
+		return false;
+	}
+}
+/*----------------------------------------------------------------------------*/
+/// une section (Elements_t) de la zone non structurée
+struct SectionCGNS {
+	/// nom de la section, et de la famille associée (vide si pas de famille)
+	std::string nom;
+	std::string famille;
+	/// les éléments (polyèdres ou polygones gmds)
+	std::vector<gmds::TCellID> elements;
+	/// connectivité (type en préfixe de chaque élément), début de chaque élément et types rencontrés
+	std::vector<cgsize_t> connectivite;
+	std::vector<cgsize_t> decalages;
+	std::set<int> types;
+};
+/*----------------------------------------------------------------------------*/
+/// nom CGNS, limité à 32 caractères
+static std::string getCGNSName(const std::string& nom)
+{
+	return nom.substr(0, 32);
+}
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::_writeCGNSUnstructuredZone(int index_file, int index_base,
+		std::vector<Topo::Block*>& blocs)
+{
+	gmds::IGMesh& gmdsMesh = getGMDSMesh();
+
+	// les polyèdres des blocs, et pour chacun la section dans laquelle il est
+	std::unordered_map<gmds::TCellID, int> section_region;
+	std::set<Topo::Block*> filtre_blocs;
+	for (uint i=0; i<blocs.size(); i++){
+		filtre_blocs.insert(blocs[i]);
+		std::vector<gmds::TCellID>& regions = blocs[i]->regions();
+		for (uint j=0; j<regions.size(); j++)
+			section_region[regions[j]] = -1;
+	}
+
+	// une section par groupe de volumes (famille), un polyèdre n'est mis
+	// que dans la première section dans laquelle il apparait
+	std::vector<SectionCGNS> sections;
+	std::vector<Mesh::Volume*> volumes;
+	getContext().getLocalMeshManager().getVolumes(volumes);
+	for (uint i=0; i<volumes.size(); i++){
+		std::vector<gmds::TCellID> regions;
+		if (volumes[i]->getType() == Utils::Entity::MeshSubVolume){
+			std::vector<gmds::Region> gmds_regions;
+			volumes[i]->getGMDSRegions(gmds_regions);
+			for (uint j=0; j<gmds_regions.size(); j++)
+				regions.push_back(gmds_regions[j].getID());
+		}
+		else {
+			std::vector<Topo::Block*> vol_blocs;
+			volumes[i]->getBlocks(vol_blocs);
+			for (uint j=0; j<vol_blocs.size(); j++)
+				if (filtre_blocs.find(vol_blocs[j]) != filtre_blocs.end())
+					regions.insert(regions.end(), vol_blocs[j]->regions().begin(), vol_blocs[j]->regions().end());
+		}
+
+		SectionCGNS section;
+		section.nom = getCGNSName(volumes[i]->getName());
+		section.famille = section.nom;
+		for (uint j=0; j<regions.size(); j++){
+			std::unordered_map<gmds::TCellID, int>::iterator iter = section_region.find(regions[j]);
+			if (iter != section_region.end() && iter->second == -1){
+				iter->second = sections.size();
+				section.elements.push_back(regions[j]);
+			}
+		}
+		if (!section.elements.empty())
+			sections.push_back(section);
+	} // end for i<volumes.size()
+
+	// les polyèdres hors groupe, une section par bloc
+	for (uint i=0; i<blocs.size(); i++){
+		SectionCGNS section;
+		section.nom = getCGNSName(blocs[i]->getName());
+		std::vector<gmds::TCellID>& regions = blocs[i]->regions();
+		for (uint j=0; j<regions.size(); j++){
+			int& num_section = section_region[regions[j]];
+			if (num_section == -1){
+				num_section = sections.size();
+				section.elements.push_back(regions[j]);
+			}
+		}
+		if (!section.elements.empty())
+			sections.push_back(section);
+	}
+	const uint nbSections3D = sections.size();
+
+	// numérotation CGNS (à partir de 1) des noeuds des polyèdres
+	std::unordered_map<gmds::TCellID, cgsize_t> num_noeud;
+	std::vector<gmds::TCellID> noeuds;
+	cgsize_t nbElements3D = 0;
+	for (uint i=0; i<nbSections3D; i++){
+		nbElements3D += sections[i].elements.size();
+		for (uint j=0; j<sections[i].elements.size(); j++){
+			std::vector<gmds::TCellID> nds = gmdsMesh.get<gmds::Region>(sections[i].elements[j]).getIDs<gmds::Node>();
+			for (uint k=0; k<nds.size(); k++)
+				if (num_noeud.insert(std::make_pair(nds[k], (cgsize_t)noeuds.size()+1)).second)
+					noeuds.push_back(nds[k]);
+		}
+	}
+
+	// une section par groupe de surfaces (famille de CL), pour les polygones dont
+	// tous les noeuds sont dans la zone
+	std::vector<Mesh::Surface*> surfaces;
+	getContext().getLocalMeshManager().getSurfaces(surfaces);
+	for (uint i=0; i<surfaces.size(); i++){
+		std::vector<gmds::Face> polygones;
+		surfaces[i]->getGMDSFaces(polygones);
+
+		SectionCGNS section;
+		section.nom = getCGNSName(surfaces[i]->getName());
+		section.famille = section.nom;
+		for (uint j=0; j<polygones.size(); j++){
+			std::vector<gmds::TCellID> nds = polygones[j].getIDs<gmds::Node>();
+			bool dans_zone = true;
+			for (uint k=0; k<nds.size() && dans_zone; k++)
+				dans_zone = (num_noeud.find(nds[k]) != num_noeud.end());
+			if (dans_zone)
+				section.elements.push_back(polygones[j].getID());
+		}
+		if (!section.elements.empty())
+			sections.push_back(section);
+	} // end for i<surfaces.size()
+
+	// connectivité de chacune des sections, avec le type en préfixe de chaque
+	// élément (comme pour le type MIXED)
+	uint nbIgnores = 0;
+	cgsize_t nbCellules = 0;
+	for (uint i=0; i<sections.size(); i++){
+		SectionCGNS& section = sections[i];
+		const bool est3D = (i < nbSections3D);
+		section.decalages.push_back(0);
+		for (uint j=0; j<section.elements.size(); j++){
+			gmds::ECellType type;
+			std::vector<gmds::TCellID> nds;
+			if (est3D){
+				gmds::Region r = gmdsMesh.get<gmds::Region>(section.elements[j]);
+				type = r.getType();
+				nds = r.getIDs<gmds::Node>();
+			}
+			else {
+				gmds::Face f = gmdsMesh.get<gmds::Face>(section.elements[j]);
+				type = f.getType();
+				nds = f.getIDs<gmds::Node>();
+			}
+			CGNS_ENUMT(ElementType_t) cgns_type;
+			uint nbNoeuds;
+			if (!getCGNSElementType(type, cgns_type, nbNoeuds) || nbNoeuds != nds.size()){
+				nbIgnores++;
+				continue;
+			}
+			section.types.insert(cgns_type);
+			section.connectivite.push_back(cgns_type);
+			for (uint k=0; k<nbNoeuds; k++)
+				section.connectivite.push_back(num_noeud[nds[k]]);
+			section.decalages.push_back(section.connectivite.size());
+		}
+		std::vector<gmds::TCellID>().swap(section.elements);
+		if (est3D)
+			nbCellules += section.decalages.size()-1;
+	}
+
+	// aucun polyèdre écrit, pas de zone vide
+	if (nbCellules == 0){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Attention, pas de zone non structurée en CGNS, aucun polyèdre des blocs non structurés n'est exportable";
+		getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::WARNING));
+		return;
+	}
+
+	// la zone et ses coordonnées
+	cgsize_t isize[3];
+	isize[0] = noeuds.size();
+	isize[1] = nbCellules;
+	isize[2] = 0;
+	int index_zone, index_coord;
+	if (cg_zone_write(index_file,index_base,"ZoneNonStructuree",isize,CGNS_ENUMT(ZoneType_t)::CGNS_ENUMT(Unstructured),&index_zone))
+		throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_zone_write (zone non structurée)", TkUtil::Charset::UTF_8));
+
+	{
+		std::vector<double> xx(noeuds.size());
+		std::vector<double> yy(noeuds.size());
+		std::vector<double> zz(noeuds.size());
+		for (uint i=0; i<noeuds.size(); i++){
+			gmds::Node current = gmdsMesh.get<gmds::Node>(noeuds[i]);
+			xx[i] = current.X();
+			yy[i] = current.Y();
+			zz[i] = current.Z();
+		}
+		if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateX",xx.data(),&index_coord))
+			throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write xx", TkUtil::Charset::UTF_8));
+		if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateY",yy.data(),&index_coord))
+			throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write yy", TkUtil::Charset::UTF_8));
+		if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateZ",zz.data(),&index_coord))
+			throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write zz", TkUtil::Charset::UTF_8));
+	}
+
+	// les sections, la connectivité d'une section est écrite en une fois
+	std::set<std::string> familles;
+	cgsize_t premier = 1;
+	for (uint i=0; i<sections.size(); i++){
+		SectionCGNS& section = sections[i];
+		const bool est3D = (i < nbSections3D);
+		if (section.types.empty())
+			continue;
+
+		cgsize_t nbElements = section.decalages.size()-1;
+		cgsize_t dernier = premier + nbElements - 1;
+		int index_section;
+		int erreur;
+		if (section.types.size() == 1){
+			// un seul type, on retire les préfixes
+			std::vector<cgsize_t>& conn = section.connectivite;
+			const uint pas = section.decalages[1];
+			uint k = 0;
+			for (uint j=0; j<conn.size(); j++)
+				if (j%pas != 0)
+					conn[k++] = conn[j];
+			conn.resize(k);
+			erreur = cg_section_write(index_file, index_base, index_zone, section.nom.c_str(),
+					(CGNS_ENUMT(ElementType_t))*section.types.begin(), premier, dernier, 0, conn.data(), &index_section);
+		}
+		else {
+#if CGNS_VERSION >= 4000
+			erreur = cg_poly_section_write(index_file, index_base, index_zone, section.nom.c_str(),
+					CGNS_ENUMV(MIXED), premier, dernier, 0, section.connectivite.data(), section.decalages.data(), &index_section);
+#else
+			erreur = cg_section_write(index_file, index_base, index_zone, section.nom.c_str(),
+					CGNS_ENUMV(MIXED), premier, dernier, 0, section.connectivite.data(), &index_section);
+#endif
+		}
+		if (erreur){
+			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+			message << "Erreur dans cg_section_write pour "<<section.nom
+					<< "\ncg_get_error => "<<cg_get_error();
+			throw TkUtil::Exception (message);
+		}
+		std::vector<cgsize_t>().swap(section.connectivite);
+		std::vector<cgsize_t>().swap(section.decalages);
+
+		if (!section.famille.empty()){
+			if (familles.insert(section.famille).second){
+				int index_family;
+				if (cg_family_write(index_file, index_base, section.famille.c_str(), &index_family))
+					throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_family_write", TkUtil::Charset::UTF_8));
+			}
+
+			if (est3D){
+				if (cg_goto(index_file, index_base, "Zone_t", index_zone, "Elements_t", index_section, "end")
+						|| cg_famname_write(section.famille.c_str()))
+					throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_famname_write", TkUtil::Charset::UTF_8));
+			}
+			else {
+				// condition aux limites portée par les polygones de la section
+				cgsize_t range[2] = {premier, dernier};
+				int index_boco;
+				if (cg_boco_write(index_file, index_base, index_zone, section.nom.c_str(),
+						CGNS_ENUMV(FamilySpecified), CGNS_ENUMV(PointRange), 2, range, &index_boco)
+						|| cg_boco_gridlocation_write(index_file, index_base, index_zone, index_boco, CGNS_ENUMV(FaceCenter))
+						|| cg_goto(index_file, index_base, "Zone_t", index_zone, "ZoneBC_t", 1, "BC_t", index_boco, "end")
+						|| cg_famname_write(section.famille.c_str())){
+					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+					message << "Erreur dans l'écriture de la condition aux limites "<<section.nom
+							<< "\ncg_get_error => "<<cg_get_error();
+					throw TkUtil::Exception (message);
+				}
+			}
+		}
+
+		premier = dernier + 1;
+	} // end for i<sections.size()
+
+	if (nbIgnores){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Attention, "<<(long)nbIgnores<<" éléments de type non supporté ne sont pas sauvegardés en CGNS";
+		getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::WARNING));
+	}
+}
+/*----------------------------------------------------------------------------*/
 void MeshImplementation::smooth()
 {
-    throw TkUtil::Exception (TkUtil::UTF8String ("MeshImplementation::smooth no more implemented.", TkUtil::Charset::UTF_8));
-//	std::cout<<std::endl;
-//	std::cout<<"MeshImplementation::smooth"<<std::endl;
-////	throw TkUtil::Exception (TkUtil::UTF8String ("MeshImplementation::smooth pas encore implémenté.", TkUtil::Charset::UTF_8));
-//
-//	Mesquite::MsqError err;
-//
-//	MesquiteMeshImplAdapter* meshAdapter = new MesquiteMeshImplAdapter(
-//			getContext().getLocalMeshManager(),
-//			getContext().getLocalGeomManager());
-//
-//	std::map<Mesquite::Mesh::VertexHandle,gmds::Node*>* mesquite2GMDSNodes = meshAdapter->getMesquite2GMDSNodes();
-//	std::map<Mesquite::Mesh::ElementHandle,gmds::Mesh<MeshItf::TMask>::Cell*>* mesquite2GMDSCells = meshAdapter->getMesquite2GMDSCells();
-//
-//	MesquiteDomainImplAdapter* domainAdapter = new MesquiteDomainImplAdapter(
-//			getContext().getLocalMeshManager(),
-//			getContext().getLocalTopoManager(),
-//			*mesquite2GMDSNodes,
-//			*mesquite2GMDSCells);
-//
-//	Mesquite::MeshDomainAssoc* myAssoc = new Mesquite::MeshDomainAssoc(meshAdapter, domainAdapter, false, false, true);
-//
-////  Mesquite::ShapeImprovementWrapper* wrapper = new Mesquite::ShapeImprovementWrapper();
-////	Mesquite::LaplaceWrapper* wrapper = new Mesquite::LaplaceWrapper();
-//	Mesquite::ShapeImprover* wrapper = new Mesquite::ShapeImprover();
-//
-////	Mesquite::PaverMinEdgeLengthWrapper* wrapper = new Mesquite::PaverMinEdgeLengthWrapper(10e-10);
-////	Mesquite::SizeAdaptShapeWrapper* wrapper = new Mesquite::SizeAdaptShapeWrapper(10e-10);
-//
-////	Mesquite::Settings* dummySettings = new Mesquite::Settings();
-////	Mesquite::QualityAssessor* qa = new Mesquite::QualityAssessor();
-////
-////	Mesquite::ParallelMeshImpl* poyop = new Mesquite::ParallelMeshImpl(meshAdapter);
-//
-//	wrapper->run_instructions(myAssoc,err);
-//	MSQ_CHKERR (err);
-//
-////	wrapper->run_wrapper(
-////			myAssoc,
-////			poyop,
-////			dummySettings,
-////			qa,
-////			err
-////	);
-//
-//
-//
-//	std::vector<Mesquite::Mesh::VertexHandle> vertices;
-//	meshAdapter->get_all_vertices(vertices,err);
-//	if(err.error()) {
-//		std::cout<<err.error_message()<<std::endl;
-//	}
-//
-//	Mesquite::Mesh::VertexHandle verticesArray[vertices.size()];
-//	for (unsigned int iVertex=0; iVertex<vertices.size(); iVertex++) {
-//		verticesArray[iVertex] = vertices[iVertex];
-//	}
-//	Mesquite::MsqVertex coords[vertices.size()];
-//	meshAdapter->vertices_get_coordinates(verticesArray,coords,vertices.size(),err);
-//	MSQ_CHKERR (err);
-//
-//	gmds::Mesh<Mgx3D::Mesh::MeshItf::TMask>::nodes_iterator itn  = getContext().getLocalMeshManager().getMesh()->getGMDSMesh().nodes_begin();
-//
-//	for (unsigned int iVertex=0; iVertex<vertices.size(); iVertex++) {
-//
-////		if(mesquite2GMDSNodes->find(vertices[iVertex]) == mesquite2GMDSNodes->end()) {
-////			std::cout<<"MeshImplementation::smooth pb with mesquite2GMDSNodes"<<std::endl;
-//////			throw TkUtil::Exception (TkUtil::UTF8String ("MeshImplementation::smooth pb with mesquite2GMDSNodes", TkUtil::Charset::UTF_8));
-////		}
-////
-////		gmds::Node* node = (*mesquite2GMDSNodes)[vertices[iVertex]];
-//		gmds::Node* current_node = itn->currentItem();
-//		current_node->setXYZ(coords[iVertex].x(),coords[iVertex].y(),coords[iVertex].z());
-//
-//		itn->next();
-//	}
+	// lissage laplacien (interne si Smooth3D n'est pas disponible) de
+	// l'ensemble des blocs maillés, les noeuds au bord de ces blocs sont figés,
+	// ainsi que ceux des faces et arêtes internes associées à une surface ou
+	// une courbe (pour ne pas les écarter de la géométrie)
+	std::vector<Topo::Block*> blocks;
+	getContext().getLocalTopoManager().getBlocks(blocks, true);
+	gmds::IGMesh& gmdsMesh = getGMDSMesh();
+
+	std::vector<Topo::Block*> meshed_blocks;
+	for (uint i=0; i<blocks.size(); i++)
+		if (blocks[i]->isMeshed())
+			meshed_blocks.push_back(blocks[i]);
+
+	// 1 pour les noeuds des blocs, 2 pour ceux au bord
+	NodeFilter filtre_nodes(gmdsMesh.getMaxLocalID(0)+1);
+	std::vector<gmds::Node> nodes;
+	std::vector<gmds::Region> polyedres;
+	for (uint i=0; i<meshed_blocks.size(); i++){
+		std::vector<gmds::TCellID>& l_nds = meshed_blocks[i]->nodes();
+		std::vector<gmds::TCellID>& l_poly = meshed_blocks[i]->regions();
+		for (uint j=0; j<l_poly.size(); j++)
+			polyedres.push_back(gmdsMesh.get<gmds::Region>(l_poly[j]));
+		for (uint j=0; j<l_nds.size(); j++)
+			if (filtre_nodes.setIfUnmarked(l_nds[j], 1))
+				nodes.push_back(gmdsMesh.get<gmds::Node>(l_nds[j]));
+	}
+
+	std::vector<Topo::CoFace*> border_cofaces = Topo::TopoHelper::getBorder(meshed_blocks);
+	for (uint i=0; i<border_cofaces.size(); i++){
+		std::vector<gmds::TCellID>& l_nds = border_cofaces[i]->nodes();
+		for (uint j=0; j<l_nds.size(); j++)
+			filtre_nodes.set(l_nds[j], 2);
+	}
+
+	for (uint i=0; i<meshed_blocks.size(); i++){
+		std::vector<Topo::CoFace*> cofaces;
+		meshed_blocks[i]->getCoFaces(cofaces);
+		for (uint j=0; j<cofaces.size(); j++)
+			if (cofaces[j]->getGeomAssociation() && cofaces[j]->getGeomAssociation()->getDim() < 3){
+				std::vector<gmds::TCellID>& l_nds = cofaces[j]->nodes();
+				for (uint k=0; k<l_nds.size(); k++)
+					filtre_nodes.set(l_nds[k], 2);
+			}
+		std::vector<Topo::CoEdge*> coedges;
+		meshed_blocks[i]->getCoEdges(coedges);
+		for (uint j=0; j<coedges.size(); j++)
+			if (coedges[j]->getGeomAssociation() && coedges[j]->getGeomAssociation()->getDim() < 3){
+				std::vector<gmds::TCellID>& l_nds = coedges[j]->nodes();
+				for (uint k=0; k<l_nds.size(); k++)
+					filtre_nodes.set(l_nds[k], 2);
+			}
+	}
 
+	VolumicSmoothing lissage;
+	lissage.applyModification(nodes, polyedres, filtre_nodes, 2, 0, false);
 }
 /*----------------------------------------------------------------------------*/
 void MeshImplementation::deleteGMDSGroups()
@@ -1431,52 +2066,45 @@ void MeshImplementation::_addEdgesInLines(Mesh::CommandCreateMesh* command, Topo
         } // end for i<groupsName.size()
 }
 /*----------------------------------------------------------------------------*/
-void MeshImplementation::_getIndexNode(gmds::TCellID node, std::vector<gmds::TCellID>& nodes,
+void MeshImplementation::_buildIndexNodeMap(const std::vector<gmds::TCellID>& nodes,
 		uint ni, uint nj, uint nk,
+		std::unordered_map<gmds::TCellID, uint>& indices)
+{
+	// seuls les noeuds des 6 faces du bloc sont utiles
+	indices.reserve(2*(ni*nj+nj*nk+ni*nk));
+	for (uint idxK = 0; idxK<nk; idxK+=(nk>1?nk-1:1))
+		for (uint idxJ = 0; idxJ<nj; idxJ++)
+			for (uint idxI = 0; idxI<ni; idxI++)
+				indices[nodes[idxI + idxJ*ni + idxK*ni*nj]] = idxI + idxJ*ni + idxK*ni*nj;
+
+	for (uint idxJ = 0; idxJ<nj; idxJ+=(nj>1?nj-1:1))
+		for (uint idxK = 0; idxK<nk; idxK++)
+			for (uint idxI = 0; idxI<ni; idxI++)
+				indices[nodes[idxI + idxJ*ni + idxK*ni*nj]] = idxI + idxJ*ni + idxK*ni*nj;
+
+	for (uint idxI = 0; idxI<ni; idxI+=(ni>1?ni-1:1))
+		for (uint idxK = 0; idxK<nk; idxK++)
+			for (uint idxJ = 0; idxJ<nj; idxJ++)
+				indices[nodes[idxI + idxJ*ni + idxK*ni*nj]] = idxI + idxJ*ni + idxK*ni*nj;
+}
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::_getIndexNode(gmds::TCellID node,
+		const std::unordered_map<gmds::TCellID, uint>& indices,
+		uint ni, uint nj,
 		uint &idxI, uint &idxJ, uint &idxK)
 {
-	// on fait 6 boucles, une par face
-	idxK = 0;
-	for (idxI = 0; idxI<ni; idxI++)
-		for (idxJ = 0; idxJ<nj; idxJ++)
-			if (nodes[idxI + idxJ*ni + idxK*ni*nj] == node)
-				return;
-
-	idxK = nk-1;
-	for (idxI = 0; idxI<ni; idxI++)
-		for (idxJ = 0; idxJ<nj; idxJ++)
-			if (nodes[idxI + idxJ*ni + idxK*ni*nj] == node)
-				return;
-
-	idxJ = 0;
-	for (idxI = 0; idxI<ni; idxI++)
-		for (idxK = 0; idxK<nk; idxK++)
-			if (nodes[idxI + idxJ*ni + idxK*ni*nj] == node)
-				return;
-
-	idxJ = nj-1;
-	for (idxI = 0; idxI<ni; idxI++)
-		for (idxK = 0; idxK<nk; idxK++)
-			if (nodes[idxI + idxJ*ni + idxK*ni*nj] == node)
-				return;
-
-	idxI = 0;
-	for (idxK = 0; idxK<nk; idxK++)
-		for (idxJ = 0; idxJ<nj; idxJ++)
-			if (nodes[idxI + idxJ*ni + idxK*ni*nj] == node)
-				return;
-
-	idxI = ni-1;
-	for (idxK = 0; idxK<nk; idxK++)
-		for (idxJ = 0; idxJ<nj; idxJ++)
-			if (nodes[idxI + idxJ*ni + idxK*ni*nj] == node)
-				return;
+	std::unordered_map<gmds::TCellID, uint>::const_iterator iter = indices.find(node);
+	if (iter != indices.end()){
+		uint idx = iter->second;
+		idxI = idx%ni;
+		idxJ = (idx/ni)%nj;
+		idxK = idx/(ni*nj);
+		return;
+	}
 
 #ifdef _DEBUG_CGNS
-	std::cout<<"MeshImplementation::_getIndexNode("<<node<<", [";
-	for (uint i=0; i<nodes.size(); i++)
-		std::cout<<nodes[i]<<" ";
-	std::cout<<" ], "<<ni<<", "<<nj<<", "<<nk<<")"<<std::endl;
+	std::cout<<"MeshImplementation::_getIndexNode("<<node<<", "<<indices.size()
+			<<" noeuds au bord, "<<ni<<", "<<nj<<")"<<std::endl;
 #endif
 
 	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
@@ -1529,22 +2157,28 @@ uint MeshImplementation::_getIndiceIJK(std::vector<std::vector<uint> >& idxIJK_v
 /*----------------------------------------------------------------------------*/
 void MeshImplementation::undoCreatedMesh(Mesh::CommandCreateMesh* command)
 {
-    // destruction des entités
-    std::vector<gmds::TCellID>& regions = command->createdRegions();
+    gmds::IGMesh& gmds_mesh = getGMDSMesh();
+
+    // destruction des entités, parcours des intervalles d'id créés
+    const std::vector<CellIdIntervals::Interval>& regions = command->createdRegions().intervals();
     for (uint i=0; i<regions.size(); i++)
-        getGMDSMesh().deleteRegion(regions[i]);
+        for (gmds::TCellID id=regions[i].first; id<regions[i].second; id++)
+            gmds_mesh.deleteRegion(id);
 
-    std::vector<gmds::TCellID>& faces = command->createdFaces();
+    const std::vector<CellIdIntervals::Interval>& faces = command->createdFaces().intervals();
     for (uint i=0; i<faces.size(); i++)
-        getGMDSMesh().deleteFace(faces[i]);
+        for (gmds::TCellID id=faces[i].first; id<faces[i].second; id++)
+            gmds_mesh.deleteFace(id);
 
-    std::vector<gmds::TCellID>& edges = command->createdEdges();
+    const std::vector<CellIdIntervals::Interval>& edges = command->createdEdges().intervals();
     for (uint i=0; i<edges.size(); i++)
-        getGMDSMesh().deleteEdge(edges[i]);
+        for (gmds::TCellID id=edges[i].first; id<edges[i].second; id++)
+            gmds_mesh.deleteEdge(id);
 
-    std::vector<gmds::TCellID>& nodes = command->createdNodes();
+    const std::vector<CellIdIntervals::Interval>& nodes = command->createdNodes().intervals();
     for (uint i=0; i<nodes.size(); i++)
-        getGMDSMesh().deleteNode(nodes[i]);
+        for (gmds::TCellID id=nodes[i].first; id<nodes[i].second; id++)
+            gmds_mesh.deleteNode(id);
 }
 /*----------------------------------------------------------------------------*/
 void MeshImplementation::deleteMesh()
@@ -28,6 +28,7 @@
 
 #include "Utils/Common.h"
 #include "Utils/MgxNumeric.h"
+#include "Utils/ParallelExecution.h"
 #include "Internal/Context.h"
 #include "Geom/Surface.h"
 #include "Geom/Curve.h"
@@ -59,6 +60,7 @@
 #include "Pyramide.h"
 #include <TkUtil/Timer.h>
 /*----------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
@@ -68,6 +70,8 @@ namespace Mesh {
 //#define _DEBUG_GROUP_BY_TOPO_ENTITY
 //#define _DEBUG_TIMER
 /*----------------------------------------------------------------------------*/
+const uint MeshImplementation::NB_NOEUDS_MIN_TRANSFINI_PARALLELE = 100000;
+/*----------------------------------------------------------------------------*/
 void MeshImplementation::preMeshStrutured(Topo::Block* bl)
 {
 #ifdef _DEBUG_MESH_FUNCTION
@@ -466,6 +470,12 @@ void MeshImplementation::preMeshStrutured(Topo::Block* bl)
     } else {
     	throw TkUtil::Exception (TkUtil::UTF8String ("Erreur interne dans MeshImplementation::meshStrutured pour block, type de maillage invalide", TkUtil::Charset::UTF_8));
     }
+
+    // l'orientation des hexaèdres est testée ici sur les points, ce qui se
+    // fait en parallèle d'un bloc à l'autre, la création des mailles dans
+    // le maillage gmds étant séquentielle
+    _testRegionsOrientation(bl, nbBrasI, nbBrasJ, nbBrasK);
+
 #ifdef _DEBUG_TIMER
     timer.stop();
     std::cout<<"création des points d'un bloc "<<timer.cpuDuration()/TkUtil::Timer::cpuPerSecond()<<" secondes"<<std::endl;
@@ -498,14 +508,24 @@ void MeshImplementation::meshStrutured(Mesh::CommandCreateMesh* command, Topo::B
     const uint nbNoeudsJ = nbBrasJ + 1;
     const uint nbNoeudsK = nbBrasK + 1;
 
+    // les noeuds créés sont mémorisés en une seule fois pour la commande
+    std::vector<gmds::TCellID> created_nodes;
+    if (nbBrasI>1 && nbBrasJ>1 && nbBrasK>1)
+    	created_nodes.reserve((nbBrasI-1)*(nbBrasJ-1)*(nbBrasK-1));
+
+    gmds::IGMesh& gmds_mesh = getGMDSMesh();
+    Utils::Math::Point* l_points = bl->points();
+    std::vector<gmds::TCellID>& l_nodes = bl->nodes();
     for (uint i=1; i<nbBrasI; i++)
         for (uint j=1; j<nbBrasJ; j++)
             for (uint k=1; k<nbBrasK; k++) {
-                Utils::Math::Point &pt = bl->points()[i+nbNoeudsI*j+k*nbNoeudsI*nbNoeudsJ];
-                gmds::Node nd = getGMDSMesh().newNode(pt.getX(), pt.getY(), pt.getZ());
-                bl->nodes()[i+nbNoeudsI*j+k*nbNoeudsI*nbNoeudsJ] = nd.getID();
-                command->addCreatedNode(nd.getID());
+                const uint ind = i+nbNoeudsI*j+k*nbNoeudsI*nbNoeudsJ;
+                const Utils::Math::Point &pt = l_points[ind];
+                gmds::TCellID id = gmds_mesh.newNode(pt.getX(), pt.getY(), pt.getZ()).getID();
+                l_nodes[ind] = id;
+                created_nodes.push_back(id);
             }
+    command->addCreatedNodes(created_nodes);
 
     delete [] bl->points();
     bl->points() = 0;
@@ -1077,9 +1097,88 @@ void MeshImplementation::discretiseTransfinie (uint nbBrasI, uint nbBrasJ, uint
     _calculDistancesJfixe(uijZ, 1, nbNoeudsI, nbNoeudsJ);
     _setToVal(uijZ, 2, nbNoeudsI, nbNoeudsJ, 1.0);
 
-    for (kk=1; kk<nbBrasK; kk++)
-        for (jj=1; jj<nbBrasJ; jj++)
-            for (ii=1; ii<nbBrasI; ii++){
+    // remplissage de l'intérieur par tranches suivant kk, indépendantes
+    // les unes des autres, en parallèle pour les gros blocs (ceux-ci sont
+    // prémaillés hors des tâches de CommandCreateMesh::preMesh)
+    const uint nbInternes = (nbBrasI>0?nbBrasI-1:0)*(nbBrasJ>0?nbBrasJ-1:0)*(nbBrasK>0?nbBrasK-1:0);
+    try {
+    	if (nbInternes >= NB_NOEUDS_MIN_TRANSFINI_PARALLELE && nbBrasK > 2)
+    		Utils::executeEnParallele(nbBrasK-1, [&](uint t){
+    			_discretiseTransfinieTranche(nbBrasI, nbBrasJ, nbBrasK, l_points,
+    					ui0k, uiYk, uij0, uijZ, u0jk, uXjk, t+1, t+2);
+    		});
+    	else
+    		_discretiseTransfinieTranche(nbBrasI, nbBrasJ, nbBrasK, l_points,
+    				ui0k, uiYk, uij0, uijZ, u0jk, uXjk, 1, nbBrasK);
+    }
+    catch (...){
+    	delete[] ui0k;
+    	delete[] uiYk;
+    	delete[] uij0;
+    	delete[] uijZ;
+    	delete[] u0jk;
+    	delete[] uXjk;
+    	throw;
+    }
+
+    delete[] ui0k;
+    delete[] uiYk;
+    delete[] uij0;
+    delete[] uijZ;
+    delete[] u0jk;
+    delete[] uXjk;
+
+#ifdef _DEBUG_MESH
+    std::cout<<"MeshImplementation::discretiseTransfinie ("<<nbBrasI<<", "<<nbBrasJ<<", "<<nbBrasK<<")\n";
+    for (kk=0; kk<nbNoeudsK; kk++)
+        for (jj=0; jj<nbNoeudsJ; jj++)
+            for (ii=0; ii<nbNoeudsI; ii++){
+                std::cout<<"getPoint("<<ii<<","<<jj<<","<<kk<<") = "<<getPoint(ii,jj,kk)<<std::endl;
+            }
+#endif
+
+#undef getPoint
+} // end discretiseTransfinie (3d)
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::_discretiseTransfinieTranche(uint nbBrasI, uint nbBrasJ, uint nbBrasK,
+		Utils::Math::Point* l_points,
+		Utils::Math::Point* ui0k, Utils::Math::Point* uiYk,
+		Utils::Math::Point* uij0, Utils::Math::Point* uijZ,
+		Utils::Math::Point* u0jk, Utils::Math::Point* uXjk,
+		uint kDeb, uint kFin)
+{
+    const uint nbNoeudsI = nbBrasI + 1;
+    const uint nbNoeudsJ = nbBrasJ + 1;
+
+#define getPoint(ii,jj,kk) l_points[(ii)+nbNoeudsI*(jj)+nbNoeudsI*nbNoeudsJ*(kk)]
+
+    // les 8 sommets du bloc
+    const Utils::Math::Point& p000 = getPoint(0,0,0);
+    const Utils::Math::Point& p00Z = getPoint(0,0,nbBrasK);
+    const Utils::Math::Point& p0Y0 = getPoint(0,nbBrasJ,0);
+    const Utils::Math::Point& p0YZ = getPoint(0,nbBrasJ,nbBrasK);
+    const Utils::Math::Point& pX00 = getPoint(nbBrasI,0,0);
+    const Utils::Math::Point& pX0Z = getPoint(nbBrasI,0,nbBrasK);
+    const Utils::Math::Point& pXY0 = getPoint(nbBrasI,nbBrasJ,0);
+    const Utils::Math::Point& pXYZ = getPoint(nbBrasI,nbBrasJ,nbBrasK);
+
+    for (uint kk=kDeb; kk<kFin; kk++){
+        // les points de la tranche sur les arêtes du bloc
+        const Utils::Math::Point& p00k = getPoint(0,0,kk);
+        const Utils::Math::Point& p0Yk = getPoint(0,nbBrasJ,kk);
+        const Utils::Math::Point& pX0k = getPoint(nbBrasI,0,kk);
+        const Utils::Math::Point& pXYk = getPoint(nbBrasI,nbBrasJ,kk);
+
+        for (uint jj=1; jj<nbBrasJ; jj++){
+            // ce qui ne dépend pas de ii
+            const Utils::Math::Point& p0jk = getPoint(0,jj,kk);
+            const Utils::Math::Point& pXjk = getPoint(nbBrasI,jj,kk);
+            const Utils::Math::Point& p0j0 = getPoint(0,jj,0);
+            const Utils::Math::Point& pXj0 = getPoint(nbBrasI,jj,0);
+            const Utils::Math::Point& p0jZ = getPoint(0,jj,nbBrasK);
+            const Utils::Math::Point& pXjZ = getPoint(nbBrasI,jj,nbBrasK);
+
+            for (uint ii=1; ii<nbBrasI; ii++){
                 // détermination du point uijk interne au cube unité qui minimise la somme des carrés des distances aux 3 droites
                 Utils::Math::Point uijk = minDist3Droites(u0jk[jj+nbNoeudsJ*kk],uXjk[jj+nbNoeudsJ*kk],
                         ui0k[ii+nbNoeudsI*kk],uiYk[ii+nbNoeudsI*kk],
@@ -1091,46 +1190,31 @@ void MeshImplementation::discretiseTransfinie (uint nbBrasI, uint nbBrasJ, uint
 
                 // l'interpolation
                 getPoint(ii,jj,kk)
-                = (1-xx)*getPoint(0,jj,kk) + xx*getPoint(nbBrasI,jj,kk)
+                = (1-xx)*p0jk + xx*pXjk
                 + (1-yy)*getPoint(ii,0,kk) + yy*getPoint(ii,nbBrasJ,kk)
                 + (1-zz)*getPoint(ii,jj,0) + zz*getPoint(ii,jj,nbBrasK)
 
-                - (1-xx)*((1-yy)*getPoint(0,0,kk)       + yy*getPoint(0,nbBrasJ,kk))
-                - xx    *((1-yy)*getPoint(nbBrasI,0,kk) + yy*getPoint(nbBrasI,nbBrasJ,kk))
+                - (1-xx)*((1-yy)*p00k + yy*p0Yk)
+                - xx    *((1-yy)*pX0k + yy*pXYk)
 
                 - (1-yy)*((1-zz)*getPoint(ii,0,0)       + zz*getPoint(ii,0,nbBrasK))
                 - yy    *((1-zz)*getPoint(ii,nbBrasJ,0) + zz*getPoint(ii,nbBrasJ,nbBrasK))
 
-                - (1-zz)*((1-xx)*getPoint(0,jj,0)       + xx*getPoint(nbBrasI,jj,0))
-                - zz    *((1-xx)*getPoint(0,jj,nbBrasK) + xx*getPoint(nbBrasI,jj,nbBrasK))
+                - (1-zz)*((1-xx)*p0j0 + xx*pXj0)
+                - zz    *((1-xx)*p0jZ + xx*pXjZ)
 
-                + (1-xx)*( (1-yy)*((1-zz)*getPoint(0,0,0)       + zz*getPoint(0,0,nbBrasK))
-                        + yy  *((1-zz)*getPoint(0,nbBrasJ,0) + zz*getPoint(0,nbBrasJ,nbBrasK)))
+                + (1-xx)*( (1-yy)*((1-zz)*p000 + zz*p00Z)
+                        + yy  *((1-zz)*p0Y0 + zz*p0YZ))
 
-                        + xx*( (1-yy)*((1-zz)*getPoint(nbBrasI,0,0)       + zz*getPoint(nbBrasI,0,nbBrasK))
-                                + yy  *((1-zz)*getPoint(nbBrasI,nbBrasJ,0) + zz*getPoint(nbBrasI,nbBrasJ,nbBrasK)))
+                        + xx*( (1-yy)*((1-zz)*pX00 + zz*pX0Z)
+                                + yy  *((1-zz)*pXY0 + zz*pXYZ))
                                 ;
-
-            }
-
-    delete[] ui0k;
-    delete[] uiYk;
-    delete[] uij0;
-    delete[] uijZ;
-    delete[] u0jk;
-    delete[] uXjk;
-
-#ifdef _DEBUG_MESH
-    std::cout<<"MeshImplementation::discretiseTransfinie ("<<nbBrasI<<", "<<nbBrasJ<<", "<<nbBrasK<<")\n";
-    for (kk=0; kk<nbNoeudsK; kk++)
-        for (jj=0; jj<nbNoeudsJ; jj++)
-            for (ii=0; ii<nbNoeudsI; ii++){
-                std::cout<<"getPoint("<<ii<<","<<jj<<","<<kk<<") = "<<getPoint(ii,jj,kk)<<std::endl;
-            }
-#endif
+            } // end for ii
+        } // end for jj
+    } // end for kk
 
 #undef getPoint
-} // end discretiseTransfinie (3d)
+} // end _discretiseTransfinieTranche
 /*----------------------------------------------------------------------------*/
 void MeshImplementation::discretiseDirection (
         Topo::CoEdgeMeshingProperty* dni,
@@ -1186,6 +1270,15 @@ void MeshImplementation::discretiseDirection (
         throw TkUtil::Exception(messageErr);
     }
 
+    // les coefficients ne dépendent de la longueur que pour certaines lois,
+    // sinon ils sont calculés une seule fois pour toutes les lignes
+    std::vector<double> coeffs;
+    const bool coeffsParLigne = disc->needLengthToInitialize();
+    if (!coeffsParLigne){
+        disc->initCoeff();
+        disc->getCoeffs(coeffs);
+    }
+
     for (uint ind1=1; ind1<indMax1; ind1++){
         for (uint ind2=1; ind2<indMax2; ind2++){
             Utils::Math::Point &pt0 = l_points[incr1*ind1+incr2*ind2];
@@ -1197,10 +1290,13 @@ void MeshImplementation::discretiseDirection (
 #endif
 
             Utils::Math::Point vect = (ptN - pt0);
-            disc->initCoeff(vect.norme());
+            if (coeffsParLigne){
+                disc->initCoeff(vect.norme());
+                disc->getCoeffs(coeffs);
+            }
 
             for (uint ind3=1; ind3<indMax3; ind3++)
-                l_points[incr1*ind1+incr2*ind2+incr3*ind3] = (vect * disc->nextCoeff()) + pt0;
+                l_points[incr1*ind1+incr2*ind2+incr3*ind3] = (vect * coeffs[ind3]) + pt0;
         }
     }
 
@@ -1266,6 +1362,15 @@ void MeshImplementation::discretiseOrthogonalPuisCourbe (
     if (side == 1)
     	disc->setDirect(!disc->getDirect());
 
+    // les coefficients ne dépendent de la longueur que pour certaines lois,
+    // sinon ils sont calculés une seule fois pour toutes les lignes
+    std::vector<double> coeffs;
+    const bool coeffsParLigne = disc->needLengthToInitialize();
+    if (!coeffsParLigne){
+        disc->initCoeff();
+        disc->getCoeffs(coeffs);
+    }
+
     for (uint ind1=1; ind1<indMax1; ind1++){
         for (uint ind2=1; ind2<indMax2; ind2++){
             Utils::Math::Point &pt0 = l_points[incr1*ind1+incr2*ind2];
@@ -1303,13 +1408,16 @@ void MeshImplementation::discretiseOrthogonalPuisCourbe (
             	if (Utils::Math::scaMul(vect, normale)<0.0)
             		normale *= -1;
 
-                disc->initCoeff(dist);
+                if (coeffsParLigne){
+                    disc->initCoeff(dist);
+                    disc->getCoeffs(coeffs);
+                }
 
                 // tous les points alignés et orthogonaux
                 for (uint ind3=1; ind3<indMax3; ind3++)
-                	ptInternes.push_back((normale * disc->nextCoeff()) + pt0);
+                	ptInternes.push_back((normale * coeffs[ind3]) + pt0);
                 // le point image de ptN
-                ptInternes.push_back((normale * disc->nextCoeff()) + pt0);
+                ptInternes.push_back((normale * coeffs[indMax3]) + pt0);
 
                 // déplace les point pour se raccorder à ptN
                 courbeDiscretisation(ptN, ptInternes, nbLayers);
@@ -1340,13 +1448,16 @@ void MeshImplementation::discretiseOrthogonalPuisCourbe (
             	if (Utils::Math::scaMul(vect, normale)<0.0)
             		normale *= -1;
 
-                disc->initCoeff(dist);
+                if (coeffsParLigne){
+                    disc->initCoeff(dist);
+                    disc->getCoeffs(coeffs);
+                }
 
                 // tous les points alignés et orthogonaux
-                for (uint ind3=indMax3-1; ind3>=1; ind3--)
-                	ptInternes.push_back(ptN - (normale * disc->nextCoeff()));
+                for (uint ind3=1; ind3<indMax3; ind3++)
+                	ptInternes.push_back(ptN - (normale * coeffs[ind3]));
                 // le point image de pt0
-                ptInternes.push_back(ptN - (normale * disc->nextCoeff()));
+                ptInternes.push_back(ptN - (normale * coeffs[indMax3]));
 
                 // déplace les point pour se raccorder à pt0
                 courbeDiscretisation(pt0, ptInternes, nbLayers);
@@ -1442,15 +1553,27 @@ void MeshImplementation::discretiseDirection (
         throw TkUtil::Exception(messageErr);
     }
 
+    // les coefficients ne dépendent de la longueur que pour certaines lois,
+    // sinon ils sont calculés une seule fois pour toutes les lignes
+    std::vector<double> coeffs;
+    const bool coeffsParLigne = disc->needLengthToInitialize();
+    if (!coeffsParLigne){
+        disc->initCoeff();
+        disc->getCoeffs(coeffs);
+    }
+
     for (uint ind1=1; ind1<indMax1; ind1++){
       Utils::Math::Point &pt0 = l_points[incr1*ind1];
       Utils::Math::Point &ptN = l_points[incr1*ind1+incr2*indMax2];
 
       Utils::Math::Point vect = (ptN - pt0);
-      disc->initCoeff(vect.norme());
+      if (coeffsParLigne){
+        disc->initCoeff(vect.norme());
+        disc->getCoeffs(coeffs);
+      }
 
       for (uint ind2=1; ind2<indMax2; ind2++)
-        l_points[incr1*ind1+incr2*ind2] = (vect * disc->nextCoeff()) + pt0;
+        l_points[incr1*ind1+incr2*ind2] = (vect * coeffs[ind2]) + pt0;
     }
 
 } // end discretiseDirection (2d)
@@ -1498,6 +1621,15 @@ void MeshImplementation::discretiseOrthogonalPuisCourbe (
     if (side == 1)
     	disc->setDirect(!disc->getDirect());
 
+    // les coefficients ne dépendent de la longueur que pour certaines lois,
+    // sinon ils sont calculés une seule fois pour toutes les lignes
+    std::vector<double> coeffs;
+    const bool coeffsParLigne = disc->needLengthToInitialize();
+    if (!coeffsParLigne){
+        disc->initCoeff();
+        disc->getCoeffs(coeffs);
+    }
+
     for (uint ind1=1; ind1<indMax1; ind1++){
       Utils::Math::Point &pt0 = l_points[incr1*ind1];
       Utils::Math::Point &ptN = l_points[incr1*ind1+incr2*indMax2];
@@ -1527,12 +1659,15 @@ void MeshImplementation::discretiseOrthogonalPuisCourbe (
     	  if (Utils::Math::scaMul(vect, normale)<0.0)
     		  normale *= -1;
 
-    	  disc->initCoeff(dist);
+    	  if (coeffsParLigne){
+    		  disc->initCoeff(dist);
+    		  disc->getCoeffs(coeffs);
+    	  }
 
           for (uint ind2=1; ind2<indMax2; ind2++)
-        	  ptInternes.push_back((normale * disc->nextCoeff()) + pt0);
+        	  ptInternes.push_back((normale * coeffs[ind2]) + pt0);
           // le point image de ptN
-          ptInternes.push_back((normale * disc->nextCoeff()) + pt0);
+          ptInternes.push_back((normale * coeffs[indMax2]) + pt0);
 
           // déplace les point pour se raccorder à ptN
           courbeDiscretisation(ptN, ptInternes, nbLayers);
@@ -1559,12 +1694,15 @@ void MeshImplementation::discretiseOrthogonalPuisCourbe (
     	  if (Utils::Math::scaMul(vect, normale)<0.0)
     		  normale *= -1;
 
-    	  disc->initCoeff(dist);
+    	  if (coeffsParLigne){
+    		  disc->initCoeff(dist);
+    		  disc->getCoeffs(coeffs);
+    	  }
 
-          for (uint ind2=indMax2-1; ind2>=1; ind2--)
-        	  ptInternes.push_back(ptN - (normale * disc->nextCoeff()));
+          for (uint ind2=1; ind2<indMax2; ind2++)
+        	  ptInternes.push_back(ptN - (normale * coeffs[ind2]));
           // le point image de pt0
-          ptInternes.push_back(ptN - (normale * disc->nextCoeff()));
+          ptInternes.push_back(ptN - (normale * coeffs[indMax2]));
 
           // déplace les point pour se raccorder à ptN
           courbeDiscretisation(pt0, ptInternes, nbLayers);
@@ -1848,6 +1986,87 @@ void MeshImplementation::_setToVal(Utils::Math::Point* uij, uint indCoord, uint
             uij[ii+nbNoeudsI*jj].setCoord(indCoord,val);
 }
 /*----------------------------------------------------------------------------*/
+void MeshImplementation::_testRegionsOrientation(Topo::Block* bl,
+        uint nbBrasI, uint nbBrasJ, uint nbBrasK)
+{
+    const uint nbNoeudsI = nbBrasI + 1;
+    const uint nbNoeudsJ = nbBrasJ + 1;
+
+    Utils::Math::Point* l_points = bl->points();
+
+#define pointIJ(ii,jj,kk) l_points[ii+(jj)*nbNoeudsI+(kk)*nbNoeudsI*nbNoeudsJ]
+
+    uint kEnd = nbBrasK;
+    if (bl->getNbVertices() != 8) // K MAX
+        kEnd-=1;
+
+    // on ne teste que les mailles du bord et une sur testOnDir dans chaque direction
+    const unsigned int testOnDir = 9;
+    std::vector<uint> indI, indJ, indK;
+    for (uint i=0; i<nbBrasI; i++)
+    	if (i==0 || i==nbBrasI-1 || i%testOnDir==nbBrasI%testOnDir)
+    		indI.push_back(i);
+    for (uint j=0; j<nbBrasJ; j++)
+    	if (j==0 || j==nbBrasJ-1 || j%testOnDir==nbBrasJ%testOnDir)
+    		indJ.push_back(j);
+    for (uint k=0; k<kEnd; k++)
+    	if (k==0 || k==kEnd-1 || k%testOnDir==kEnd%testOnDir)
+    		indK.push_back(k);
+
+    const unsigned int nbTests = indI.size()*indJ.size()*indK.size();
+    unsigned int nbPos = 0;
+    unsigned int nbTestsInv = 0;
+    unsigned int nbPosInv = 0;
+
+    if (nbTests){
+    	Qualif::Hexaedre maille_tmp;
+    	Qualif::Vecteur sommets[8];
+    	for (uint kk=0; kk<indK.size(); kk++)
+    		for (uint jj=0; jj<indJ.size(); jj++)
+    			for (uint ii=0; ii<indI.size(); ii++){
+    				const uint i = indI[ii];
+    				const uint j = indJ[jj];
+    				const uint k = indK[kk];
+    				const Utils::Math::Point* pts[8] = {
+    						&pointIJ(i,j,k), &pointIJ(i+1,j,k),
+    						&pointIJ(i+1,j+1,k), &pointIJ(i,j+1,k),
+    						&pointIJ(i,j,k+1), &pointIJ(i+1,j,k+1),
+    						&pointIJ(i+1,j+1,k+1), &pointIJ(i,j+1,k+1)};
+
+    				for (uint n=0; n<8; n++)
+    					sommets[n] = Qualif::Vecteur(pts[n]->getX(), pts[n]->getY(), pts[n]->getZ());
+    				maille_tmp.Init_Sommets(sommets);
+    				if (maille_tmp.AppliqueCritere((Qualif::VALIDITY)) == 1.){
+    					nbPos++;
+    				}
+    				else {
+    					// on teste la maille inversée
+    					nbTestsInv++;
+    					for (uint n=0; n<8; n++)
+    						sommets[(n+4)%8] = Qualif::Vecteur(pts[n]->getX(), pts[n]->getY(), pts[n]->getZ());
+    					maille_tmp.Init_Sommets(sommets);
+    					if (maille_tmp.AppliqueCritere((Qualif::VALIDITY)) == 1.)
+    						nbPosInv++;
+    				}
+    			}
+    }
+#undef pointIJ
+
+    bl->getMeshingData()->setRegionsOrientation(nbTests != 0, nbPos<nbPosInv);
+
+    if ((nbPos != nbTests) && (nbPosInv != nbTestsInv)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "Des hexaédres semblent inversés "
+                << "dans le maillage structuré du bloc "
+                << bl->getName()
+                <<". Il est recommandé de vérifier la qualité du maillage "
+                <<"et de vérifier que les blocs sont bien tels qu'attendus.";
+        getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
+
+        bl->getMeshingData()->setMeshCrossed(true);
+    }
+} // end _testRegionsOrientation
+/*----------------------------------------------------------------------------*/
 void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command, Topo::Block* bl,
         uint nbBrasI, uint nbBrasJ, uint nbBrasK)
 //#define _DEBUG2
@@ -1884,115 +2103,17 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
         kEnd-=1;
 
     gmds::IGMesh& gmds_mesh = getGMDSMesh();
-    bool areRegionsTested = false;
-    bool areRegionsInverted = false;
+    // résultat du test fait lors du calcul des points (cf _testRegionsOrientation)
+    bool areRegionsTested = bl->getMeshingData()->areRegionsTested();
+    bool areRegionsInverted = bl->getMeshingData()->areRegionsInverted();
     unsigned int testOnDir = 9;
     unsigned int nbTests = 0;
     unsigned int nbPos = 0;
     unsigned int nbTestsInv = 0;
     unsigned int nbPosInv = 0;
-    // first loop in order to check if the cells are inverted
-    {
-    	Qualif::Hexaedre* maille_tmp = new Qualif::Hexaedre();
-#ifdef _DEBUG2
-    	std::cout<<" iEnd-iBegin = "<<iEnd-iBegin<<std::endl;
-    	std::cout<<" jEnd-jBegin = "<<jEnd-jBegin<<std::endl;
-    	std::cout<<" kEnd-kBegin = "<<kEnd-kBegin<<std::endl;
-    	uint id = 0;
-#endif
-        for (uint k=kBegin; k<kEnd; k++) {
-            for (uint j=jBegin; j<jEnd; j++) {
-                for (uint i=iBegin; i<iEnd; i++) {
-#ifdef _DEBUG2
-                	id++;
-#endif
 
-                	if(
-                		(k==kBegin || k==kEnd-1 || (k-kBegin)%testOnDir==(kEnd-kBegin)%testOnDir) &&
-                		(j==jBegin || j==jEnd-1 || (j-jBegin)%testOnDir==(jEnd-jBegin)%testOnDir) &&
-                		(i==iBegin || i==iEnd-1 || (i-iBegin)%testOnDir==(iEnd-iBegin)%testOnDir)
-                	) {
-                		areRegionsTested = true;
-
-                		nbTests++;
-                        gmds::Node nd1 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j,k));
-                        gmds::Node nd2 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j,k));
-                        gmds::Node nd3 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j+1,k));
-                        gmds::Node nd4 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j+1,k));
-                        gmds::Node nd5 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j,k+1));
-                        gmds::Node nd6 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j,k+1));
-                        gmds::Node nd7 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j+1,k+1));
-                        gmds::Node nd8 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j+1,k+1));
-
-                    	Qualif::Vecteur *sommets = new Qualif::Vecteur[8];
-                    	sommets[0] = Qualif::Vecteur(nd1.X(), nd1.Y(), nd1.Z());
-                    	sommets[1] = Qualif::Vecteur(nd2.X(), nd2.Y(), nd2.Z());
-                    	sommets[2] = Qualif::Vecteur(nd3.X(), nd3.Y(), nd3.Z());
-                    	sommets[3] = Qualif::Vecteur(nd4.X(), nd4.Y(), nd4.Z());
-                    	sommets[4] = Qualif::Vecteur(nd5.X(), nd5.Y(), nd5.Z());
-                    	sommets[5] = Qualif::Vecteur(nd6.X(), nd6.Y(), nd6.Z());
-                    	sommets[6] = Qualif::Vecteur(nd7.X(), nd7.Y(), nd7.Z());
-                    	sommets[7] = Qualif::Vecteur(nd8.X(), nd8.Y(), nd8.Z());
-
-                    	maille_tmp->Init_Sommets(sommets);
-                    	double crit = maille_tmp->AppliqueCritere((Qualif::VALIDITY));
-#ifdef _DEBUG2
-                    	std::cout<<"AppliqueCritere pour i,j,k: "<<i<<","<<j<<","<<k<<", id = "<<id<<" => "<<crit<<std::endl;
-#endif
-                    	if(crit==1.) {
-                    		nbPos++;
-                    	}
-                    	else {
-                    		// on teste la maille inversée
-                    		nbTestsInv++;
-
-                        	sommets[4] = Qualif::Vecteur(nd1.X(), nd1.Y(), nd1.Z());
-                        	sommets[5] = Qualif::Vecteur(nd2.X(), nd2.Y(), nd2.Z());
-                        	sommets[6] = Qualif::Vecteur(nd3.X(), nd3.Y(), nd3.Z());
-                        	sommets[7] = Qualif::Vecteur(nd4.X(), nd4.Y(), nd4.Z());
-                        	sommets[0] = Qualif::Vecteur(nd5.X(), nd5.Y(), nd5.Z());
-                        	sommets[1] = Qualif::Vecteur(nd6.X(), nd6.Y(), nd6.Z());
-                        	sommets[2] = Qualif::Vecteur(nd7.X(), nd7.Y(), nd7.Z());
-                        	sommets[3] = Qualif::Vecteur(nd8.X(), nd8.Y(), nd8.Z());
-                        	maille_tmp->Init_Sommets(sommets);
-                        	double crit = maille_tmp->AppliqueCritere((Qualif::VALIDITY));
-#ifdef _DEBUG2
-                        	std::cout<<"AppliqueCritere inversé pour i,j,k: "<<i<<","<<j<<","<<k<<", id = "<<id<<" => "<<crit<<std::endl;
-#endif
-                        	if(crit==1.) {
-                        		nbPosInv++;
-                        	}
-                    	}
-						delete [] sommets;
-                	}
-                }
-            }
-        }
-
-        if (nbPos<nbPosInv)
-        	areRegionsInverted = true;
-#ifdef _DEBUG2
-        std::cout<<" nbTests = "<<nbTests<<std::endl;
-        std::cout<<" nbPos = "<<nbPos<<std::endl;
-        std::cout<<" nbTestsInv = "<<nbTestsInv<<std::endl;
-        std::cout<<" nbPosInv = "<<nbPosInv<<std::endl;
-        std::cout<<" areRegionsInverted = "<<areRegionsInverted<<std::endl;
-        std::cout<<" areRegionsTested = "<<areRegionsTested<<std::endl;
-#endif
-
-        if ((nbPos != nbTests) && (nbPosInv != nbTestsInv)){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message << "Des hexaédres semblent inversés "
-                    << "dans le maillage structuré du bloc "
-                    << bl->getName()
-                    <<". Il est recommandé de vérifier la qualité du maillage "
-                    <<"et de vérifier que les blocs sont bien tels qu'attendus.";
-            getContext().getLogStream()->log (TkUtil::TraceLog (message, TkUtil::Log::ERROR));
-
-            bl->getMeshingData()->setMeshCrossed(true);
-        }
-        delete maille_tmp;
-    }
+    const size_t nbElemDep = elem.size();
+    elem.reserve(nbElemDep + (iEnd-iBegin)*(jEnd-jBegin)*(kEnd+1-kBegin));
 
     // les hexaèdres
     for (uint k=kBegin; k<kEnd; k++) {
@@ -2015,7 +2136,6 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
                 	r = getGMDSMesh().newHex(nd5,nd6,nd7,nd8,nd1,nd2,nd3,nd4);
                 }
                 elem.push_back(r.getID());
-                command->addCreatedRegion(r.getID());
 
             } // for (uint i=iBegin; i<iEnd; i++) {
         } // for (uint j=jBegin; j<jEnd; j++) {
@@ -2206,7 +2326,6 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
         			}
 
         			elem.push_back(r.getID());
-        			command->addCreatedRegion(r.getID());
 
         		} // for (uint i=iBegin; i<iEnd; i++){
         	} // for (uint j=jBegin; j<jEnd; j++) {
@@ -2216,6 +2335,8 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
 
 #undef nodeIJ
 
+    command->addCreatedRegions(elem, nbElemDep);
+
     // ajout des polyedres aux volumes
     for (size_t i=0; i<groupsName.size(); i++){
         std::string& nom = groupsName[i];
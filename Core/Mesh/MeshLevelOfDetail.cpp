@@ -0,0 +1,183 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MeshLevelOfDetail.cpp
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Mesh/MeshLevelOfDetail.h"
+#include "Topo/Block.h"
+#include "Topo/CoFace.h"
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IGMesh.h>
+#include <TkUtil/Exception.h>
+#include <TkUtil/UTF8String.h>
+#include <map>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+MeshLevelOfDetail::MeshLevelOfDetail(uint ratio, bool skin)
+: m_ratio(ratio < 1 ? 1 : ratio)
+, m_skin(skin)
+, m_nb_polyedres(0)
+, m_nb_polygones(0)
+{
+}
+/*----------------------------------------------------------------------------*/
+void MeshLevelOfDetail::
+addBlocks(const std::vector<Topo::Block*>& blocs, gmds::IGMesh& gmdsMesh)
+{
+	// les blocs non structurés ou dégénérés sont représentés par leur peau,
+	// on compte le nombre de fois où chaque face commune est vue
+	std::map<Topo::CoFace*, int> marque_faces;
+	for (uint i=0; i<blocs.size(); i++){
+		Topo::Block* bloc = blocs[i];
+		if (!bloc->isMeshed())
+			continue;
+		if (bloc->isStructured() && bloc->getNbVertices() == 8)
+			addStructuredBlock(bloc, gmdsMesh);
+		else {
+			std::vector<Topo::CoFace*> cofaces;
+			bloc->getCoFaces(cofaces);
+			for (uint j=0; j<cofaces.size(); j++)
+				marque_faces[cofaces[j]] += 1;
+		}
+	}
+
+	std::vector<Topo::CoFace*> peau;
+	for (std::map<Topo::CoFace*, int>::iterator iter = marque_faces.begin();
+			iter != marque_faces.end(); ++iter)
+		if (iter->second == 1)
+			peau.push_back(iter->first);
+	addCoFaces(peau, gmdsMesh);
+}
+/*----------------------------------------------------------------------------*/
+void MeshLevelOfDetail::
+addCoFaces(const std::vector<Topo::CoFace*>& cofaces, gmds::IGMesh& gmdsMesh)
+{
+	for (uint i=0; i<cofaces.size(); i++){
+		Topo::CoFace* coface = cofaces[i];
+		if (coface->isStructured() && addStructuredCoFace(coface, gmdsMesh))
+			continue;
+		addPolygons(coface, gmdsMesh);
+	}
+}
+/*----------------------------------------------------------------------------*/
+void MeshLevelOfDetail::
+sampledIndices(uint nbEdges, std::vector<uint>& indices) const
+{
+	indices.clear();
+	for (uint i=0; i<nbEdges; i+=m_ratio)
+		indices.push_back(i);
+	indices.push_back(nbEdges);
+}
+/*----------------------------------------------------------------------------*/
+size_t MeshLevelOfDetail::
+addPoint(gmds::TCellID id, gmds::IGMesh& gmdsMesh)
+{
+	std::unordered_map<gmds::TCellID, size_t>::iterator iter = m_node2point.find(id);
+	if (iter != m_node2point.end())
+		return iter->second;
+
+	gmds::Node nd = gmdsMesh.get<gmds::Node>(id);
+	size_t ind = m_points.size();
+	m_points.push_back(Utils::Math::Point(nd.X(), nd.Y(), nd.Z()));
+	m_node_ids.push_back(id);
+	m_node2point[id] = ind;
+	return ind;
+}
+/*----------------------------------------------------------------------------*/
+void MeshLevelOfDetail::
+addStructuredBlock(Topo::Block* bloc, gmds::IGMesh& gmdsMesh)
+{
+	uint ni, nj, nk;
+	bloc->getNbMeshingEdges(ni, nj, nk);
+	std::vector<gmds::TCellID>& l_nds = bloc->nodes();
+	const uint nbI = ni+1;
+	const uint nbJ = nj+1;
+	if (l_nds.size() != nbI*nbJ*(nk+1))
+		throw TkUtil::Exception (TkUtil::UTF8String ("Erreur interne dans MeshLevelOfDetail, nombre de noeuds incohérent pour le bloc "+bloc->getName(), TkUtil::Charset::UTF_8));
+
+	std::vector<uint> indI, indJ, indK;
+	sampledIndices(ni, indI);
+	sampledIndices(nj, indJ);
+	sampledIndices(nk, indK);
+
+	// les points du réseau échantillonné
+	const uint si = indI.size(), sj = indJ.size(), sk = indK.size();
+	std::vector<size_t> pts(si*sj*sk);
+	for (uint k=0; k<sk; k++)
+		for (uint j=0; j<sj; j++)
+			for (uint i=0; i<si; i++)
+				pts[i+si*(j+sj*k)] = addPoint(l_nds[indI[i]+nbI*(indJ[j]+nbJ*indK[k])], gmdsMesh);
+
+	for (uint k=0; k+1<sk; k++)
+		for (uint j=0; j+1<sj; j++)
+			for (uint i=0; i+1<si; i++){
+				m_polyedres.push_back(8);
+				m_polyedres.push_back(pts[i  +si*(j  +sj*k)]);
+				m_polyedres.push_back(pts[i+1+si*(j  +sj*k)]);
+				m_polyedres.push_back(pts[i+1+si*(j+1+sj*k)]);
+				m_polyedres.push_back(pts[i  +si*(j+1+sj*k)]);
+				m_polyedres.push_back(pts[i  +si*(j  +sj*(k+1))]);
+				m_polyedres.push_back(pts[i+1+si*(j  +sj*(k+1))]);
+				m_polyedres.push_back(pts[i+1+si*(j+1+sj*(k+1))]);
+				m_polyedres.push_back(pts[i  +si*(j+1+sj*(k+1))]);
+				m_nb_polyedres++;
+			}
+}
+/*----------------------------------------------------------------------------*/
+bool MeshLevelOfDetail::
+addStructuredCoFace(Topo::CoFace* coface, gmds::IGMesh& gmdsMesh)
+{
+	uint ni, nj;
+	coface->getNbMeshingEdges(ni, nj);
+	std::vector<gmds::TCellID>& l_nds = coface->nodes();
+	const uint nbI = ni+1;
+	// cas dégénéré par exemple
+	if (l_nds.size() != nbI*(nj+1))
+		return false;
+
+	std::vector<uint> indI, indJ;
+	sampledIndices(ni, indI);
+	sampledIndices(nj, indJ);
+
+	const uint si = indI.size(), sj = indJ.size();
+	std::vector<size_t> pts(si*sj);
+	for (uint j=0; j<sj; j++)
+		for (uint i=0; i<si; i++)
+			pts[i+si*j] = addPoint(l_nds[indI[i]+nbI*indJ[j]], gmdsMesh);
+
+	for (uint j=0; j+1<sj; j++)
+		for (uint i=0; i+1<si; i++){
+			m_polygones.push_back(4);
+			m_polygones.push_back(pts[i  +si*j]);
+			m_polygones.push_back(pts[i+1+si*j]);
+			m_polygones.push_back(pts[i+1+si*(j+1)]);
+			m_polygones.push_back(pts[i  +si*(j+1)]);
+			m_nb_polygones++;
+		}
+	return true;
+}
+/*----------------------------------------------------------------------------*/
+void MeshLevelOfDetail::
+addPolygons(Topo::CoFace* coface, gmds::IGMesh& gmdsMesh)
+{
+	std::vector<gmds::TCellID>& l_polys = coface->faces();
+	std::vector<gmds::TCellID> nds;
+	for (uint i=0; i<l_polys.size(); i++){
+		nds.clear();
+		gmdsMesh.get<gmds::Face>(l_polys[i]).getAllIDs<gmds::Node>(nds);
+		m_polygones.push_back(nds.size());
+		for (uint j=0; j<nds.size(); j++)
+			m_polygones.push_back(addPoint(nds[j], gmdsMesh));
+		m_nb_polygones++;
+	}
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -63,26 +63,26 @@ void MeshManager::clear()
     m_clouds.deleteAndClear();
     m_surfaces.deleteAndClear();
     m_volumes.deleteAndClear();
+    m_clouds_index.clear();
+    m_surfaces_index.clear();
+    m_volumes_index.clear();
 }
 /*----------------------------------------------------------------------------*/
 void MeshManager::add(Cloud* cl)
 {
     m_clouds.add(cl);
+    m_clouds_index.add(cl);
 }
 /*----------------------------------------------------------------------------*/
 void MeshManager::remove(Cloud* cl)
 {
     m_clouds.remove(cl, true);
+    m_clouds_index.remove(cl);
 }
 /*----------------------------------------------------------------------------*/
 Cloud* MeshManager::getCloud(const std::string& name, const bool exceptionIfNotFound) const
 {
-    Cloud* cloud = 0;
-    const std::vector<Cloud*>& clouds = m_clouds.get();
-    for (std::vector<Cloud*>::const_iterator iter = clouds.begin();
-            iter != clouds.end(); ++iter)
-        if (name == (*iter)->getName())
-            cloud = (*iter);
+    Cloud* cloud = m_clouds_index.find(name);
 
     if (exceptionIfNotFound && cloud == 0){
 		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
@@ -102,21 +102,18 @@ void MeshManager::getClouds(std::vector<Cloud*>& AClouds) const
 void MeshManager::add(Line* ln)
 {
     m_lines.add(ln);
+    m_lines_index.add(ln);
 }
 /*----------------------------------------------------------------------------*/
 void MeshManager::remove(Line* ln)
 {
 	m_lines.remove(ln, true);
+	m_lines_index.remove(ln);
 }
 /*----------------------------------------------------------------------------*/
 Line* MeshManager::getLine(const std::string& name, const bool exceptionIfNotFound) const
 {
-	Line* line = 0;
-    const std::vector<Line*>& lines = m_lines.get();
-    for (std::vector<Line*>::const_iterator iter = lines.begin();
-            iter != lines.end(); ++iter)
-        if (name == (*iter)->getName())
-            line = (*iter);
+	Line* line = m_lines_index.find(name);
 
     if (exceptionIfNotFound && line == 0){
 		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
@@ -136,22 +133,18 @@ void MeshManager::getLines(std::vector<Line*>& ALines) const
 void MeshManager::add(Surface* sf)
 {
     m_surfaces.add(sf);
+    m_surfaces_index.add(sf);
 }
 /*----------------------------------------------------------------------------*/
 void MeshManager::remove(Surface* sf)
 {
     m_surfaces.remove(sf, true);
+    m_surfaces_index.remove(sf);
 }
 /*----------------------------------------------------------------------------*/
 Surface* MeshManager::getSurface(const std::string& name, const bool exceptionIfNotFound) const
 {
-    Surface* surf = 0;
-
-    const std::vector<Surface*>& surfaces = m_surfaces.get();
-    for (std::vector<Surface* >::const_iterator iter = surfaces.begin();
-            iter != surfaces.end(); ++iter)
-        if (name == (*iter)->getName())
-            surf = (*iter);
+    Surface* surf = m_surfaces_index.find(name);
 
     if (exceptionIfNotFound && surf == 0){
 		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
@@ -171,23 +164,19 @@ void MeshManager::getSurfaces(std::vector<Surface*>& ASurfaces) const
 void MeshManager::add(Volume* vo)
 {
     m_volumes.add(vo);
+    m_volumes_index.add(vo);
 }
 /*----------------------------------------------------------------------------*/
 void MeshManager::remove(Volume* vo)
 {
     //std::cout<<"MeshManager::remove("<<vo->getName()<<")"<<std::endl;
     m_volumes.remove(vo, true);
+    m_volumes_index.remove(vo);
 }
 /*----------------------------------------------------------------------------*/
 Volume* MeshManager::getVolume(const std::string& name, const bool exceptionIfNotFound) const
 {
-    Volume* vol = 0;
-
-    const std::vector<Volume*>& volumes = m_volumes.get();
-    for (std::vector<Volume* >::const_iterator iter = volumes.begin();
-            iter != volumes.end(); ++iter)
-        if (name == (*iter)->getName())
-            vol = (*iter);
+    Volume* vol = m_volumes_index.find(name);
 
     if (exceptionIfNotFound && vol == 0){
 		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
@@ -206,12 +195,7 @@ SubVolume* MeshManager::getNewSubVolume(const std::string& gr_name, Internal::In
 	if (gr_name.empty())
 		throw TkUtil::Exception (TkUtil::UTF8String ("Création d'un sous-volume impossible sans un nom", TkUtil::Charset::UTF_8));
 
-	Volume* vol = 0;
-	const std::vector<Volume*>& volumes = m_volumes.get();
-	for (std::vector<Volume* >::const_iterator iter = volumes.begin();
-			iter != volumes.end(); ++iter)
-		if (gr_name == (*iter)->getName())
-			vol = (*iter);
+	Volume* vol = m_volumes_index.find(gr_name);
 
 	if (vol && vol->getType() != Utils::Entity::MeshSubVolume){
 		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
@@ -455,15 +439,17 @@ void MeshManager::smooth()
 
     // trace dans le script
     TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
-    cmd << getContextAlias() << "." << "getMeshManager().smooth(\"" << "poyop" << "\")";
+    cmd << getContextAlias() << "." << "getMeshManager().smooth()";
     command->setScriptCommand(cmd);
 
     getCommandManager().addCommand(command, Utils::Command::DO);
 }
 /*------------------------------------------------------------------------*/
-bool MeshManager::compareWithMesh(std::string nom)
+MeshComparisonReport MeshManager::compareWithMesh(std::string nom, double tolerance)
 {
-    bool ok = true;
+    if (tolerance < 0.0)
+        throw TkUtil::Exception (TkUtil::UTF8String ("La tolérance de comparaison des maillages doit être positive ou nulle", TkUtil::Charset::UTF_8));
+
     MeshImplementation* mesh = (MeshImplementation*)m_mesh_itf;
     gmds::IGMesh& gmdsMesh1 = mesh->getGMDSMesh();
 
@@ -475,16 +461,34 @@ bool MeshManager::compareWithMesh(std::string nom)
     // on ajoute les groupes de mailles de gmds
     mesh->createGMDSGroups();
 
-    // on pourrait prévoir plus de chose en retour
-    Compare2Meshes cmp(&getLocalContext(), gmdsMesh1, gmdsMesh2);
-    ok = cmp.perform();
+    Compare2Meshes cmp(&getLocalContext(), gmdsMesh1, gmdsMesh2, tolerance);
+    MeshComparisonReport resultat;
+    resultat.ok = cmp.perform();
+
+    const Compare2Meshes::Report& rapport = cmp.getReport();
+    resultat.tolerance = rapport.tolerance;
+    for (uint i=0; i<rapport.meshes.size(); i++){
+        const Compare2Meshes::CellsReport& cells = rapport.meshes[i];
+        resultat.nb_cells1[cells.dim] = cells.nbCells1;
+        resultat.nb_cells2[cells.dim] = cells.nbCells2;
+        resultat.nb_unmatched1[cells.dim] = cells.nbUnmatched1;
+        resultat.nb_unmatched2[cells.dim] = cells.nbUnmatched2;
+        resultat.max_deviation[cells.dim] = cells.maxDeviation;
+        resultat.mean_deviation[cells.dim] = cells.meanDeviation;
+    }
+    for (uint i=0; i<rapport.groups.size(); i++)
+        if (!rapport.groups[i].isOk())
+            resultat.different_groups.push_back(rapport.groups[i].name);
+    resultat.groups_only1 = rapport.groupsOnly1;
+    resultat.groups_only2 = rapport.groupsOnly2;
+    resultat.description = rapport.toString().utf8();
 
     // on retire les groupes
     mesh->deleteGMDSGroups();
 
     mesh->deleteLastGMDSMesh();
 
-    return ok;
+    return resultat;
 }
 /*----------------------------------------------------------------------------*/
 std::string MeshManager::getInfos(const std::string& name, int dim) const
@@ -76,7 +76,7 @@ void MeshManagerIfc::smooth ()
 }
 /*----------------------------------------------------------------------------*/
 
-bool MeshManagerIfc::compareWithMesh(std::string nom)
+MeshComparisonReport MeshManagerIfc::compareWithMesh(std::string nom, double tolerance)
 {
     throw TkUtil::Exception ("MeshManagerIfc::compareWithMesh should be overloaded.");
 }
@@ -10,10 +10,12 @@
 // pythonerie à mettre au début (pour permettre ifndef Py_PYTHON_H)
 #include <Python.h>
 #include <memory>				// unique_ptr
+#include <cstring>
 /*----------------------------------------------------------------------------*/
 #include "Mesh/MeshModificationByPythonFunction.h"
 #include "Mesh/MeshImplementation.h"
 #include "Mesh/MeshManager.h"
+#include "Mesh/NodeFilter.h"
 #include "Utils/SerializedRepresentation.h"
 #include "Utils/MgxNumeric.h"
 /*----------------------------------------------------------------------------*/
@@ -30,10 +32,11 @@ namespace Mgx3D {
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
 MeshModificationByPythonFunction::
-MeshModificationByPythonFunction(PyObject* py_obj, eTypeCoord typeCoord)
+MeshModificationByPythonFunction(PyObject* py_obj, eTypeCoord typeCoord, bool batch)
  : MeshModificationItf()
 , m_py_obj(py_obj)
 , m_typeCoord(typeCoord)
+, m_batch(batch)
 {
 
 }
@@ -58,61 +61,147 @@ addToDescription (Mgx3D::Utils::SerializedRepresentation* description) const
 			Utils::SerializedRepresentation::Property (
 					"Type de coordonnées", std::string(m_typeCoord==polar?"polaires":"cartésiennes")));
 
+	description->addProperty (
+			Utils::SerializedRepresentation::Property (
+					"Appel par lots", m_batch));
+
+}
+/*----------------------------------------------------------------------------*/
+/// passage en coordonnées polaires
+static void toPolar(double x, double y, double z, double& rho, double& theta, double& phi)
+{
+	rho = std::sqrt(x*x+y*y+z*z);
+	if (Utils::Math::MgxNumeric::isNearlyZero(rho))
+		theta = 0;
+	else
+		theta = std::asin(z/rho);
+	phi = std::atan2(y, x);
+}
+/*----------------------------------------------------------------------------*/
+/// passage en coordonnées cartésiennes
+static void toCartesian(double rho, double theta, double phi, double& x, double& y, double& z)
+{
+	x = rho * std::cos(theta) * std::cos(phi);
+	y = rho * std::cos(theta) * std::sin(phi);
+	z = rho * std::sin(theta);
+}
+/*----------------------------------------------------------------------------*/
+/** récupère les nb valeurs d'un tableau retourné par la fonction Python,
+ *  objet supportant le protocole buffer (memoryview, tableau NumPy, array)
+ *  ou à défaut séquence de flottants
+ */
+static bool getBatchResult(PyObject* obj, Py_ssize_t nb, std::vector<double>& values)
+{
+	if (PyObject_CheckBuffer(obj)){
+		Py_buffer view;
+		if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0){
+			const char* format = (view.format ? view.format : "B");
+			if (*format == '@' || *format == '=' || *format == '<')
+				format++;
+			bool ok = (std::strcmp(format, "d") == 0
+					&& view.itemsize == sizeof(double)
+					&& view.len == nb*(Py_ssize_t)sizeof(double));
+			if (ok && view.buf != &values[0])
+				std::memcpy(&values[0], view.buf, view.len);
+			PyBuffer_Release(&view);
+			if (ok)
+				return true;
+		}
+		else
+			PyErr_Clear();
+	}
+
+	PyObject* seq = PySequence_Fast(obj, "");
+	if (!seq){
+		PyErr_Clear();
+		return false;
+	}
+	bool ok = (PySequence_Fast_GET_SIZE(seq) == nb);
+	for (Py_ssize_t i=0; ok && i<nb; i++)
+		values[i] = PyFloat_AsDouble(PySequence_Fast_GET_ITEM(seq, i));
+	if (PyErr_Occurred()){
+		PyErr_Clear();
+		ok = false;
+	}
+	Py_DECREF(seq);
+	return ok;
+}
+/*----------------------------------------------------------------------------*/
+/** crée le tableau Python (nouvelle référence) contenant une copie des valeurs,
+ *  memoryview de doubles sur un bytearray en Python 3, liste de flottants en
+ *  Python 2 (pas de memoryview.cast)
+ */
+static PyObject* newBatchArray(const std::vector<double>& values)
+{
+	const Py_ssize_t nb = values.size();
+#if PY_MAJOR_VERSION >= 3
+	PyObject* bytes = PyByteArray_FromStringAndSize((const char*)&values[0], nb*sizeof(double));
+	if (!bytes)
+		return NULL;
+	PyObject* mv = PyMemoryView_FromObject(bytes);
+	Py_DECREF(bytes);
+	if (!mv)
+		return NULL;
+	PyObject* array = PyObject_CallMethod(mv, (char*)"cast", (char*)"s", "d");
+	Py_DECREF(mv);
+	return array;
+#else
+	PyObject* array = PyList_New(nb);
+	if (!array)
+		return NULL;
+	for (Py_ssize_t i=0; i<nb; i++)
+		PyList_SET_ITEM(array, i, PyFloat_FromDouble(values[i]));
+	return array;
+#endif
 }
 /*----------------------------------------------------------------------------*/
 void MeshModificationByPythonFunction::
 applyModification(std::vector<gmds::Node >& gmdsNodes,
-		std::map<gmds::TCellID, uint>& filtre_nodes,
+		const NodeFilter& filtre_nodes,
 		uint maskFixed)
 {
 #ifdef _DEBUG2
 	std::cout<<"MeshModificationByPythonFunction::applyModification pour "<<gmdsNodes.size()<<" noeuds, maskFixed = "<<maskFixed<<std::endl;
-	uint nodeCount = 0;
 #endif
 
+	// on passe les noeuds marqués
+	std::vector<gmds::Node > nodes;
+	nodes.reserve(gmdsNodes.size());
 	for (std::vector<gmds::Node >::iterator iter = gmdsNodes.begin();
 			iter != gmdsNodes.end(); ++iter){
-		gmds::Node nd = *iter;
-
-		// on passe les noeuds marqués
-#ifdef _DEBUG2
-		std::cout<<"Node "<<nd.getID()<<" filtre : "<<filtre_nodes[nd.getID()]<<std::endl;
-#endif
-		if (filtre_nodes[nd.getID()] == maskFixed)
-			continue;
+		if (filtre_nodes.get((*iter).getID()) != maskFixed)
+			nodes.push_back(*iter);
+	}
 #ifdef _DEBUG2
-	nodeCount += 1;
+	std::cout<<"nodeCount = "<<nodes.size()<<std::endl;
 #endif
 
-		double rho,theta,phi;
-
-		PyObject* T = PyTuple_New(3);
-		PyObject* py_coord1;
-		PyObject* py_coord2;
-		PyObject* py_coord3;
-
-		if (m_typeCoord == polar){
-			rho = std::sqrt(nd.X()*nd.X()+nd.Y()*nd.Y()+nd.Z()*nd.Z());
-			if (Utils::Math::MgxNumeric::isNearlyZero(rho))
-				theta = 0;
-			else
-				theta = std::asin(nd.Z()/rho);
-			phi = std::atan2(nd.Y(), nd.X());
-
-			py_coord1 = Py_BuildValue("d",rho);
-			py_coord2 = Py_BuildValue("d",theta);
-			py_coord3 = Py_BuildValue("d",phi);
+	if (m_batch)
+		applyByBatch(nodes);
+	else
+		applyByNode(nodes);
+}
+/*----------------------------------------------------------------------------*/
+void MeshModificationByPythonFunction::
+applyByNode(std::vector<gmds::Node >& nodes)
+{
+	for (std::vector<gmds::Node >::iterator iter = nodes.begin();
+			iter != nodes.end(); ++iter){
+		gmds::Node nd = *iter;
 
-		}
+		double coord1, coord2, coord3;
+		if (m_typeCoord == polar)
+			toPolar(nd.X(), nd.Y(), nd.Z(), coord1, coord2, coord3);
 		else {
-			py_coord1 = Py_BuildValue("d",nd.X());
-			py_coord2 = Py_BuildValue("d",nd.Y());
-			py_coord3 = Py_BuildValue("d",nd.Z());
+			coord1 = nd.X();
+			coord2 = nd.Y();
+			coord3 = nd.Z();
 		}
 
-		PyTuple_SetItem(T,0,py_coord1);
-		PyTuple_SetItem(T,1,py_coord2);
-		PyTuple_SetItem(T,2,py_coord3);
+		PyObject* T = PyTuple_New(3);
+		PyTuple_SetItem(T,0,Py_BuildValue("d",coord1));
+		PyTuple_SetItem(T,1,Py_BuildValue("d",coord2));
+		PyTuple_SetItem(T,2,Py_BuildValue("d",coord3));
 
 		PyObject* R = PyObject_Call(m_py_obj, T, NULL);
 
@@ -120,22 +209,12 @@ applyModification(std::vector<gmds::Node >& gmdsNodes,
 
 		if (R){
 			// récupération des 3 coordonnées en retour
-			py_coord1 = PyList_GetItem(R,0);
-			py_coord2 = PyList_GetItem(R,1);
-			py_coord3 = PyList_GetItem(R,2);
-
-			double res1 = PyFloat_AsDouble(py_coord1);
-			double res2 = PyFloat_AsDouble(py_coord2);
-			double res3 = PyFloat_AsDouble(py_coord3);
-
-			if (m_typeCoord == polar){
-				rho   = res1;
-				theta = res2;
-				phi   = res3;
-				res1 = rho * std::cos(theta) * std::cos(phi);
-				res2 = rho * std::cos(theta) * std::sin(phi);
-				res3 = rho * std::sin(theta);
-			}
+			double res1 = PyFloat_AsDouble(PyList_GetItem(R,0));
+			double res2 = PyFloat_AsDouble(PyList_GetItem(R,1));
+			double res3 = PyFloat_AsDouble(PyList_GetItem(R,2));
+
+			if (m_typeCoord == polar)
+				toCartesian(res1, res2, res3, res1, res2, res3);
 
 			nd.setX(res1);
 			nd.setY(res2);
@@ -150,10 +229,85 @@ applyModification(std::vector<gmds::Node >& gmdsNodes,
 		Py_DECREF(R);
 
 	} // end for iter
-#ifdef _DEBUG2
-	std::cout<<"nodeCount = "<<nodeCount<<std::endl;
-#endif
+}
+/*----------------------------------------------------------------------------*/
+void MeshModificationByPythonFunction::
+applyByBatch(std::vector<gmds::Node >& nodes)
+{
+	const Py_ssize_t nb = nodes.size();
+	if (nb == 0)
+		return;
+
+	// les coordonnées, un tableau contigu par composante
+	std::vector<double> coords[3];
+	for (uint d=0; d<3; d++)
+		coords[d].resize(nb);
+	for (Py_ssize_t i=0; i<nb; i++){
+		gmds::Node nd = nodes[i];
+		if (m_typeCoord == polar)
+			toPolar(nd.X(), nd.Y(), nd.Z(), coords[0][i], coords[1][i], coords[2][i]);
+		else {
+			coords[0][i] = nd.X();
+			coords[1][i] = nd.Y();
+			coords[2][i] = nd.Z();
+		}
+	}
+
+	// les tableaux transmis appartiennent à Python, la fonction peut donc en
+	// conserver une référence au delà de l'appel
+	PyObject* T = PyTuple_New(3);
+	for (uint d=0; d<3; d++){
+		PyObject* array = newBatchArray(coords[d]);
+		if (!array){
+			PyErr_Clear();
+			Py_DECREF(T);
+			throw TkUtil::Exception(TkUtil::UTF8String ("Erreur interne lors de la création des tableaux de coordonnées pour la fonction de perturbation en Python.", TkUtil::Charset::UTF_8));
+		}
+		PyTuple_SetItem(T, d, array);
+	}
+
+	PyObject* R = PyObject_Call(m_py_obj, T, NULL);
+
+	bool ok = (R != NULL);
+	if (ok && R != Py_None){
+		PyObject* seq = PySequence_Fast(R, "");
+		ok = (seq && PySequence_Fast_GET_SIZE(seq) == 3);
+		for (uint d=0; ok && d<3; d++)
+			ok = getBatchResult(PySequence_Fast_GET_ITEM(seq, d), nb, coords[d]);
+		if (seq)
+			Py_DECREF(seq);
+		else
+			PyErr_Clear();
+	}
+	else if (ok){
+		// les tableaux reçus ont été modifiés
+		for (uint d=0; ok && d<3; d++)
+			ok = getBatchResult(PyTuple_GET_ITEM(T, d), nb, coords[d]);
+	}
+	else
+		PyErr_Clear();
+	Py_XDECREF(R);
+	Py_DECREF(T);
+
+	if (!ok){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message <<"Erreur lors de l'appel par lots de la fonction de perturbation en Python pour "<<(long)nb
+				<<" noeuds. Elle doit retourner None ou 3 tableaux (ou listes) de "<<(long)nb<<" flottants.";
+		throw TkUtil::Exception(message);
+	}
+
+	for (Py_ssize_t i=0; i<nb; i++){
+		double res1 = coords[0][i];
+		double res2 = coords[1][i];
+		double res3 = coords[2][i];
+		if (m_typeCoord == polar)
+			toCartesian(res1, res2, res3, res1, res2, res3);
 
+		gmds::Node nd = nodes[i];
+		nd.setX(res1);
+		nd.setY(res2);
+		nd.setZ(res3);
+	}
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
@@ -0,0 +1,120 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MeshPatches.cpp
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Mesh/MeshPatches.h"
+#include "Mesh/NodeFilter.h"
+#include "Utils/ParallelExecution.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+MeshPatches::MeshPatches(const CellsCSR& connectivite, const std::vector<bool>& movable,
+		uint nbCellsPerPatch)
+{
+	if (nbCellsPerPatch == 0)
+		nbCellsPerPatch = 1;
+	const size_t nb_cells = connectivite.getNbCells();
+	const size_t nb_nodes = movable.size();
+	const uint nb_patches = (nb_cells + nbCellsPerPatch - 1) / nbCellsPerPatch;
+
+	// patch propriétaire de chacun des noeuds
+	std::vector<int> owner(nb_nodes, -1);
+	for (size_t c=0; c<nb_cells; c++){
+		const int* nds = connectivite.getNodes(c);
+		for (int j=0; j<connectivite.getNbNodes(c); j++)
+			if (owner[nds[j]] == -1)
+				owner[nds[j]] = (int)(c/nbCellsPerPatch);
+	}
+
+	// mailles contenant chacun des noeuds (connectivité inverse)
+	std::vector<int> node_offsets;
+	std::vector<int> node_cells;
+	connectivite.buildNodeToCells(nb_nodes, node_offsets, node_cells);
+
+	// noeuds déplaçables de chacun des patchs
+	std::vector<std::vector<int> > owned(nb_patches);
+	for (size_t n=0; n<nb_nodes; n++)
+		if (owner[n] != -1 && movable[n])
+			owned[owner[n]].push_back((int)n);
+
+	// construction des patchs, avec les patchs dont ils lisent des noeuds déplaçables
+	std::vector<std::vector<uint> > voisins(nb_patches);
+	m_patches.resize(nb_patches);
+	Utils::executeEnParallele(nb_patches, [&](uint p){
+		Patch& patch = m_patches[p];
+		const std::vector<int>& nds_p = owned[p];
+		for (size_t i=0; i<nds_p.size(); i++)
+			for (int k=node_offsets[nds_p[i]]; k<node_offsets[nds_p[i]+1]; k++)
+				patch.cells.push_back(node_cells[k]);
+		std::sort(patch.cells.begin(), patch.cells.end());
+		patch.cells.erase(std::unique(patch.cells.begin(), patch.cells.end()), patch.cells.end());
+
+		for (size_t i=0; i<patch.cells.size(); i++){
+			const int* nds = connectivite.getNodes(patch.cells[i]);
+			patch.nodes.insert(patch.nodes.end(), nds, nds+connectivite.getNbNodes(patch.cells[i]));
+		}
+		std::sort(patch.nodes.begin(), patch.nodes.end());
+		patch.nodes.erase(std::unique(patch.nodes.begin(), patch.nodes.end()), patch.nodes.end());
+
+		patch.movable.resize(patch.nodes.size(), false);
+		for (size_t i=0; i<patch.nodes.size(); i++){
+			int n = patch.nodes[i];
+			if (owner[n] == -1 || !movable[n])
+				continue;
+			if (owner[n] == (int)p)
+				patch.movable[i] = true;
+			else
+				voisins[p].push_back(owner[n]);
+		}
+		std::sort(voisins[p].begin(), voisins[p].end());
+		voisins[p].erase(std::unique(voisins[p].begin(), voisins[p].end()), voisins[p].end());
+
+		// connectivité en indices dans patch.nodes
+		for (size_t i=0; i<patch.cells.size(); i++){
+			const int* nds = connectivite.getNodes(patch.cells[i]);
+			int nb = connectivite.getNbNodes(patch.cells[i]);
+			patch.nbNodesCell.push_back(nb);
+			for (int j=0; j<nb; j++)
+				patch.cellNodes.push_back(
+						std::lower_bound(patch.nodes.begin(), patch.nodes.end(), nds[j]) - patch.nodes.begin());
+		}
+	});
+
+	// deux patchs sont en conflit si l'un lit des noeuds que l'autre déplace
+	std::vector<std::vector<uint> > conflits(nb_patches);
+	for (uint p=0; p<nb_patches; p++)
+		for (size_t i=0; i<voisins[p].size(); i++){
+			conflits[p].push_back(voisins[p][i]);
+			conflits[voisins[p][i]].push_back(p);
+		}
+
+	// coloration gloutonne, dans l'ordre des patchs
+	std::vector<int> couleur(nb_patches, -1);
+	for (uint p=0; p<nb_patches; p++){
+		if (owned[p].empty())
+			continue;
+		std::vector<bool> utilisee(m_colors.size()+1, false);
+		for (size_t i=0; i<conflits[p].size(); i++)
+			if (couleur[conflits[p][i]] != -1)
+				utilisee[couleur[conflits[p][i]]] = true;
+		uint c = 0;
+		while (utilisee[c])
+			c++;
+		couleur[p] = c;
+		if (c == m_colors.size())
+			m_colors.push_back(std::vector<uint>());
+		m_colors[c].push_back(p);
+	}
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
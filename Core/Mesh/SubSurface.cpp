@@ -95,6 +95,11 @@ void SubSurface::getGMDSFaces(std::vector<gmds::Face >& faces) const
 	faces = m_poly;
 }
 /*----------------------------------------------------------------------------*/
+void SubSurface::getGMDSFacesView(MeshGroupView<gmds::Face>& view) const
+{
+	view.add(m_poly);
+}
+/*----------------------------------------------------------------------------*/
 void SubSurface::getGMDSNodes(std::vector<gmds::Node >& nodes) const
 {
 	nodes.clear();
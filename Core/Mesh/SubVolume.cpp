@@ -271,6 +271,11 @@ void SubVolume::getGMDSRegions(std::vector<gmds::Region>& ARegions) const
 	ARegions = m_poly;
 }
 /*----------------------------------------------------------------------------*/
+void SubVolume::getGMDSRegionsView(MeshGroupView<gmds::Region>& view) const
+{
+	view.add(m_poly);
+}
+/*----------------------------------------------------------------------------*/
 void SubVolume::addRegion(gmds::Region& reg)
 {
 	m_poly.push_back(reg);
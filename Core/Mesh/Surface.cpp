@@ -11,6 +11,8 @@
 #include "Mesh/Surface.h"
 #include "Mesh/MeshDisplayRepresentation.h"
 #include "Mesh/MeshImplementation.h"
+#include "Mesh/NodeFilter.h"
+#include "Mesh/MeshLevelOfDetail.h"
 #include "Mesh/CommandCreateMesh.h"
 #include "Utils/Common.h"
 #include "Utils/Bounds.h"
@@ -214,8 +216,16 @@ void Surface::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDest
 			mdr->setCells (cells, false);
 		}	// if (1 == mdr->getDecimationStep ( ))
 		else	// On décime
-		{
-    MGX_NOT_YET_IMPLEMENTED("Surface::getRepresentation : décimation non implémentée");
+		{	// représentation dégradée, conservée par la surface
+			std::shared_ptr<const MeshLevelOfDetail>	lod	=
+					getLevelOfDetail (mdr->getDecimationStep ( ));
+			mdr->getPoints ( )	= lod->getPoints ( );
+			std::map<int,int> id2node;
+			const std::vector<gmds::TCellID>&	ids	= lod->getNodeIds ( );
+			for (size_t i = 0; i < ids.size ( ); i++)
+				id2node [i]	= ids [i];
+			mdr->setPoints2nodesID(id2node);
+			mdr->setCells (new std::vector<size_t> (lod->getPolygones ( )), false);
 		}	// else if (1 == mdr->getDecimationStep ( ))
 	}	// if (true == solid)
 	else
@@ -275,13 +285,46 @@ void Surface::getGMDSFaces(std::vector<gmds::Face >& AFaces) const
     }
 }
 /*----------------------------------------------------------------------------*/
+void Surface::getGMDSFacesView(MeshGroupView<gmds::Face>& view) const
+{
+    std::vector<Topo::CoFace* > coFaces;
+    getCoFaces(coFaces);
+
+    for(unsigned int iCoFace=0; iCoFace<coFaces.size(); iCoFace++)
+        view.add(coFaces[iCoFace]->faces());
+}
+/*----------------------------------------------------------------------------*/
+std::shared_ptr<const MeshLevelOfDetail> Surface::getLevelOfDetail(uint ratio) const
+{
+	// construite sous verrou pour ne pas conserver une représentation
+	// invalidée (meshModified) pendant sa construction
+	TkUtil::AutoMutex autoMutex (&m_lodMutex);
+
+	if (m_lod && m_lod->getRatio() != ratio){
+		m_lod.reset();
+	}
+
+	if (!m_lod){
+		Mesh::MeshItf*              meshItf  = getMeshManager ( ).getMesh ( );
+		Mesh::MeshImplementation*   meshImpl = dynamic_cast<Mesh::MeshImplementation*> (meshItf);
+		CHECK_NULL_PTR_ERROR(meshImpl);
+		gmds::IGMesh&  gmdsMesh = meshImpl->getGMDSMesh();
+
+		std::vector<Topo::CoFace* > coFaces;
+		getCoFaces(coFaces);
+
+		std::unique_ptr<MeshLevelOfDetail> lod (new MeshLevelOfDetail(ratio, false));
+		lod->addCoFaces(coFaces, gmdsMesh);
+		m_lod.reset(lod.release());
+	}
+
+	return m_lod;
+}
+/*----------------------------------------------------------------------------*/
 void Surface::getGMDSNodes(std::vector<gmds::Node>& ANodes) const
 {
 	ANodes.clear();
 
-	// utilisation d'un filtre pour ne pas référencer plusieurs fois un même noeud
-	std::map<gmds::TCellID, uint> filtre_nodes;
-
     std::vector<Topo::CoFace* > coFaces;
     getCoFaces(coFaces);
 
@@ -290,15 +333,18 @@ void Surface::getGMDSNodes(std::vector<gmds::Node>& ANodes) const
     CHECK_NULL_PTR_ERROR(meshImpl);
     gmds::IGMesh&  gmdsMesh = meshImpl->getGMDSMesh();
 
+	// utilisation d'un filtre pour ne pas référencer plusieurs fois un même noeud
+	size_t nb_nodes = 0;
+    for(unsigned int iCoFace=0; iCoFace<coFaces.size(); iCoFace++)
+    	nb_nodes += coFaces[iCoFace]->nodes().size();
+	NodeSet filtre_nodes(gmdsMesh.getMaxLocalID(0)+1, nb_nodes);
+
     for(unsigned int iCoFace=0; iCoFace<coFaces.size(); iCoFace++) {
-    	std::vector<gmds::TCellID> nodes  = coFaces[iCoFace]->nodes();
+    	const std::vector<gmds::TCellID>& nodes  = coFaces[iCoFace]->nodes();
 
-    	for(unsigned int iNode=0; iNode<nodes.size(); iNode++) {
-    		if (filtre_nodes[nodes[iNode]] == 0){
+    	for(unsigned int iNode=0; iNode<nodes.size(); iNode++)
+    		if (filtre_nodes.insert(nodes[iNode]))
     			ANodes.push_back(gmdsMesh.get<gmds::Node>(nodes[iNode]));
-    			filtre_nodes[nodes[iNode]] = 1;
-    		}
-    	}
     }
 }
 /*----------------------------------------------------------------------------*/
@@ -350,7 +396,7 @@ saveMeshSurfaceTopoProperty(Internal::InfoCommand* icmd)
         if (!new_entity && m_save_topo_property == 0)
             m_save_topo_property = m_topo_property->clone();
     }
-    m_bounds_to_be_calculate = true;
+    meshModified();
 }
 /*----------------------------------------------------------------------------*/
 Topo::MeshSurfaceTopoProperty* Surface::
@@ -358,7 +404,7 @@ setProperty(Topo::MeshSurfaceTopoProperty* prop)
 {
     Topo::MeshSurfaceTopoProperty* tmp = m_topo_property;
     m_topo_property = prop;
-    m_bounds_to_be_calculate = true;
+    meshModified();
     return tmp;
 }
 /*----------------------------------------------------------------------------*/
@@ -369,7 +415,7 @@ saveInternals(Mesh::CommandCreateMesh* ccm)
         ccm->addSurfaceInfoTopoProperty(this, m_save_topo_property);
         m_save_topo_property = 0;
     }
-    m_bounds_to_be_calculate = true;
+    meshModified();
 }
 /*----------------------------------------------------------------------------*/
 bool Surface::
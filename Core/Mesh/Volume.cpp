@@ -11,12 +11,15 @@
 #include "Mesh/Volume.h"
 #include "Mesh/MeshDisplayRepresentation.h"
 #include "Mesh/MeshImplementation.h"
+#include "Mesh/NodeFilter.h"
+#include "Mesh/MeshLevelOfDetail.h"
 #include "Mesh/CommandCreateMesh.h"
 #include "Utils/Common.h"
 #include "Utils/Bounds.h"
 #include "Topo/CoFace.h"
 #include "Topo/Face.h"
 #include "Topo/Block.h"
+#include "Topo/TopoHelper.h"
 #include "Utils/SerializedRepresentation.h"
 #include "Internal/InfoCommand.h"
 #include "Group/Group3D.h"
@@ -26,6 +29,7 @@
 #include <TkUtil/InternalError.h>
 #include <TkUtil/MemoryError.h>
 #include <memory>           // unique_ptr
+#include <unordered_map>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -334,8 +338,55 @@ void Volume::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDestr
 	        }	// else if (false == skin)
 	    }	// if (1 == mdr->getDecimationStep ( ))
 	    else
-	    {
-	        throw TkUtil::Exception (TkUtil::UTF8String ("Volume::getRepresentation : cas avec décimation non pris en charge.", TkUtil::Charset::UTF_8));
+	    {	// représentation dégradée, conservée par le volume
+	        std::shared_ptr<const MeshLevelOfDetail>	lod	=
+	                getLevelOfDetail (mdr->getDecimationStep ( ), skin);
+	        std::vector<Utils::Math::Point>& points	= mdr->getPoints ( );
+	        points	= lod->getPoints ( );
+	        std::vector<size_t>*	cells	= new std::vector<size_t> (
+	                true == skin ? lod->getPolygones ( ) : lod->getPolyedres ( ));
+
+	        // la liste des mailles ne mélange pas polygones et polyèdres : en
+	        // vue pleine les blocs qui ne sont pas des réseaux structurés
+	        // (représentés par leur peau dans lod) sont pris entièrement
+	        if ((false == skin) && (0 != lod->getNbPolygones ( )))
+	        {
+	            gmds::IGMesh&	gmdsMesh	= meshImpl->getGMDSMesh ( );
+	            std::unordered_map<gmds::TCellID, size_t>	node2id;
+	            const std::vector<gmds::TCellID>&	ids	= lod->getNodeIds ( );
+	            for (size_t i = 0; i < ids.size ( ); i++)
+	                node2id [ids [i]]	= i;
+
+	            std::vector<Topo::Block* >	blocs;
+	            getBlocks (blocs);
+	            std::vector<gmds::TCellID>	nds;
+	            for (size_t i = 0; i < blocs.size ( ); i++)
+	            {
+	                if ((false == blocs [i]->isMeshed ( )) ||
+	                    (true == blocs [i]->isStructured ( ) && 8 == blocs [i]->getNbVertices ( )))
+	                    continue;
+	                std::vector<gmds::TCellID>&	l_poly	= blocs [i]->regions ( );
+	                for (size_t j = 0; j < l_poly.size ( ); j++)
+	                {
+	                    nds.clear ( );
+	                    gmdsMesh.get<gmds::Region> (l_poly [j]).getAllIDs<gmds::Node> (nds);
+	                    cells->push_back (nds.size ( ));
+	                    for (size_t k = 0; k < nds.size ( ); k++)
+	                    {
+	                        std::unordered_map<gmds::TCellID, size_t>::iterator
+	                                it	= node2id.find (nds [k]);
+	                        if (node2id.end ( ) == it)
+	                        {
+	                            gmds::Node	nd	= gmdsMesh.get<gmds::Node> (nds [k]);
+	                            it	= node2id.insert (std::make_pair (nds [k], points.size ( ))).first;
+	                            points.push_back (Utils::Math::Point (nd.X ( ), nd.Y ( ), nd.Z ( )));
+	                        }
+	                        cells->push_back (it->second);
+	                    }
+	                }	// for (size_t j = 0; j < l_poly.size ( ); j++)
+	            }	// for (size_t i = 0; i < blocs.size ( ); i++)
+	        }	// if ((false == skin) && (0 != lod->getNbPolygones ( )))
+	        mdr->setCells (cells, skin);
 	    }	// else if (1 == mdr->getDecimationStep ( ))
 	}	// if (true == solid)
 }
@@ -390,13 +441,19 @@ void Volume::getGMDSRegions(std::vector<gmds::Region >& ARegions) const
     }
 }
 /*----------------------------------------------------------------------------*/
+void Volume::getGMDSRegionsView(MeshGroupView<gmds::Region>& view) const
+{
+    std::vector<Topo::Block* > blocks;
+    getBlocks(blocks);
+
+    for(unsigned int iBlock=0; iBlock<blocks.size(); iBlock++)
+        view.add(blocks[iBlock]->regions());
+}
+/*----------------------------------------------------------------------------*/
 void Volume::getGMDSNodes(std::vector<gmds::Node>& ANodes) const
 {
 	ANodes.clear();
 
-	// utilisation d'un filtre pour ne pas référencer plusieurs fois un même noeud
-	std::map<gmds::TCellID, uint> filtre_nodes;
-
     std::vector<Topo::Block* > blocks;
     getBlocks(blocks);
 
@@ -405,18 +462,51 @@ void Volume::getGMDSNodes(std::vector<gmds::Node>& ANodes) const
     CHECK_NULL_PTR_ERROR(meshImpl);
     gmds::IGMesh&  gmdsMesh = meshImpl->getGMDSMesh();
 
+	// utilisation d'un filtre pour ne pas référencer plusieurs fois un même noeud
+	size_t nb_nodes = 0;
+    for(unsigned int iBlock=0; iBlock<blocks.size(); iBlock++)
+    	nb_nodes += blocks[iBlock]->nodes().size();
+	NodeSet filtre_nodes(gmdsMesh.getMaxLocalID(0)+1, nb_nodes);
+
     for(unsigned int iBlock=0; iBlock<blocks.size(); iBlock++) {
-    	std::vector<gmds::TCellID> nodes  = blocks[iBlock]->nodes();
+    	const std::vector<gmds::TCellID>& nodes  = blocks[iBlock]->nodes();
 
-    	for(unsigned int iNode=0; iNode<nodes.size(); iNode++) {
-    		if (filtre_nodes[nodes[iNode]] == 0){
+    	for(unsigned int iNode=0; iNode<nodes.size(); iNode++)
+    		if (filtre_nodes.insert(nodes[iNode]))
     			ANodes.push_back(gmdsMesh.get<gmds::Node>(nodes[iNode]));
-    			filtre_nodes[nodes[iNode]] = 1;
-    		}
-    	}
     }
 }
 /*----------------------------------------------------------------------------*/
+std::shared_ptr<const MeshLevelOfDetail> Volume::getLevelOfDetail(uint ratio, bool skin) const
+{
+	// construite sous verrou pour ne pas conserver une représentation
+	// invalidée (meshModified) pendant sa construction
+	TkUtil::AutoMutex autoMutex (&m_lodMutex);
+
+	if (m_lod && (m_lod->getRatio() != ratio || m_lod->isSkin() != skin)){
+		m_lod.reset();
+	}
+
+	if (!m_lod){
+		Mesh::MeshItf*              meshItf  = getMeshManager ( ).getMesh ( );
+		Mesh::MeshImplementation*   meshImpl = dynamic_cast<Mesh::MeshImplementation*> (meshItf);
+		CHECK_NULL_PTR_ERROR(meshImpl);
+		gmds::IGMesh&  gmdsMesh = meshImpl->getGMDSMesh();
+
+		std::vector<Topo::Block* > blocks;
+		getBlocks(blocks);
+
+		std::unique_ptr<MeshLevelOfDetail> lod (new MeshLevelOfDetail(ratio, skin));
+		if (skin)
+			lod->addCoFaces(Topo::TopoHelper::getBorder(blocks), gmdsMesh);
+		else
+			lod->addBlocks(blocks, gmdsMesh);
+		m_lod.reset(lod.release());
+	}
+
+	return m_lod;
+}
+/*----------------------------------------------------------------------------*/
 Utils::SerializedRepresentation* Volume::
 getDescription (bool alsoComputed) const
 {
@@ -484,7 +574,7 @@ saveMeshVolumeTopoProperty(Internal::InfoCommand* icmd)
             m_save_topo_property = m_topo_property->clone();
         }
     }
-    m_bounds_to_be_calculate = true;
+    meshModified();
 }
 /*----------------------------------------------------------------------------*/
 Topo::MeshVolumeTopoProperty* Volume::
@@ -495,7 +585,7 @@ setProperty(Topo::MeshVolumeTopoProperty* prop)
 //            <<" à "<<prop->getBlockContainer().size()<<" blocs"<<std::endl;
     Topo::MeshVolumeTopoProperty* tmp = m_topo_property;
     m_topo_property = prop;
-    m_bounds_to_be_calculate = true;
+    meshModified();
     return tmp;
 }
 /*----------------------------------------------------------------------------*/
@@ -509,7 +599,7 @@ saveInternals(Mesh::CommandCreateMesh* ccm)
 //                <<m_save_topo_property->getBlockContainer().size()<<" blocs"<<std::endl;
         m_save_topo_property = 0;
     }
-    m_bounds_to_be_calculate = true;
+    meshModified();
 }
 /*----------------------------------------------------------------------------*/
 bool Volume::
@@ -8,6 +8,7 @@
  */
 /*----------------------------------------------------------------------------*/
 #include "Smoothing/MesquiteMeshAdapter.h"
+#include "Mesh/NodeFilter.h"
 /*----------------------------------------------------------------------------*/
 #include "GMDS/IG/Node.h"
 #include "GMDS/IG/Face.h"
@@ -27,9 +28,8 @@ namespace Mesh {
 MesquiteMeshAdapter::
 MesquiteMeshAdapter(std::vector<gmds::Face>& gmdsPolygones,
 			std::vector<gmds::Node >& gmdsNodes,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
-			std::map<gmds::TCellID, bool>& isPolyInverted,
-			uint maskFixed)
+			const std::vector<bool>& isNodeFixed,
+			const std::vector<bool>& isPolyInverted)
 : m_gmdsNodes(gmdsNodes)
 {
 #ifdef _DEBUG2
@@ -47,55 +47,48 @@ MesquiteMeshAdapter(std::vector<gmds::Face>& gmdsPolygones,
 	myMesh->allocate_vertices (vertexCount, err);
 	MSQ_CHKERR (err);
 
-	// table de correspondance entre noeuds Gmds et indices pour Mesquite
-	std::map<gmds::TCellID, uint> num_insurf;
-
 	for (uint i=0; i<vertexCount; i++){
 		gmds::Node nd = m_gmdsNodes[i];
 #ifdef _DEBUG2
-		std::cout << " i "<<i<<", "<<nd<<" fixé ? "<<(filtre_nodes[nd.getID()] == maskFixed?"vrai":"faux")<<std::endl;
+		std::cout << " i "<<i<<", "<<nd<<" fixé ? "<<(isNodeFixed[i]?"vrai":"faux")<<std::endl;
 #endif
-		num_insurf[nd.getID()] = i;
 		myMesh->reset_vertex (i,
 				Mesquite::Vector3D (nd.X(), nd.Y(), nd.Z()),
-				filtre_nodes[nd.getID()] == maskFixed,
+				isNodeFixed[i],
 				err);
 	}
 
+	// table de correspondance entre noeuds Gmds et indices pour Mesquite
+	NodeIndex num_insurf(gmdsNodes);
+	CellsCSR connectivite;
+	connectivite.build(gmdsPolygones, num_insurf);
 
 	myMesh->allocate_elements (gmdsPolygones.size(), err);
 	int elementCount = 0;
 	std::vector < size_t > vertices;
 	Mesquite::EntityTopology elem_type;
 	for (size_t i_poly = 0; i_poly < gmdsPolygones.size(); ++i_poly){
-		gmds::Face cell = gmdsPolygones[i_poly];
-		std::vector<gmds::TCellID> l_nds = cell.getAllIDs<gmds::Node>();
-		switch (l_nds.size()) {
+		int nb_nds = connectivite.getNbNodes(i_poly);
+		const int* l_nds = connectivite.getNodes(i_poly);
+		switch (nb_nds) {
 		case 4:
 			elem_type = MESQUITE_NS::QUADRILATERAL;
-			vertices.resize (4);
-			if (isPolyInverted[cell.getID()])
-				for (size_t j = 0; j < 4; j++)
-					vertices[j] = num_insurf[l_nds[3-j]];
-			else
-				for (size_t j = 0; j < 4; j++)
-					vertices[j] = num_insurf[l_nds[j]];
 			break;
 		case 3:
 			elem_type = MESQUITE_NS::TRIANGLE;
-			vertices.resize (3);
-			if (isPolyInverted[cell.getID()])
-				for (size_t j = 0; j < 3; j++)
-					vertices[j] = num_insurf[l_nds[2-j]];
-			else
-				for (size_t j = 0; j < 3; j++)
-					vertices[j] = num_insurf[l_nds[j]];
 			break;
 		default:
 			// Ben là je ne sais pas faire ! Un polygone quoi
 			throw TkUtil::Exception (TkUtil::UTF8String ("MesquiteMeshAdapter avec type d'élément non prévu", TkUtil::Charset::UTF_8));
 			break;
 		}
+		vertices.resize (nb_nds);
+		if (isPolyInverted[i_poly])
+			for (int j = 0; j < nb_nds; j++)
+				vertices[j] = l_nds[nb_nds-1-j];
+		else
+			for (int j = 0; j < nb_nds; j++)
+				vertices[j] = l_nds[j];
 #ifdef _DEBUG2
 		std::cout << " reset_element ("<<elementCount;
 		for (uint i=0; i<vertices.size(); i++)
@@ -123,9 +116,13 @@ MesquiteMeshAdapter::~MesquiteMeshAdapter()
     	gmds::Node nd = m_gmdsNodes[i];
 
 	    MESQUITE_NS::Vector3D coord = myMesh->get_vertex_coords(i, err);
-	    nd.setX(coord[0]);
-	    nd.setY(coord[1]);
-	    nd.setZ(coord[2]);
+	    // les noeuds non déplacés ne sont pas réécrits, ils peuvent être
+	    // lus en même temps par un autre lissage
+	    if (coord[0] != nd.X() || coord[1] != nd.Y() || coord[2] != nd.Z()){
+	    	nd.setX(coord[0]);
+	    	nd.setY(coord[1]);
+	    	nd.setZ(coord[2]);
+	    }
 #ifdef _DEBUG2
 	    std::cout << " i "<<i<<", "<<nd<<std::endl;
 #endif
@@ -41,7 +41,8 @@ MesquiteMeshImplAdapter(
 	MSQ_CHKERR (err);
 
 	// table de correspondance entre noeuds Gmds et indices pour Mesquite
-	std::map<gmds::TCellID, uint> num_insurf;
+	// (tableau indicé par les id gmds)
+	std::vector<uint> num_insurf(gmdsMesh.getMaxLocalID(0)+1, 0);
 
 	gmds::IGMesh::node_iterator itn  = gmdsMesh.nodes_begin();
 
@@ -0,0 +1,167 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file NativeSmoothing.cpp
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Smoothing/NativeSmoothing.h"
+#include "Utils/ParallelExecution.h"
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <functional>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/// nombre de mailles (ou de noeuds) traités par une même tâche
+static const size_t NB_ENTITES_TACHE_LISSAGE = 4096;
+/*----------------------------------------------------------------------------*/
+/// exécute tache sur [0, nb[, par tranches en parallèle si demandé
+static void executeParTranches(size_t nb, bool parallel,
+		const std::function<void(size_t, size_t)>& tache)
+{
+	if (parallel)
+		Utils::executeParTranches(nb, NB_ENTITES_TACHE_LISSAGE, tache);
+	else if (nb)
+		tache(0, nb);
+}
+/*----------------------------------------------------------------------------*/
+int NativeSmoothing::laplace(int nb_cells, int nb_vtx,
+		const int* nb_node_cell, const int* nodes_number,
+		double* x, double* y, double* z,
+		const double* relax, int nbIterations, bool parallel)
+{
+	return smooth(false, nb_cells, nb_vtx, nb_node_cell, nodes_number,
+			x, y, z, relax, nbIterations, parallel);
+}
+/*----------------------------------------------------------------------------*/
+int NativeSmoothing::tipton(int nb_cells, int nb_vtx,
+		const int* nb_node_cell, const int* nodes_number,
+		double* x, double* y, double* z,
+		const double* relax, int nbIterations, bool parallel)
+{
+	return smooth(true, nb_cells, nb_vtx, nb_node_cell, nodes_number,
+			x, y, z, relax, nbIterations, parallel);
+}
+/*----------------------------------------------------------------------------*/
+int NativeSmoothing::smooth(bool weighted, int nb_cells, int nb_vtx,
+		const int* nb_node_cell, const int* nodes_number,
+		double* x, double* y, double* z,
+		const double* relax, int nbIterations, bool parallel)
+{
+	if (nb_cells <= 0 || nb_vtx <= 0)
+		return 0;
+
+	// début de chaque maille dans nodes_number
+	std::vector<int> cell_offsets(nb_cells+1);
+	cell_offsets[0] = 0;
+	for (int c=0; c<nb_cells; c++){
+		if (nb_node_cell[c] <= 0)
+			return 1;
+		cell_offsets[c+1] = cell_offsets[c] + nb_node_cell[c];
+	}
+	for (int i=0; i<cell_offsets[nb_cells]; i++)
+		if (nodes_number[i] < 0 || nodes_number[i] >= nb_vtx)
+			return 2;
+
+	// connectivité inverse noeuds -> mailles
+	std::vector<int> node_offsets(nb_vtx+1, 0);
+	for (int i=0; i<cell_offsets[nb_cells]; i++)
+		node_offsets[nodes_number[i]+1]++;
+	for (int i=0; i<nb_vtx; i++)
+		node_offsets[i+1] += node_offsets[i];
+	std::vector<int> node_cells(node_offsets[nb_vtx]);
+	{
+		std::vector<int> pos(node_offsets.begin(), node_offsets.end()-1);
+		for (int c=0; c<nb_cells; c++)
+			for (int j=cell_offsets[c]; j<cell_offsets[c+1]; j++)
+				node_cells[pos[nodes_number[j]]++] = c;
+	}
+
+	// centres et poids des mailles, cibles des noeuds
+	std::vector<double> cx(nb_cells), cy(nb_cells), cz(nb_cells), poids(nb_cells, 1.0);
+	std::vector<double> nx(nb_vtx), ny(nb_vtx), nz(nb_vtx);
+
+	for (int iter=0; iter<nbIterations; iter++){
+
+		executeParTranches(nb_cells, parallel, [&](size_t debut, size_t fin){
+			for (size_t c=debut; c<fin; c++){
+				const int* nds = nodes_number + cell_offsets[c];
+				const int nb = cell_offsets[c+1] - cell_offsets[c];
+				double sx = 0.0, sy = 0.0, sz = 0.0;
+				for (int j=0; j<nb; j++){
+					sx += x[nds[j]];
+					sy += y[nds[j]];
+					sz += z[nds[j]];
+				}
+				sx /= nb;
+				sy /= nb;
+				sz /= nb;
+				cx[c] = sx;
+				cy[c] = sy;
+				cz[c] = sz;
+
+				if (weighted){
+					double m2 = 0.0;
+					for (int j=0; j<nb; j++){
+						double dx = x[nds[j]] - sx;
+						double dy = y[nds[j]] - sy;
+						double dz = z[nds[j]] - sz;
+						m2 += dx*dx + dy*dy + dz*dz;
+					}
+					poids[c] = m2 / nb;
+				}
+			}
+		});
+
+		executeParTranches(nb_vtx, parallel, [&](size_t debut, size_t fin){
+			for (size_t i=debut; i<fin; i++){
+				double sx = 0.0, sy = 0.0, sz = 0.0, sw = 0.0;
+				if (relax[i] != 0.0)
+					for (int k=node_offsets[i]; k<node_offsets[i+1]; k++){
+						const int c = node_cells[k];
+						sx += poids[c]*cx[c];
+						sy += poids[c]*cy[c];
+						sz += poids[c]*cz[c];
+						sw += poids[c];
+					}
+				// un noeud isolé, figé ou entouré de mailles dégénérées ne bouge pas
+				if (sw > 0.0){
+					nx[i] = sx / sw;
+					ny[i] = sy / sw;
+					nz[i] = sz / sw;
+				}
+				else {
+					nx[i] = x[i];
+					ny[i] = y[i];
+					nz[i] = z[i];
+				}
+			}
+		});
+
+		// déplacement vers la cible, boucle sur des tableaux contigus (vectorisable)
+		executeParTranches(nb_vtx, parallel, [&](size_t debut, size_t fin){
+			double* __restrict px = x;
+			double* __restrict py = y;
+			double* __restrict pz = z;
+			const double* __restrict pr = relax;
+			const double* __restrict qx = &nx[0];
+			const double* __restrict qy = &ny[0];
+			const double* __restrict qz = &nz[0];
+			for (size_t i=debut; i<fin; i++){
+				px[i] += pr[i]*(qx[i] - px[i]);
+				py[i] += pr[i]*(qy[i] - py[i]);
+				pz[i] += pr[i]*(qz[i] - pz[i]);
+			}
+		});
+	} // end for iter
+
+	return 0;
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -10,6 +10,8 @@
 #include "Smoothing/SurfacicSmoothing.h"
 #include "Smoothing/MesquiteDomainAdapter.h"
 #include "Smoothing/MesquiteMeshAdapter.h"
+#include "Mesh/NodeFilter.h"
+#include "Mesh/MeshPatches.h"
 #include "Smoothing/OrthogonalQualityMetric.h"
 #include "Smoothing/NormaleQualityMetric.h"
 #include "Smoothing/OrthogonalSmoothing.h"
@@ -18,6 +20,7 @@
 #include "Mesh/MeshManager.h"
 #include "Utils/SerializedRepresentation.h"
 #include "Utils/Common.h"
+#include "Utils/ParallelExecution.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
 #include <TkUtil/UTF8String.h>
@@ -47,16 +50,18 @@ SurfacicSmoothing()
 , m_nbIterations(10)
 , m_methodeLissage(surfacicOrthogonalSmoothingElliptic)
 , m_solver(gradientConjugue)
+, m_patchSize(0)
 {
 }
 /*----------------------------------------------------------------------------*/
 SurfacicSmoothing::
-SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solver)
+SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solver, int patchSize)
  : MeshModificationItf()
 , m_useDefaults(false)
 , m_nbIterations(nbIterations)
 , m_methodeLissage(methodeLissage)
 , m_solver(solver)
+, m_patchSize(patchSize)
 {
 }
 /*----------------------------------------------------------------------------*/
@@ -71,6 +76,7 @@ SurfacicSmoothing::SurfacicSmoothing(const SurfacicSmoothing& lissage)
 , m_nbIterations(lissage.m_nbIterations)
 , m_methodeLissage(lissage.m_methodeLissage)
 , m_solver(lissage.m_solver)
+, m_patchSize(lissage.m_patchSize)
 {
 
 }
@@ -93,6 +99,12 @@ void SurfacicSmoothing::setSolver(eSolver solver)
 	m_solver = solver;
 }
 /*----------------------------------------------------------------------------*/
+void SurfacicSmoothing::setPatchSize(int patchSize)
+{
+	m_useDefaults = false;
+	m_patchSize = patchSize;
+}
+/*----------------------------------------------------------------------------*/
 SurfacicSmoothing& SurfacicSmoothing::operator = (const SurfacicSmoothing&)
 {
 	MGX_FORBIDDEN("SurfacicSmoothing::operator = is not allowed.");
@@ -123,15 +135,101 @@ addToDescription (Mgx3D::Utils::SerializedRepresentation* description) const
 	description->addProperty (
 			Utils::SerializedRepresentation::Property (
 					"Solver", toString(getSolver())));
+
+	if (getPatchSize())
+		description->addProperty (
+				Utils::SerializedRepresentation::Property (
+						"Nombre de mailles par patch", (long)getPatchSize()));
 }
 /*----------------------------------------------------------------------------*/
 void SurfacicSmoothing::
 applyModification(std::vector<gmds::Node >& gmdsNodes,
 			std::vector<gmds::Face>& gmdsPolygones,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
-			std::map<gmds::TCellID, bool>& isPolyInverted,
+			const NodeFilter& filtre_nodes,
+			const std::vector<bool>& isPolyInverted,
 			uint maskFixed,
-			Geom::Surface* surface)
+			Geom::Surface* surface,
+			bool parallel)
+{
+	// les noeuds figés
+	std::vector<bool> isNodeFixed(gmdsNodes.size());
+	for (uint i=0; i<gmdsNodes.size(); i++)
+		isNodeFixed[i] = (filtre_nodes.get(gmdsNodes[i].getID()) == maskFixed);
+
+	if (m_patchSize > 0 && m_nbIterations > 0 && gmdsPolygones.size() > (size_t)m_patchSize)
+		smoothByPatches(gmdsNodes, gmdsPolygones, isNodeFixed, isPolyInverted, surface, parallel);
+	else
+		smooth(gmdsNodes, gmdsPolygones, isNodeFixed, isPolyInverted, surface, m_nbIterations, true);
+}
+/*----------------------------------------------------------------------------*/
+void SurfacicSmoothing::
+smoothByPatches(std::vector<gmds::Node >& gmdsNodes,
+			std::vector<gmds::Face>& gmdsPolygones,
+			const std::vector<bool>& isNodeFixed,
+			const std::vector<bool>& isPolyInverted,
+			Geom::Surface* surface,
+			bool parallel) const
+{
+	NodeIndex index(gmdsNodes);
+	CellsCSR connectivite;
+	connectivite.build(gmdsPolygones, index);
+
+	std::vector<bool> movable(gmdsNodes.size());
+	for (uint i=0; i<gmdsNodes.size(); i++)
+		movable[i] = !isNodeFixed[i];
+
+	MeshPatches patches(connectivite, movable, m_patchSize);
+	const std::vector<std::vector<uint> >& couleurs = patches.getColors();
+
+#ifdef _DEBUG2
+	std::cout<<"SurfacicSmoothing::smoothByPatches avec "<<patches.getNbPatches()
+			<<" patchs et "<<couleurs.size()<<" couleurs"<<std::endl;
+#endif
+
+	// les patchs d'une même couleur sont indépendants, seuls les noeuds
+	// déplaçables d'un patch sont modifiés lors de son lissage
+	for (int iter=0; iter<m_nbIterations; iter++)
+		for (size_t c=0; c<couleurs.size(); c++){
+			const std::vector<uint>& patchs_c = couleurs[c];
+			auto lisse = [&](uint i){
+				const MeshPatches::Patch& patch = patches.getPatch(patchs_c[i]);
+
+				std::vector<gmds::Node> nodes;
+				std::vector<bool> fixed;
+				nodes.reserve(patch.nodes.size());
+				fixed.reserve(patch.nodes.size());
+				for (size_t j=0; j<patch.nodes.size(); j++){
+					nodes.push_back(gmdsNodes[patch.nodes[j]]);
+					fixed.push_back(!patch.movable[j]);
+				}
+
+				std::vector<gmds::Face> polygones;
+				std::vector<bool> inverted;
+				polygones.reserve(patch.cells.size());
+				inverted.reserve(patch.cells.size());
+				for (size_t j=0; j<patch.cells.size(); j++){
+					polygones.push_back(gmdsPolygones[patch.cells[j]]);
+					inverted.push_back(isPolyInverted[patch.cells[j]]);
+				}
+
+				smooth(nodes, polygones, fixed, inverted, surface, 1, false);
+			};
+			if (parallel && isReentrant())
+				Utils::executeEnParallele(patchs_c.size(), lisse);
+			else
+				for (uint i=0; i<patchs_c.size(); i++)
+					lisse(i);
+		}
+}
+/*----------------------------------------------------------------------------*/
+void SurfacicSmoothing::
+smooth(std::vector<gmds::Node >& gmdsNodes,
+			std::vector<gmds::Face>& gmdsPolygones,
+			const std::vector<bool>& isNodeFixed,
+			const std::vector<bool>& isPolyInverted,
+			Geom::Surface* surface,
+			int nbIterations,
+			bool withQualityAssessment) const
 {
 
 	// définition du modèle pour Mesquite
@@ -139,15 +237,15 @@ applyModification(std::vector<gmds::Node >& gmdsNodes,
 
 	// création d'une structure de maillage pour Mesquite
 	MesquiteMeshAdapter* mesh = new MesquiteMeshAdapter(gmdsPolygones, gmdsNodes,
-			filtre_nodes, isPolyInverted, maskFixed);
+			isNodeFixed, isPolyInverted);
 
 	MeshDomainAssoc myAssoc (mesh, mdl_geom, false, false, true);
 
-	if (m_nbIterations){
+	if (nbIterations){
 
 		if (m_methodeLissage == surfacicOrthogonalSmoothingElliptic){
 
-			MESQUITE_NS::OrthogonalSmoothing algo(m_nbIterations);
+			MESQUITE_NS::OrthogonalSmoothing algo(nbIterations);
 
 			const Mesquite2::Settings dummySettings;
 			MESQUITE_NS::MsqError err;
@@ -206,7 +304,7 @@ applyModification(std::vector<gmds::Node >& gmdsNodes,
 
 			// Critères d'arret
     		MESQUITE_NS::TerminationCriterion tc_inner;
-			tc_inner.add_iteration_limit (m_nbIterations);
+			tc_inner.add_iteration_limit (nbIterations);
 
 			MESQUITE_NS::TerminationCriterion tc_outer;
 			tc_outer.add_iteration_limit (1);
@@ -217,14 +315,18 @@ applyModification(std::vector<gmds::Node >& gmdsNodes,
 			pass1->set_outer_termination_criterion (&tc_outer);
 
 			// Fait une mesure de la qualité et l'affiche (initiale)
-			queue1.add_quality_assessor (&qa, err);
-			MSQ_CHKERR (err);
+			if (withQualityAssessment){
+				queue1.add_quality_assessor (&qa, err);
+				MSQ_CHKERR (err);
+			}
 			// Optimisation <=> lissage
 			queue1.set_master_quality_improver (pass1, err);
 			MSQ_CHKERR (err);
 			// Fait une mesure de la qualité et l'affiche (finale)
-			queue1.add_quality_assessor (&qa, err);
-			MSQ_CHKERR (err);
+			if (withQualityAssessment){
+				queue1.add_quality_assessor (&qa, err);
+				MSQ_CHKERR (err);
+			}
 
 			// c'est maintenant que l'on fait ce qui est dans queue1
 			MESQUITE_NS::MeshDomainAssoc myAssoc(mesh, mdl_geom);
@@ -234,7 +336,7 @@ applyModification(std::vector<gmds::Node >& gmdsNodes,
 			delete pass1;
 			delete qual;
 		} // end else if (m_methodeLissage == surfacicOrthogonalSmoothingElliptic)
-	} // end if (m_nbIterations)
+	} // end if (nbIterations)
 
 	else {
 		// on fait juste une projection
@@ -271,6 +373,8 @@ TkUtil::UTF8String SurfacicSmoothing::getScriptCommand() const
 		o << (short)getNbIterations();
 		o <<", "<<getMgx3DAlias()<<".SurfacicSmoothing." <<toString(getMethod());
 		o <<", "<<getMgx3DAlias()<<".SurfacicSmoothing." <<toString(getSolver());
+		if (getPatchSize())
+			o << ", " << (long)getPatchSize();
 		o << ")";
 	}
 	return o;
@@ -8,8 +8,12 @@
  */
 /*----------------------------------------------------------------------------*/
 #include "Smoothing/VolumicSmoothing.h"
+#include "Smoothing/NativeSmoothing.h"
+#include "Mesh/NodeFilter.h"
+#include "Mesh/MeshPatches.h"
 #include "Mesh/MeshManager.h"
 #include "Utils/Common.h"
+#include "Utils/ParallelExecution.h"
 #include "Geom/Volume.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
@@ -34,6 +38,7 @@ VolumicSmoothing()
 , m_useDefaults(true)
 , m_nbIterations(10)
 , m_methodeLissage(laplace)
+, m_patchSize(0)
 {
 }
 /*----------------------------------------------------------------------------*/
@@ -47,13 +52,15 @@ VolumicSmoothing::VolumicSmoothing(const VolumicSmoothing& vs)
 , m_useDefaults(vs.m_useDefaults)
 , m_nbIterations(vs.m_nbIterations)
 , m_methodeLissage(vs.m_methodeLissage)
+, m_patchSize(vs.m_patchSize)
 {
 }
-VolumicSmoothing::VolumicSmoothing(int nbIterations, eVolumicMethod methodeLissage)
+VolumicSmoothing::VolumicSmoothing(int nbIterations, eVolumicMethod methodeLissage, int patchSize)
 :MeshModificationItf()
 , m_useDefaults(false)
 , m_nbIterations(nbIterations)
 , m_methodeLissage(methodeLissage)
+, m_patchSize(patchSize)
 {
 }
 /*----------------------------------------------------------------------------*/
@@ -69,6 +76,12 @@ void VolumicSmoothing::setMethod(eVolumicMethod methodeLissage)
 	m_methodeLissage = methodeLissage;
 }
 /*----------------------------------------------------------------------------*/
+void VolumicSmoothing::setPatchSize(int patchSize)
+{
+	m_useDefaults = false;
+	m_patchSize = patchSize;
+}
+/*----------------------------------------------------------------------------*/
 VolumicSmoothing& VolumicSmoothing::operator = (const VolumicSmoothing&)
 {
 	MGX_FORBIDDEN("VolumicSmoothing::operator = is not allowed.");
@@ -95,14 +108,20 @@ addToDescription (Mgx3D::Utils::SerializedRepresentation* description) const
 	description->addProperty (
 			Utils::SerializedRepresentation::Property (
 					"Méthode", toString(getMethod())));
+
+	if (getPatchSize())
+		description->addProperty (
+				Utils::SerializedRepresentation::Property (
+						"Nombre de mailles par patch", (long)getPatchSize()));
 }
 /*----------------------------------------------------------------------------*/
 void VolumicSmoothing::
 applyModification(std::vector<gmds::Node>& gmdsNodes,
 			std::vector<gmds::Region>& gmdsPolyedres,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
+			const NodeFilter& filtre_nodes,
 			uint maskFixed,
-			Geom::Volume* volume)
+			Geom::Volume* volume,
+			bool parallel)
 {
 	uint nb_cells = gmdsPolyedres.size();
 	uint nb_vtx = gmdsNodes.size();
@@ -110,42 +129,24 @@ applyModification(std::vector<gmds::Node>& gmdsNodes,
 #ifdef _DEBUG2
 	std::cout<<"VolumicSmoothing::applyModification pour "<<nb_vtx<<" noeuds "
     		 << " et "<<nb_cells<<" polyèdres, dans le volume "
- 			 << volume->getName()<<std::endl;
+ 			 << (volume ? volume->getName() : std::string("(aucun)"))<<std::endl;
 #endif
 
-	  double * weights = new double [nb_cells + nb_vtx];
-	  double * relax = new double [nb_vtx];
+	  // indirection des gmds::Node vers id dans structure Smooth3D
+	  NodeIndex gmds2smooth(gmdsNodes);
+
+	  // connectivité en indices locaux
+	  CellsCSR connectivite;
+	  connectivite.build(gmdsPolyedres, gmds2smooth);
 
-	  for (uint i=0; i<nb_cells + nb_vtx; i++)
-		  weights[i] = 1.0;
+	  double * relax = new double [nb_vtx];
 
 	  for (uint i=0; i<nb_vtx; i++)
-		  if (filtre_nodes[gmdsNodes[i].getID()] == maskFixed)
+		  if (filtre_nodes.get(gmdsNodes[i].getID()) == maskFixed)
 			  relax[i] = 0.0;
 		  else
 			  relax[i] = 1.0;
 
-	  // indirection des gmds::Node vers id dans structure Mesquite
-	  std::map<gmds::TCellID, uint> gmds2mesquite;
-	  for (uint i=0; i<nb_vtx; i++)
-		  gmds2mesquite[gmdsNodes[i].getID()] = i;
-
-	  // nombre de noeuds par maille
-	  int *nb_node_cell = new int[nb_cells];
-	  uint nb_tt_node_cell = 0;
-	  for (uint i=0; i<nb_cells; i++){
-		  nb_node_cell[i] = gmdsPolyedres[i].getNbNodes();
-		  nb_tt_node_cell += nb_node_cell[i];
-	  }
-
-	  int * nodes_number = new int[nb_tt_node_cell];
-	  int * f_nodes_number = nodes_number;
-	  for (int cell = 0; cell < nb_cells; ++cell){
-		  std::vector<gmds::TCellID> nodesIDs = gmdsPolyedres[cell].getAllIDs<gmds::Node>();
-		  for (int vtx = 0; vtx < nodesIDs.size(); ++ vtx)
-			  *f_nodes_number++ = gmds2mesquite[nodesIDs[vtx]];
-	  }
-
 	  double *x = new double [nb_vtx];
 	  double *y = new double [nb_vtx];
 	  double *z = new double [nb_vtx];
@@ -155,6 +156,69 @@ applyModification(std::vector<gmds::Node>& gmdsNodes,
 		  z[vtx] = gmdsNodes[vtx].Z();
 	  }
 
+	  int err = 0;
+	  try {
+		  if (m_patchSize > 0 && nb_cells > (uint)m_patchSize)
+			  err = smoothByPatches(nb_vtx, connectivite, x, y, z, relax, parallel);
+		  else {
+			  // nombre de noeuds par maille
+			  std::vector<int> nb_node_cell(nb_cells);
+			  for (uint i=0; i<nb_cells; i++)
+				  nb_node_cell[i] = connectivite.getNbNodes(i);
+
+			  int * nodes_number = (nb_cells ? &connectivite.indices()[0] : 0);
+
+			  err = smoothCells(nb_cells, nb_vtx,
+					  nb_cells ? &nb_node_cell[0] : 0, nodes_number,
+					  x, y, z, relax, m_nbIterations, parallel);
+		  }
+	  }
+	  catch (...){
+		  delete [] x;
+		  delete [] y;
+		  delete [] z;
+		  delete [] relax;
+		  throw;
+	  }
+
+#ifdef _DEBUG2
+	  std::cout<<" => err = "<<err<<std::endl;
+#endif
+
+	  // on ne fait pas confiance au lisseur, capable de déplacer n'importe où un noeud figé
+	  for (int vtx = 0; vtx < nb_vtx; ++ vtx)
+		  if (relax[vtx] == 1.0){
+			  gmdsNodes[vtx].setX(x[vtx]);
+			  gmdsNodes[vtx].setY(y[vtx]);
+			  gmdsNodes[vtx].setZ(z[vtx]);
+		  }
+
+	  delete [] x;
+	  delete [] y;
+	  delete [] z;
+	  delete [] relax;
+
+
+}
+/*----------------------------------------------------------------------------*/
+bool VolumicSmoothing::isReentrant() const
+{
+#ifdef USE_SMOOTH3D
+	return false;
+#else
+	return true;
+#endif	// USE_SMOOTH3D
+}
+/*----------------------------------------------------------------------------*/
+int VolumicSmoothing::
+smoothCells(int nb_cells, int nb_vtx, int* nb_node_cell, int* nodes_number,
+		double* x, double* y, double* z, double* relax, int nbIterations,
+		bool parallel) const
+{
+#ifdef USE_SMOOTH3D
+	  std::vector<double> weights(nb_cells + nb_vtx, 1.0);
+#endif
+
 	  int err = 0;
 	  switch (m_methodeLissage){
 #ifdef USE_SMOOTH3D
@@ -163,59 +227,120 @@ applyModification(std::vector<gmds::Node>& gmdsNodes,
 		  err = S3_laplace(nb_cells, nb_vtx,
 				  nb_node_cell, nodes_number,
 				  x, y, z,
-				  weights, relax, m_nbIterations);
+				  &weights[0], relax, nbIterations);
 		  break;
 	  case tipton:
 		  err = S3_Tipton(nb_cells, nb_vtx,
 				  nb_node_cell, nodes_number,
 				  x, y, z,
-				  weights, relax, m_nbIterations);
+				  &weights[0], relax, nbIterations);
 		  break;
 	  case jun:
 		  err = S3_Jun(nb_cells, nb_vtx,
 				  nb_node_cell, nodes_number,
 				  x, y, z,
-				  weights, relax, m_nbIterations);
+				  &weights[0], relax, nbIterations);
 		  break;
 	  case conditionNumber:
 		  err = S3_ConditionNumber(nb_cells, nb_vtx,
 				  nb_node_cell, nodes_number,
 				  x, y, z,
-				  weights, relax, m_nbIterations);
+				  &weights[0], relax, nbIterations);
 		  break;
 	  case inverseMeanRatio:
 		  err = S3_InverseMeanRatio(nb_cells, nb_vtx,
 				  nb_node_cell, nodes_number,
 				  x, y, z,
-				  weights, relax, m_nbIterations);
+				  &weights[0], relax, nbIterations);
 		  break;
+#else
+	  // sans Smooth3D, les méthodes laplace et tipton sont disponibles en interne
+	  case laplace:
+		  err = NativeSmoothing::laplace(nb_cells, nb_vtx,
+				  nb_node_cell, nodes_number,
+				  x, y, z,
+				  relax, nbIterations, parallel);
+		  break;
+	  case tipton:
+		  err = NativeSmoothing::tipton(nb_cells, nb_vtx,
+				  nb_node_cell, nodes_number,
+				  x, y, z,
+				  relax, nbIterations, parallel);
+		  break;
+	  case jun:
+	  case conditionNumber:
+	  case inverseMeanRatio:
+		  throw TkUtil::Exception (TkUtil::UTF8String ("La méthode de lissage volumique "+toString(m_methodeLissage)+" nécessite Smooth3D, seules laplace et tipton sont disponibles", TkUtil::Charset::UTF_8));
 #endif	// USE_SMOOTH3D
 	  default:
 		  throw TkUtil::Exception (TkUtil::UTF8String ("Erreur interne, VolumicSmoothing appelé avec une méthode non prévue", TkUtil::Charset::UTF_8));
 	  }
 
-	  delete [] weights;
-	  delete [] nb_node_cell;
-	  delete [] nodes_number;
+	  return err;
+}
+/*----------------------------------------------------------------------------*/
+int VolumicSmoothing::
+smoothByPatches(int nb_vtx, const CellsCSR& connectivite,
+		double* x, double* y, double* z, double* relax, bool parallel) const
+{
+	std::vector<bool> movable(nb_vtx);
+	for (int i=0; i<nb_vtx; i++)
+		movable[i] = (relax[i] == 1.0);
+
+	MeshPatches patches(connectivite, movable, m_patchSize);
+	const std::vector<std::vector<uint> >& couleurs = patches.getColors();
 
 #ifdef _DEBUG2
-	  std::cout<<" => err = "<<err<<std::endl;
+	std::cout<<"VolumicSmoothing::smoothByPatches avec "<<patches.getNbPatches()
+			<<" patchs et "<<couleurs.size()<<" couleurs"<<std::endl;
 #endif
 
-	  // on ne fait pas confiance au lisseur, capable de déplacer n'importe où un noeud figé
-	  for (int vtx = 0; vtx < nb_vtx; ++ vtx)
-		  if (relax[vtx] == 1.0){
-			  gmdsNodes[vtx].setX(x[vtx]);
-			  gmdsNodes[vtx].setY(y[vtx]);
-			  gmdsNodes[vtx].setZ(z[vtx]);
-		  }
+	std::vector<int> erreurs(patches.getNbPatches(), 0);
 
-	  delete [] x;
-	  delete [] y;
-	  delete [] z;
-	  delete [] relax;
+	// les patchs d'une même couleur sont indépendants, chacun lit les
+	// coordonnées de son étoile et ne recopie que ses noeuds déplaçables
+	for (int iter=0; iter<m_nbIterations; iter++)
+		for (size_t c=0; c<couleurs.size(); c++){
+			const std::vector<uint>& patchs_c = couleurs[c];
+			auto lisse = [&](uint i){
+				const MeshPatches::Patch& patch = patches.getPatch(patchs_c[i]);
+				int nb_nodes = patch.nodes.size();
+				std::vector<double> px(nb_nodes), py(nb_nodes), pz(nb_nodes), prelax(nb_nodes);
+				for (int j=0; j<nb_nodes; j++){
+					int n = patch.nodes[j];
+					px[j] = x[n];
+					py[j] = y[n];
+					pz[j] = z[n];
+					prelax[j] = (patch.movable[j] ? 1.0 : 0.0);
+				}
+				std::vector<int> nb_node_cell(patch.nbNodesCell);
+				std::vector<int> nodes_number(patch.cellNodes);
 
+				int err = smoothCells(patch.cells.size(), nb_nodes,
+						&nb_node_cell[0], &nodes_number[0],
+						&px[0], &py[0], &pz[0], &prelax[0], 1, parallel);
+				if (err)
+					erreurs[patchs_c[i]] = err;
+
+				for (int j=0; j<nb_nodes; j++)
+					if (patch.movable[j]){
+						int n = patch.nodes[j];
+						x[n] = px[j];
+						y[n] = py[j];
+						z[n] = pz[j];
+					}
+			};
+			if (parallel && isReentrant())
+				Utils::executeEnParallele(patchs_c.size(), lisse);
+			else
+				for (uint i=0; i<patchs_c.size(); i++)
+					lisse(i);
+		}
 
+	for (size_t i=0; i<erreurs.size(); i++)
+		if (erreurs[i])
+			return erreurs[i];
+	return 0;
 }
 /*----------------------------------------------------------------------------*/
 TkUtil::UTF8String VolumicSmoothing::getScriptCommand() const
@@ -227,6 +352,8 @@ TkUtil::UTF8String VolumicSmoothing::getScriptCommand() const
 			o << getMgx3DAlias() << ".VolumicSmoothing(";
 			o << (short)getNbIterations();
 			o <<", "<<getMgx3DAlias()<<".VolumicSmoothing." <<toString(getMethod());
+			if (getPatchSize())
+				o << ", " << (long)getPatchSize();
 			o << ")";
 		}
 	return o;
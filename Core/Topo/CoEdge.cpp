@@ -23,6 +23,8 @@
 #include "Topo/EdgeMeshingPropertyTabulated.h"
 #include "Topo/CommandEditTopo.h"
 #include "Topo/TopoHelper.h"
+#include "Topo/TopoManager.h"
+#include "Topo/CoEdgePreMeshCache.h"
 
 #include "Mesh/CommandCreateMesh.h"
 #include "Mesh/MeshImplementation.h"
@@ -35,6 +37,7 @@
 #include "Utils/MgxException.h"
 
 #include "Internal/InfoCommand.h"
+#include "Internal/Context.h"
 #include "Internal/InternalPreferences.h"
 
 #include "Geom/GeomEntity.h"
@@ -1034,8 +1037,22 @@ void CoEdge::getPoints(std::vector<Utils::Math::Point> &points) const
 	}
 
 	if (!isPreMeshed()){
-		m_mesh_data->points().clear();
-		getPoints(m_mesh_property, m_mesh_data->points(), true);
+		// les points sont calculés à part, les lecteurs (PointsView) ne
+		// sont bloqués que le temps de l'échange
+		std::vector<Utils::Math::Point> new_points;
+
+		// réutilisation des points d'une discrétisation identique
+		// (même loi, même association et mêmes extrémités)
+		CoEdgePreMeshCache& cache = getContext().getLocalTopoManager().getPreMeshCache();
+		std::string key = CoEdgePreMeshCache::computeKey(this, m_mesh_property);
+		if (key.empty() || !cache.find(key, new_points)){
+			getPoints(m_mesh_property, new_points, true);
+			if (!key.empty())
+				cache.add(key, new_points);
+		}
+
+		Utils::AutoWriteLock autoLock (&m_points_lock);
+		m_mesh_data->points().swap(new_points);
 		getMeshingData()->setPreMeshed(true);
 #ifdef _DEBUG_GETPOINTS
 		std::cout<<getName()<<" => est prémaillée"<<(pointsUpToDate?"":" (actualisation)")<<std::endl;
@@ -1045,14 +1062,7 @@ void CoEdge::getPoints(std::vector<Utils::Math::Point> &points) const
 	}
 
 	if (isMeshed()){
-
-	    gmds::IGMesh& gmds_mesh = getContext().getLocalMeshManager().getMesh()->getGMDSMesh();
-
-		for (std::vector<gmds::TCellID>::iterator iter = m_mesh_data->nodes().begin();
-		    			iter != m_mesh_data->nodes().end(); ++iter){
-			const gmds::Node& nd = gmds_mesh.get<gmds::Node>(*iter);
-			points.push_back(Utils::Math::Point(nd.X(), nd.Y(), nd.Z()));
-		}
+		getNodesPoints(points);
 	}
 	else if (isPreMeshed()){
 
@@ -1069,10 +1079,54 @@ void CoEdge::getPoints(std::vector<Utils::Math::Point> &points) const
 	}
 }
 /*----------------------------------------------------------------------------*/
+CoEdge::PointsView::PointsView(const CoEdge* coedge)
+: m_lock(0)
+, m_points(&m_buffer)
+{
+	if (coedge->isMeshed()){
+		coedge->getNodesPoints(m_buffer);
+		return;
+	}
+
+	// cas usuel, le prémaillage est à jour, on n'en fait pas de copie
+	// et on le garde verrouillé tant que l'instance existe
+	coedge->m_points_lock.readLock();
+	if (coedge->isPreMeshed()){
+		m_lock = &coedge->m_points_lock;
+		m_points = &coedge->m_mesh_data->points();
+		return;
+	}
+	coedge->m_points_lock.unlock();
+
+	// prémaillage à calculer (ou non mémorisé)
+	coedge->getPoints(m_buffer);
+}
+/*----------------------------------------------------------------------------*/
+CoEdge::PointsView::~PointsView()
+{
+	if (m_lock)
+		m_lock->unlock();
+}
+/*----------------------------------------------------------------------------*/
+void CoEdge::getNodesPoints(std::vector<Utils::Math::Point> &points) const
+{
+	gmds::IGMesh& gmds_mesh = getContext().getLocalMeshManager().getMesh()->getGMDSMesh();
+
+	// une seule allocation pour l'ensemble des coordonnées
+	const std::vector<gmds::TCellID>& nodes = m_mesh_data->nodes();
+	const uint nbNodes = nodes.size();
+	points.reserve(points.size()+nbNodes);
+	for (uint i=0; i<nbNodes; i++){
+		const gmds::Node& nd = gmds_mesh.get<gmds::Node>(nodes[i]);
+		points.push_back(Utils::Math::Point(nd.X(), nd.Y(), nd.Z()));
+	}
+}
+/*----------------------------------------------------------------------------*/
 void CoEdge::clearPoints()
 {
 	// protection pour éviter les appels concurrents pouvant modifier le preMesh
 	TkUtil::AutoMutex autoMutex (&preMeshMutex);
+	Utils::AutoWriteLock autoLock (&m_points_lock);
 	m_mesh_data->points().clear();
 }
 /*----------------------------------------------------------------------------*/
@@ -1145,7 +1199,7 @@ Geom::Curve* CoEdge::createBSplineByProj(Utils::Math::Point& pt0,
 #ifdef _DEBUG_GETPOINTS
 	std::cout<<" newBSpline..."<<std::endl;
 #endif
-	curve = Geom::EntityFactory(getContext()).newBSpline(points_bspline, 1, 2);
+	curve = Geom::EntityFactory(getContext()).newTemporaryBSpline(points_bspline, 1, 2);
 
 #ifdef _DEBUG_GETPOINTS
 	//std::cout <<"  Utilisation d'une courbe ("<<curve->getName()<<") issue de la projection d'une arête sur la surface"<<std::endl;
@@ -1266,7 +1320,7 @@ Geom::Curve* CoEdge::createBSplineByProjWithOrthogonalIntersection(Utils::Math::
 #ifdef _DEBUG_GETPOINTS
 	std::cout<<" newBSpline..."<<std::endl;
 #endif
-	curve = Geom::EntityFactory(getContext()).newBSpline(points_bspline, 1, 2);
+	curve = Geom::EntityFactory(getContext()).newTemporaryBSpline(points_bspline, 1, 2);
 
 #ifdef _DEBUG_GETPOINTS
 	//std::cout <<"  Utilisation d'une courbe ("<<curve->getName()<<") issue de la projection d'une arête sur la surface"<<std::endl;
@@ -1331,9 +1385,6 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 			// on fait la projection des points en tenant compte d'un paramètre curviligne
 			// pour les projections sur courbes
 
-			// mémorisation des ids, pour le cas de la création d'une courbe temporaire
-			std::vector<unsigned long> name_manager_before;
-
 			// courbe sur laquelle se fait la projection
 			Geom::Curve* curve = 0;
 			bool curveToBeDeleted = false;
@@ -1341,7 +1392,6 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 				curve = dynamic_cast<Geom::Curve*> (ge);
 			else if (ge->getType() == Utils::Entity::GeomSurface){
 
-				getContext().getNameManager().getInternalStats(name_manager_before);
 				Geom::Surface* surface = dynamic_cast<Geom::Surface*> (ge);
 				CHECK_NULL_PTR_ERROR(surface);
 
@@ -1360,9 +1410,6 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 					}
 					catch (TkUtil::Exception& exc){
 
-						// remet les compteurs pour les ids
-						getContext().getNameManager().setInternalStats(name_manager_before);
-
 						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
 						message << "Pb avec création d'une courbe par projection de l'arête "<<getName()<<" sur la surface "<<ge->getName();
 						message << "\nLe pb est peut-être lié à une projection sur un demi cercle => couper l'arête en deux";
@@ -1377,9 +1424,6 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 				}
 				catch (TkUtil::Exception& exc){
 
-					// remet les compteurs pour les ids
-					getContext().getNameManager().setInternalStats(name_manager_before);
-
 					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
 					message << "Pb avec création d'une courbe par projection de l'arête "<<getName()<<" sur la surface "<<ge->getName();
 					message << "\nLe pb est peut-être lié à une projection en dehors de la surface => découper l'arête et revoir les associations";
@@ -1393,9 +1437,6 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 				}
 
 				if (0 == curve){
-					// remet les compteurs pour les ids
-					getContext().getNameManager().setInternalStats(name_manager_before);
-
 					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
 					message << "OCC a échoué, création de la projection de l'arête "
 							<< getName() << " sur la surface  "<<ge->getName()
@@ -1473,13 +1514,14 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 				throw TkUtil::Exception (message);
 			}
 
-			double* l_ratios = new double[nbBrasI-1];
-			for (uint i=0; i<nbBrasI-1; i++){
-				l_ratios[i] = dni->nextCoeff();
+			// l_coeffs[0] = 0, les ratios des noeuds internes suivent
+			std::vector<double> l_coeffs;
+			dni->getCoeffs(l_coeffs);
+			double* l_ratios = &l_coeffs[1];
 #ifdef _DEBUG_GETPOINTS
-					std::cout<<"  l_ratios["<<i<<"] = "<<l_ratios[i]<<std::endl;
+			for (uint i=0; i<nbBrasI-1; i++)
+				std::cout<<"  l_ratios["<<i<<"] = "<<l_ratios[i]<<std::endl;
 #endif
-			}
 
 			if (curve == 0){
 				TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
@@ -1528,8 +1570,6 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 				throw TkUtil::Exception (message);
 			}
 
-			delete [] l_ratios;
-
 			// on replace les noeuds de l'arête sur la surface
 			if (curveToBeDeleted){
 				Geom::Surface* surface = dynamic_cast<Geom::Surface*> (ge);
@@ -1563,11 +1603,9 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 				}
 			}
 
-			if (curveToBeDeleted){
+			// la courbe temporaire n'a pas consommé d'identifiant
+			if (curveToBeDeleted)
 				delete curve;
-				// remet les compteurs pour les ids
-				getContext().getNameManager().setInternalStats(name_manager_before);
-			}
 
 		} // end if (nbBrasI > 1)
 
@@ -1805,11 +1843,13 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 			throw TkUtil::Exception (message);
 		}
 
+		std::vector<double> l_coeffs;
+		dni->getCoeffs(l_coeffs);
+
+		points.reserve(points.size()+nbBrasI+1);
 		points.push_back(pt0);
-		for (uint i=0; i<nbBrasI-1; i++){
-			Utils::Math::Point pt = pt0 + vect * dni->nextCoeff();
-			points.push_back(pt);
-		}
+		for (uint i=1; i<nbBrasI; i++)
+			points.push_back(pt0 + vect * l_coeffs[i]);
 		points.push_back(pt1);
 	}
 
@@ -2006,9 +2046,12 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 
         // reprojection sur la surface pour le cas où on l'aurait quitté
         if (getGeomAssociation() && getGeomAssociation()->getType() == Utils::Entity::GeomSurface){
-        	Geom::GeomEntity* ge = getGeomAssociation();
+        	Geom::Surface* surface = dynamic_cast<Geom::Surface*>(getGeomAssociation());
+        	CHECK_NULL_PTR_ERROR(surface);
+        	std::vector<Utils::Math::Point> ptInternes(points.begin()+1, points.end()-1);
+        	surface->project(ptInternes);
         	for (uint i=1; i<points.size()-1; i++)
-        		ge->project(points[i]);
+        		points[i] = ptInternes[i-1];
         }
 
     } // end if (dni->isOrthogonal())
@@ -2914,6 +2957,52 @@ void CoEdge::getCoEdges(std::vector<std::string>& coedges_names, std::vector<Top
 	}
 }
 /*----------------------------------------------------------------------------*/
+void CoEdge::getInterpolationReferences(std::vector<CoEdge*>& coedges) const
+{
+	coedges.clear();
+	std::vector<std::string> coedges_names;
+
+	if (m_mesh_property->getMeshLaw() == CoEdgeMeshingProperty::interpolate){
+		EdgeMeshingPropertyInterpolate* interpol = dynamic_cast<EdgeMeshingPropertyInterpolate*>(m_mesh_property);
+		CHECK_NULL_PTR_ERROR(interpol);
+		if (interpol->getType() == EdgeMeshingPropertyInterpolate::with_coedge_list)
+			coedges_names = interpol->getCoEdges();
+		else if (interpol->getType() == EdgeMeshingPropertyInterpolate::with_coface) {
+			CoFace* coface = 0;
+			try {
+				coface = getContext().getLocalTopoManager().getCoFace(interpol->getCoFace(), false);
+			}
+			catch (Utils::IsDestroyedException &e){
+			}
+			if (coface){
+				std::vector<CoEdge*> coface_coedges;
+				coface->getCoEdges(coface_coedges);
+				for (uint i=0; i<coface_coedges.size(); i++)
+					if (coface_coedges[i] != this)
+						coedges.push_back(coface_coedges[i]);
+			}
+		}
+	}
+	else if (m_mesh_property->getMeshLaw() == CoEdgeMeshingProperty::globalinterpolate){
+		EdgeMeshingPropertyGlobalInterpolate* interpol = dynamic_cast<EdgeMeshingPropertyGlobalInterpolate*>(m_mesh_property);
+		CHECK_NULL_PTR_ERROR(interpol);
+		coedges_names = interpol->getFirstCoEdges();
+		std::vector<std::string> second_coedges_names = interpol->getSecondCoEdges();
+		coedges_names.insert(coedges_names.end(), second_coedges_names.begin(), second_coedges_names.end());
+	}
+
+	for (uint i=0; i<coedges_names.size(); i++){
+		CoEdge* coedge = 0;
+		try {
+			coedge = getContext().getLocalTopoManager().getCoEdge(coedges_names[i], false);
+		}
+		catch (Utils::IsDestroyedException &e){
+		}
+		if (coedge && coedge != this)
+			coedges.push_back(coedge);
+	}
+}
+/*----------------------------------------------------------------------------*/
 void CoEdge::setGeomAssociation(Geom::GeomEntity* ge)
 {
 	m_mesh_property->updateModificationTime();
@@ -114,6 +114,15 @@ void CoEdgeMeshingProperty::setOrthogonal(int nbLayers, bool sens)
 		m_side = side_undef;
 }
 /*----------------------------------------------------------------------------*/
+void CoEdgeMeshingProperty::getCoeffs(std::vector<double>& coeffs)
+{
+	coeffs.resize(m_nb_edges+1);
+	coeffs[0] = 0.0;
+	for (int i=1; i<m_nb_edges; i++)
+		coeffs[i] = nextCoeff();
+	coeffs[m_nb_edges] = 1.0;
+}
+/*----------------------------------------------------------------------------*/
 uint CoEdgeMeshingProperty::getSide() const
 {
 	if (m_side == side_min)
@@ -0,0 +1,198 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file CoEdgePreMeshCache.cpp
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Topo/CoEdgePreMeshCache.h"
+#include "Topo/CoEdge.h"
+#include "Topo/Vertex.h"
+#include "Topo/CoFace.h"
+#include "Topo/Block.h"
+#include "Topo/CoEdgeMeshingProperty.h"
+#include "Geom/GeomEntity.h"
+#include "Geom/Surface.h"
+#include "Geom/Curve.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+/// ajoute la représentation binaire (exacte) d'une valeur à la clé
+template<typename T>
+static void appendToKey(std::string& key, const T& val)
+{
+	key.append(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+/*----------------------------------------------------------------------------*/
+static void appendPointToKey(std::string& key, const Utils::Math::Point& pt)
+{
+	appendToKey(key, pt.getX());
+	appendToKey(key, pt.getY());
+	appendToKey(key, pt.getZ());
+}
+/*----------------------------------------------------------------------------*/
+static void appendGeomToKey(std::string& key, const Geom::GeomEntity* ge)
+{
+	unsigned long uid = (ge ? ge->getUniqueId() : 0);
+	appendToKey(key, uid);
+}
+/*----------------------------------------------------------------------------*/
+static void appendGeomBoundsToKey(std::string& key, const Geom::GeomEntity* ge)
+{
+	appendGeomToKey(key, ge);
+	if (ge){
+		double bounds[6];
+		ge->getBounds(bounds);
+		for (uint i=0; i<6; i++)
+			appendToKey(key, bounds[i]);
+	}
+}
+/*----------------------------------------------------------------------------*/
+/** ajoute à la clé ce dont dépend le calcul de la normale pour une
+ *  discrétisation orthogonale (cf CoEdge::getPoints) :
+ *  les courbes et surfaces voisines de l'association du sommet de départ,
+ *  et le voisinage topologique de ce sommet (arêtes, faces et blocs),
+ *  utilisé par TopoHelper::computeNormale
+ */
+static void appendOrthogonalToKey(std::string& key, const CoEdge* coedge, CoEdgeMeshingProperty* prop)
+{
+	Vertex* vtx0 = coedge->getVertex(prop->getSide());
+
+	Geom::GeomEntity* ge = vtx0->getGeomAssociation();
+	if (ge){
+		std::vector<Geom::Surface*> surfaces;
+		ge->get(surfaces);
+		appendToKey(key, surfaces.size());
+		for (uint i=0; i<surfaces.size(); i++)
+			appendGeomBoundsToKey(key, surfaces[i]);
+
+		std::vector<Geom::Curve*> curves;
+		ge->get(curves);
+		appendToKey(key, curves.size());
+		for (uint i=0; i<curves.size(); i++)
+			appendGeomBoundsToKey(key, curves[i]);
+	}
+
+	std::vector<CoEdge*> coedges;
+	vtx0->getCoEdges(coedges);
+	appendToKey(key, coedges.size());
+	for (uint i=0; i<coedges.size(); i++){
+		appendToKey(key, coedges[i]->getUniqueId());
+		Vertex* vtx = coedges[i]->getOppositeVertex(vtx0);
+		appendPointToKey(key, vtx->getCoord());
+		appendGeomToKey(key, vtx->getGeomAssociation());
+		appendGeomToKey(key, coedges[i]->getGeomAssociation());
+	}
+
+	std::vector<CoFace*> cofaces;
+	vtx0->getCoFaces(cofaces);
+	appendToKey(key, cofaces.size());
+	for (uint i=0; i<cofaces.size(); i++)
+		appendToKey(key, cofaces[i]->getUniqueId());
+
+	std::vector<Block*> blocks;
+	coedge->getBlocks(blocks);
+	appendToKey(key, blocks.size());
+	for (uint i=0; i<blocks.size(); i++)
+		appendToKey(key, blocks[i]->getUniqueId());
+}
+/*----------------------------------------------------------------------------*/
+CoEdgePreMeshCache::CoEdgePreMeshCache(size_t maxNbPoints)
+: m_nbPoints(0)
+, m_maxNbPoints(maxNbPoints)
+{
+}
+/*----------------------------------------------------------------------------*/
+std::string CoEdgePreMeshCache::computeKey(const CoEdge* coedge, CoEdgeMeshingProperty* prop)
+{
+	// les points dépendent d'autres arêtes
+	if (prop->getMeshLaw() == CoEdgeMeshingProperty::interpolate
+			|| prop->getMeshLaw() == CoEdgeMeshingProperty::globalinterpolate)
+		return std::string();
+
+	if (coedge->getNbVertices() != 2)
+		return std::string();
+
+	std::string key;
+
+	// la discrétisation, la commande de script en donne les paramètres
+	// (orthogonalité comprise)
+	TkUtil::UTF8String script = prop->getScriptCommandBegin();
+	key += script.utf8();
+	key += '\0';
+	appendToKey(key, (int)prop->getMeshLaw());
+	appendToKey(key, prop->getNbEdges());
+	appendToKey(key, prop->getDirect());
+
+	// l'association
+	appendGeomBoundsToKey(key, coedge->getGeomAssociation());
+
+	// les extrémités
+	for (uint i=0; i<2; i++){
+		Vertex* vtx = coedge->getVertex(i);
+		appendPointToKey(key, vtx->getCoord());
+		appendGeomToKey(key, vtx->getGeomAssociation());
+		appendToKey(key, vtx->isMeshed());
+	}
+
+	// la normale d'une discrétisation orthogonale dépend du voisinage
+	if (prop->isOrthogonal())
+		appendOrthogonalToKey(key, coedge, prop);
+
+	return key;
+}
+/*----------------------------------------------------------------------------*/
+bool CoEdgePreMeshCache::find(const std::string& key, std::vector<Utils::Math::Point>& points)
+{
+	TkUtil::AutoMutex autoMutex (&m_mutex);
+
+	std::unordered_map<std::string, std::vector<Utils::Math::Point> >::const_iterator iter =
+			m_points.find(key);
+	if (iter == m_points.end())
+		return false;
+
+	points.insert(points.end(), iter->second.begin(), iter->second.end());
+	return true;
+}
+/*----------------------------------------------------------------------------*/
+void CoEdgePreMeshCache::add(const std::string& key, const std::vector<Utils::Math::Point>& points)
+{
+	if (points.size() > m_maxNbPoints)
+		return;
+
+	TkUtil::AutoMutex autoMutex (&m_mutex);
+
+	if (m_points.find(key) != m_points.end())
+		return;
+
+	// retire les plus anciennes entrées
+	while (m_nbPoints + points.size() > m_maxNbPoints && !m_keys.empty()){
+		std::unordered_map<std::string, std::vector<Utils::Math::Point> >::iterator iter =
+				m_points.find(m_keys.front());
+		m_nbPoints -= iter->second.size();
+		m_points.erase(iter);
+		m_keys.pop_front();
+	}
+
+	m_points[key] = points;
+	m_keys.push_back(key);
+	m_nbPoints += points.size();
+}
+/*----------------------------------------------------------------------------*/
+void CoEdgePreMeshCache::clear()
+{
+	TkUtil::AutoMutex autoMutex (&m_mutex);
+
+	m_points.clear();
+	m_keys.clear();
+	m_nbPoints = 0;
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
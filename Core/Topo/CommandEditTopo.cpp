@@ -185,6 +185,86 @@ void CommandEditTopo::deleteInternalsStats()
 //#endif
 }
 /*----------------------------------------------------------------------------*/
+/// estimation de la mémoire occupée par une entité topologique et son maillage
+static size_t tailleEntiteTopo(Topo::TopoEntity* te)
+{
+    const size_t id = sizeof(gmds::TCellID);
+
+    if (Block* bloc = dynamic_cast<Block*>(te))
+        return sizeof(Block) + (bloc->nodes().capacity() + bloc->regions().capacity())*id;
+    else if (CoFace* coface = dynamic_cast<CoFace*>(te))
+        return sizeof(CoFace) + (coface->nodes().capacity() + coface->faces().capacity())*id;
+    else if (CoEdge* coedge = dynamic_cast<CoEdge*>(te))
+        return sizeof(CoEdge) + (coedge->nodes().capacity() + coedge->edges().capacity())*id
+                + coedge->getMeshingData()->points().capacity()*sizeof(Utils::Math::Point);
+    else if (dynamic_cast<Face*>(te))
+        return sizeof(Face);
+    else if (dynamic_cast<Edge*>(te))
+        return sizeof(Edge);
+    else if (dynamic_cast<Vertex*>(te))
+        return sizeof(Vertex);
+    return 0;
+}
+/*----------------------------------------------------------------------------*/
+size_t CommandEditTopo::getMemoryFootprint ( ) const
+{
+    size_t taille = Internal::CommandInternal::getMemoryFootprint();
+
+    // les entités détruites (ou créées puis annulées) sont conservées
+    // jusqu'à la destruction de la commande
+    const std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& topo_entities_info =
+            getInfoCommand().getTopoInfoEntity();
+    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter_tei = topo_entities_info.begin();
+            iter_tei != topo_entities_info.end(); ++iter_tei)
+        if (iter_tei->second == Internal::InfoCommand::DELETED)
+            taille += tailleEntiteTopo(iter_tei->first);
+
+#define PROPERTY_SIZE(T,P,L) \
+    taille += L.capacity()*sizeof(T) + L.size()*sizeof(P);
+
+    PROPERTY_SIZE (TopoPropertyInfo,          TopoProperty,          m_topo_property_info);
+    PROPERTY_SIZE (VertexTopoPropertyInfo,    VertexTopoProperty,    m_vertex_topo_property_info);
+    PROPERTY_SIZE (VertexGeomPropertyInfo,    VertexGeomProperty,    m_vertex_geom_property_info);
+    PROPERTY_SIZE (CoEdgeTopoPropertyInfo,    CoEdgeTopoProperty,    m_coedge_topo_property_info);
+    PROPERTY_SIZE (CoEdgeMeshingPropertyInfo, CoEdgeMeshingProperty, m_coedge_mesh_property_info);
+    PROPERTY_SIZE (EdgeTopoPropertyInfo,      EdgeTopoProperty,      m_edge_topo_property_info);
+    PROPERTY_SIZE (EdgeMeshingPropertyInfo,   EdgeMeshingProperty,   m_edge_mesh_property_info);
+    PROPERTY_SIZE (CoFaceTopoPropertyInfo,    CoFaceTopoProperty,    m_coface_topo_property_info);
+    PROPERTY_SIZE (CoFaceMeshingPropertyInfo, CoFaceMeshingProperty, m_coface_mesh_property_info);
+    PROPERTY_SIZE (FaceTopoPropertyInfo,      FaceTopoProperty,      m_face_topo_property_info);
+    PROPERTY_SIZE (FaceMeshingPropertyInfo,   FaceMeshingProperty,   m_face_mesh_property_info);
+    PROPERTY_SIZE (BlockTopoPropertyInfo,     BlockTopoProperty,     m_block_topo_property_info);
+    PROPERTY_SIZE (BlockMeshingPropertyInfo,  BlockMeshingProperty,  m_block_mesh_property_info);
+
+#undef PROPERTY_SIZE
+
+    return taille;
+}
+/*----------------------------------------------------------------------------*/
+bool CommandEditTopo::releaseUndoData ( )
+{
+    TkUtil::AutoReferencedMutex	autoMutex (getMutex ( ));
+
+    if (Command::DONE != getStatus ( ))
+        return false;
+
+    deleteInternalsStats();
+
+    // les entités détruites par la commande ne seront plus restaurées
+    deleteCreated();
+    releaseInternalUndoData();
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+size_t CommandEditTopo::getReleasableMemory ( ) const
+{
+    if (Command::DONE != getStatus ( ))
+        return 0;
+
+    // tout sauf la commande elle-même
+    return getMemoryFootprint() - sizeof(Internal::CommandInternal);
+}
+/*----------------------------------------------------------------------------*/
 void CommandEditTopo::deleteCreated()
 {
 #ifdef _DEBUG_MEMORY
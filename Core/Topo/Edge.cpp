@@ -957,34 +957,25 @@ void Edge::getPoints(std::vector<Utils::Math::Point> &points) const
 
 		v_opp = (*iter)->getOppositeVertex(v_dep);
 
-		std::vector<Utils::Math::Point> coedge_points; // les points de la CoEdge
-		(*iter)->getPoints(coedge_points);
+		// les points de la CoEdge, sans copie
+		CoEdge::PointsView view(*iter);
+		const std::vector<Utils::Math::Point>& coedge_points = view.points();
 
 //		std::cout<<" => CoEdge::getPoints pour "<<(*iter)->getName()
 //				<<", v_dep : "<<v_dep->getName()<<", v_opp : "<<v_opp->getName()<<std::endl;
 
-		// si sens inverse / edge, on permute les points
-		if ((*iter)->getVertex(0) != v_dep){
-//			std::cout<<"  inversion du sens ..."<<std::endl;
-			uint nb = coedge_points.size();
-			for (uint i=0; i<nb/2; i++){
-				Utils::Math::Point pt = coedge_points[i];
-				coedge_points[i] = coedge_points[nb-i-1];
-				coedge_points[nb-i-1] = pt;
-			}
-		}
-
-		std::vector<Utils::Math::Point>::iterator iter2 = coedge_points.begin();
+		// si sens inverse / edge, on parcourt les points depuis la fin
+		const bool inverse = ((*iter)->getVertex(0) != v_dep);
+		const uint nb = coedge_points.size();
 
 		uint nb_bras = (*iter)->getNbMeshingEdges() / ratio;
 
 		if (v_dep == getVertex(0))
-			points.push_back(*iter2);
+			points.push_back(coedge_points[inverse ? nb-1 : 0]);
 
-		for (uint j=0; j<nb_bras; j++){
-			for (int i=0; i<ratio; i++)
-				++iter2;
-			points.push_back(*iter2);
+		for (uint j=1; j<=nb_bras; j++){
+			uint ind = j*ratio;
+			points.push_back(coedge_points[inverse ? nb-1-ind : ind]);
 		}
 
 		v_dep = v_opp;
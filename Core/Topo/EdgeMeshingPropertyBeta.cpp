@@ -95,6 +95,20 @@ nextCoeff()
     return feta;
 }
 /*----------------------------------------------------------------------------*/
+void EdgeMeshingPropertyBeta::getCoeffs(std::vector<double>& coeffs)
+{
+    coeffs.resize(m_nb_edges+1);
+    coeffs[0] = 0.0;
+    if (m_sens)
+        for (int i=1; i<m_nb_edges; i++)
+            coeffs[i] = resserre(((double)i)/((double)m_nb_edges));
+    else
+        for (int i=1; i<m_nb_edges; i++)
+            coeffs[i] = 1.0-resserre(((double)m_nb_edges-i)/((double)m_nb_edges));
+    coeffs[m_nb_edges] = 1.0;
+    m_dernierIndice = m_nb_edges;
+}
+/*----------------------------------------------------------------------------*/
 double EdgeMeshingPropertyBeta::resserre(double eta)
 {
 	double ratio = (m_beta + 1.0) / (m_beta - 1.0);
@@ -204,6 +204,20 @@ nextCoeff()
     return coeff;
 }
 /*----------------------------------------------------------------------------*/
+void EdgeMeshingPropertyBigeometric::getCoeffs(std::vector<double>& coeffs)
+{
+    coeffs.resize(m_nb_edges+1);
+    coeffs[0] = 0.0;
+    if (m_sens)
+        for (int i=1; i<m_nb_edges; i++)
+            coeffs[i] = m_coeff[i-1];
+    else
+        for (int i=1; i<m_nb_edges; i++)
+            coeffs[i] = 1.0-m_coeff[m_nb_edges-1-i];
+    coeffs[m_nb_edges] = 1.0;
+    m_dernierIndice = m_nb_edges;
+}
+/*----------------------------------------------------------------------------*/
 TkUtil::UTF8String EdgeMeshingPropertyBigeometric::
 getScriptCommand() const
 {
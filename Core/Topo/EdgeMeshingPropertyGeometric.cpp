@@ -199,6 +199,31 @@ nextCoeff()
     return m_dernierSommeCoeff;
 }
 /*----------------------------------------------------------------------------*/
+void EdgeMeshingPropertyGeometric::getCoeffs(std::vector<double>& coeffs)
+{
+    // même suite de calculs que nextCoeff, sans appel virtuel par noeud
+    coeffs.resize(m_nb_edges+1);
+    coeffs[0] = 0.0;
+    double coeff = m_dernierCoeff;
+    double somme = m_dernierSommeCoeff;
+    if (m_sens)
+        for (int i=1; i<m_nb_edges; i++){
+            coeff *= m_raison;
+            somme += coeff;
+            coeffs[i] = somme;
+        }
+    else
+        for (int i=1; i<m_nb_edges; i++){
+            coeff /= m_raison;
+            somme += coeff;
+            coeffs[i] = somme;
+        }
+    coeffs[m_nb_edges] = 1.0;
+    m_dernierCoeff = coeff;
+    m_dernierSommeCoeff = somme;
+    m_dernierIndice = m_nb_edges;
+}
+/*----------------------------------------------------------------------------*/
 TkUtil::UTF8String EdgeMeshingPropertyGeometric::
 getScriptCommand() const
 {
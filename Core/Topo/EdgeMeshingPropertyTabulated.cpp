@@ -82,6 +82,17 @@ double EdgeMeshingPropertyTabulated::nextCoeff()
     return m_dernierCoeff/m_somme;
 }
 /*----------------------------------------------------------------------------*/
+void EdgeMeshingPropertyTabulated::getCoeffs(std::vector<double>& coeffs)
+{
+	coeffs.resize(m_nb_edges+1);
+	coeffs[0] = 0.0;
+	for (int i=1; i<m_nb_edges; i++){
+		m_dernierCoeff+=m_tabulation[m_dernierIndice++];
+		coeffs[i] = m_dernierCoeff/m_somme;
+	}
+	coeffs[m_nb_edges] = 1.0;
+}
+/*----------------------------------------------------------------------------*/
 TkUtil::UTF8String EdgeMeshingPropertyTabulated::
 getScriptCommand() const
 {
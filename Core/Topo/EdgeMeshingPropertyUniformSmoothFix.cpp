@@ -66,6 +66,16 @@ nextCoeff()
     return ((double)m_dernierIndice)/((double)m_nb_edges);
 }
 /*----------------------------------------------------------------------------*/
+void EdgeMeshingPropertyUniformSmoothFix::
+getCoeffs(std::vector<double>& coeffs)
+{
+    coeffs.resize(m_nb_edges+1);
+    for (int i=0; i<m_nb_edges; i++)
+        coeffs[i] = ((double)i)/((double)m_nb_edges);
+    coeffs[m_nb_edges] = 1.0;
+    m_dernierIndice = m_nb_edges;
+}
+/*----------------------------------------------------------------------------*/
 TkUtil::UTF8String EdgeMeshingPropertyUniformSmoothFix::
 getScriptCommand() const
 {
@@ -9,6 +9,8 @@
 /*----------------------------------------------------------------------------*/
 #include "Internal/ContextIfc.h"
 #include "Topo/TopoEntity.h"
+#include "Topo/TopoManager.h"
+#include "Internal/Context.h"
 #include "Topo/CommandEditTopo.h"
 #include "Geom/GeomEntity.h"
 #include "Mesh/CommandCreateMesh.h"
@@ -102,6 +104,10 @@ void TopoEntity::setDestroyed(bool b)
 
 
     Entity::setDestroyed(b);
+
+    // les listes d'entités non détruites du manager sont à reconstruire
+    if (!getContext().isFinished())
+        getContext().getLocalTopoManager().destroyedStateChanged(this);
 }
 /*----------------------------------------------------------------------------*/
 void TopoEntity::
@@ -2019,8 +2019,8 @@ getPoints(Topo::Vertex* vtx1, Topo::Vertex* vtx2,
 		Topo::Vertex* vtx_arr = coedge->getOppositeVertex(vtx_dep);
 		uint ratio = ratios[coedge];
 
-		std::vector<Utils::Math::Point> loc_points;
-		coedge->getPoints(loc_points);
+		CoEdge::PointsView view(coedge);
+		const std::vector<Utils::Math::Point>& loc_points = view.points();
 
 		int ind_dep, inc, nb_pt;
 		if (coedge->getVertex(0) == vtx_dep){
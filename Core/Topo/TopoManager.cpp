@@ -157,6 +157,17 @@ void TopoManager::clear()
     m_edges.deleteAndClear();
     m_coedges.deleteAndClear();
     m_vertices.deleteAndClear();
+    m_blocks_index.clear();
+    m_faces_index.clear();
+    m_cofaces_index.clear();
+    m_edges_index.clear();
+    m_coedges_index.clear();
+    m_vertices_index.clear();
+    m_blocks_cache.invalidate();
+    m_cofaces_cache.invalidate();
+    m_coedges_cache.invalidate();
+    m_vertices_cache.invalidate();
+    m_premesh_cache.clear();
     m_defaultNbMeshingEdges = 10;
 }
 /*----------------------------------------------------------------------------*/
@@ -164,17 +175,8 @@ void TopoManager::getBlocks(std::vector<Block* > &blocks, bool sort) const
 {
     blocks.clear();
 
-    if (sort){
-        std::list<Topo::Block*> l_te;
-        const std::vector<Block* >& blks = m_blocks.get();
-        for (std::vector<Block* >::const_iterator iter = blks.begin();
-                iter != blks.end(); ++iter)
-            if (!(*iter)->isDestroyed())
-                l_te.push_back(*iter);
-        l_te.sort(Utils::Entity::compareEntity);
-        l_te.unique();
-        blocks.insert(blocks.end(), l_te.begin(), l_te.end());
-    }
+    if (sort)
+        m_blocks_cache.get(m_blocks, blocks);
     else {
         const std::vector<Block* >& blks = m_blocks.get();
         for (std::vector<Block* >::const_iterator iter = blks.begin();
@@ -191,6 +193,8 @@ void TopoManager::add(Block* b)
 #endif
 
     m_blocks.add(b);
+    m_blocks_index.add(b);
+    m_blocks_cache.invalidate();
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::remove(Block* b)
@@ -200,6 +204,8 @@ void TopoManager::remove(Block* b)
 #endif
 
     m_blocks.remove(b, true);
+    m_blocks_index.remove(b);
+    m_blocks_cache.invalidate();
 
 }
 /*----------------------------------------------------------------------------*/
@@ -210,6 +216,7 @@ void TopoManager::add(Face* f)
 #endif
 
     m_faces.add(f);
+    m_faces_index.add(f);
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::remove(Face* f)
@@ -219,6 +226,7 @@ void TopoManager::remove(Face* f)
 #endif
 
     m_faces.remove(f, true);
+    m_faces_index.remove(f);
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::add(CoFace* f)
@@ -228,6 +236,8 @@ void TopoManager::add(CoFace* f)
 #endif
 
     m_cofaces.add(f);
+    m_cofaces_index.add(f);
+    m_cofaces_cache.invalidate();
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::remove(CoFace* f)
@@ -237,6 +247,8 @@ void TopoManager::remove(CoFace* f)
 #endif
 
     m_cofaces.remove(f, true);
+    m_cofaces_index.remove(f);
+    m_cofaces_cache.invalidate();
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::add(Edge* ce)
@@ -246,6 +258,7 @@ void TopoManager::add(Edge* ce)
 #endif
 
     m_edges.add(ce);
+    m_edges_index.add(ce);
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::remove(Edge* ce)
@@ -255,6 +268,7 @@ void TopoManager::remove(Edge* ce)
 #endif
 
     m_edges.remove(ce, true);
+    m_edges_index.remove(ce);
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::add(CoEdge* ce)
@@ -264,6 +278,8 @@ void TopoManager::add(CoEdge* ce)
 #endif
 
     m_coedges.add(ce);
+    m_coedges_index.add(ce);
+    m_coedges_cache.invalidate();
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::remove(CoEdge* ce)
@@ -273,6 +289,8 @@ void TopoManager::remove(CoEdge* ce)
 #endif
 
     m_coedges.remove(ce, true);
+    m_coedges_index.remove(ce);
+    m_coedges_cache.invalidate();
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::add(Vertex* v)
@@ -282,6 +300,8 @@ void TopoManager::add(Vertex* v)
 #endif
 
     m_vertices.add(v);
+    m_vertices_index.add(v);
+    m_vertices_cache.invalidate();
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::remove(Vertex* v)
@@ -291,6 +311,8 @@ void TopoManager::remove(Vertex* v)
 #endif
 
     m_vertices.remove(v, true);
+    m_vertices_index.remove(v);
+    m_vertices_cache.invalidate();
 }
 /*----------------------------------------------------------------------------*/
 Block* TopoManager::getBlock (const std::string& name, const bool exceptionIfNotFound) const
@@ -316,11 +338,7 @@ Block* TopoManager::getBlock (const std::string& name, const bool exceptionIfNot
     else
         new_name = name;
 
-    const std::vector<Block* >& blocks = m_blocks.get();
-    for (std::vector<Block* >::const_iterator iter = blocks.begin();
-    		iter != blocks.end(); ++iter)
-    	if (new_name == (*iter)->getName())
-    		bloc = (*iter);
+    bloc = m_blocks_index.find(new_name);
 
 #ifdef _DEBUG_TIMER
 	timer.stop();
@@ -367,48 +385,22 @@ std::string TopoManager::getLastBlock()
 /*----------------------------------------------------------------------------*/
 int TopoManager::getNbBlocks() const
 {
-	const std::vector<Block* >& blocs = m_blocks.get();
-	int nb = 0;
-	for (uint i=0; i<blocs.size(); i++)
-		if (!blocs[i]->isDestroyed())
-			nb++;
-	return nb;
+	return m_blocks_cache.getNb(m_blocks);
 }
 /*----------------------------------------------------------------------------*/
 int TopoManager::getNbFaces() const
 {
-	const std::vector<CoFace* >& cofaces = m_cofaces.get();
-	int nb = 0;
-	for (uint i=0; i<cofaces.size(); i++)
-		if (!cofaces[i]->isDestroyed())
-			nb++;
-	return nb;
+	return m_cofaces_cache.getNb(m_cofaces);
 }
 /*----------------------------------------------------------------------------*/
 int TopoManager::getNbEdges() const
 {
-	const std::vector<CoEdge* >& coedges = m_coedges.get();
-	int nb = 0;
-	for (uint i=0; i<coedges.size(); i++)
-		if (!coedges[i]->isDestroyed())
-			nb++;
-	return nb;
+	return m_coedges_cache.getNb(m_coedges);
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::getCoFaces(std::vector<Topo::CoFace* >& faces) const
 {
-    faces.clear();
-
-    const std::vector<CoFace* >& cofaces = m_cofaces.get();
-
-    std::list<Topo::CoFace*> l_te;
-    for (std::vector<CoFace* >::const_iterator iter = cofaces.begin();
-            iter != cofaces.end(); ++iter)
-        if (!(*iter)->isDestroyed())
-            l_te.push_back(*iter);
-    l_te.sort(Utils::Entity::compareEntity);
-    l_te.unique();
-    faces.insert(faces.end(), l_te.begin(), l_te.end());
+    m_cofaces_cache.get(m_cofaces, faces);
 }
 /*----------------------------------------------------------------------------*/
 CoFace* TopoManager::getCoFace(const std::string& name, const bool exceptionIfNotFound) const
@@ -434,11 +426,7 @@ CoFace* TopoManager::getCoFace(const std::string& name, const bool exceptionIfNo
     else
         new_name = name;
 
-    const std::vector<CoFace* >& cofaces = m_cofaces.get();
-    for (std::vector<CoFace* >::const_iterator iter3 = cofaces.begin();
-    		iter3 != cofaces.end(); ++iter3)
-    	if (new_name == (*iter3)->getName())
-    		face = (*iter3);
+    face = m_cofaces_index.find(new_name);
 
     #ifdef _DEBUG_TIMER
 	timer.stop();
@@ -473,14 +461,8 @@ Face* TopoManager::getFace(const std::string& name, const bool exceptionIfNotFou
     else
         new_name = name;
 
-    if (Face::isA(new_name)){
-        const std::vector<Face* >& faces = m_faces.get();
-        for (std::vector<Face* >::const_iterator iter2 = faces.begin();
-                iter2 != faces.end() && face == 0; ++iter2){
-            if (new_name == (*iter2)->getName())
-                face = (*iter2);
-        }
-    }
+    if (Face::isA(new_name))
+        face = m_faces_index.findFirst(new_name);
     else if (exceptionIfNotFound){
 		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
         message <<"getFace impossible, entité \""<<new_name<<"\" n'a pas un nom de face";
@@ -508,18 +490,7 @@ Face* TopoManager::getFace(const std::string& name, const bool exceptionIfNotFou
 /*----------------------------------------------------------------------------*/
 void TopoManager::getCoEdges(std::vector<Topo::CoEdge* >& edges) const
 {
-    edges.clear();
-
-    const std::vector<CoEdge* >& coedges = m_coedges.get();
-
-    std::list<Topo::CoEdge*> l_te;
-    for (std::vector<CoEdge* >::const_iterator iter = coedges.begin();
-            iter != coedges.end(); ++iter)
-        if (!(*iter)->isDestroyed())
-            l_te.push_back(*iter);
-    l_te.sort(Utils::Entity::compareEntity);
-    l_te.unique();
-    edges.insert(edges.end(), l_te.begin(), l_te.end());
+    m_coedges_cache.get(m_coedges, edges);
 }
 /*----------------------------------------------------------------------------*/
 CoEdge* TopoManager::getCoEdge(const std::string& name, const bool exceptionIfNotFound) const
@@ -547,12 +518,7 @@ CoEdge* TopoManager::getCoEdge(const std::string& name, const bool exceptionIfNo
 
     //std::cout<<"TopoManager::getCoEdge("<<name<<") recherche de "<<new_name<<std::endl;
 
-    const std::vector<CoEdge* >& coedges = m_coedges.get();
-    for (std::vector<CoEdge* >::const_iterator iter4 = coedges.begin();
-    		iter4 != coedges.end(); ++iter4)
-
-    	if (new_name == (*iter4)->getName())
-    		edge = (*iter4);
+    edge = m_coedges_index.find(new_name);
 
 #ifdef _DEBUG_TIMER
 	timer.stop();
@@ -574,6 +540,58 @@ CoEdge* TopoManager::getCoEdge(const std::string& name, const bool exceptionIfNo
     return edge;
 }
 /*----------------------------------------------------------------------------*/
+void TopoManager::getCoEdges(const std::vector<std::string>& names, std::vector<CoEdge* >& edges, const bool exceptionIfNotFound) const
+{
+#ifdef _DEBUG_TIMER
+	TkUtil::Timer timer(true);
+#endif
+    edges.clear();
+    edges.reserve(names.size());
+
+    // le renommage n'est recherché qu'une fois pour toute la liste
+    const Utils::TypeDedicatedNameManager* tdnm = 0;
+    if (getLocalContext().getNameManager().isShiftingIdActivated())
+        tdnm = getLocalContext().getNameManager().getTypeDedicatedNameManager(Utils::Entity::TopoCoEdge);
+
+    for (std::vector<std::string>::const_iterator iter = names.begin();
+            iter != names.end(); ++iter){
+        CoEdge* edge = 0;
+        std::string new_name = *iter;
+        if (CoEdge::isA(*iter)){
+            if (tdnm)
+                new_name = tdnm->renameWithShiftingId(*iter);
+            edge = m_coedges_index.find(new_name);
+        }
+        else if (exceptionIfNotFound){
+            // mêmes messages que getCoEdge
+            TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+            message <<"getCoEdge impossible, entité \""<<*iter<<"\" n'a pas un nom d'arête commune";
+            throw TkUtil::Exception(message);
+        }
+        else
+            continue;
+
+        if (edge != 0 && edge->isDestroyed()){
+            TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+            message <<"getCoEdge trouve l'entité \""<<new_name<<"\", mais elle est détruite";
+            throw Utils::IsDestroyedException(message);
+        }
+
+        if (edge != 0)
+            edges.push_back(edge);
+        else if (exceptionIfNotFound){
+            TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+            message <<"getCoEdge impossible, entité \""<<new_name<<"\" n'a pas été trouvée dans le TopoManager";
+            throw TkUtil::Exception(message);
+        }
+    }
+
+#ifdef _DEBUG_TIMER
+	timer.stop();
+	_cpuDuration += timer.cpuDuration();
+#endif
+}
+/*----------------------------------------------------------------------------*/
 Edge* TopoManager::getEdge(const std::string& name, const bool exceptionIfNotFound) const
 {
 #ifdef _DEBUG_TIMER
@@ -587,14 +605,8 @@ Edge* TopoManager::getEdge(const std::string& name, const bool exceptionIfNotFou
     else
         new_name = name;
 
-    if (Edge::isA(new_name)) {
-        const std::vector<Edge* >& edges = m_edges.get();
-        for (std::vector<Edge* >::const_iterator iter4 = edges.begin();
-                iter4 != edges.end(); ++iter4)
-
-            if (new_name == (*iter4)->getName())
-                edge = (*iter4);
-    }
+    if (Edge::isA(new_name))
+        edge = m_edges_index.find(new_name);
     else if (exceptionIfNotFound){
 		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
         message <<"getEdge impossible, entité \""<<new_name<<"\" n'a pas un nom d'arête";
@@ -623,18 +635,7 @@ Edge* TopoManager::getEdge(const std::string& name, const bool exceptionIfNotFou
 /*----------------------------------------------------------------------------*/
 void TopoManager::getVertices(std::vector<Topo::Vertex* >& vertices) const
 {
-    vertices.clear();
-
-    const std::vector<Vertex* >& vtx = m_vertices.get();
-
-    std::list<Topo::Vertex*> l_te;
-    for (std::vector<Vertex* >::const_iterator iter = vtx.begin();
-            iter != vtx.end(); ++iter)
-        if (!(*iter)->isDestroyed())
-            l_te.push_back(*iter);
-    l_te.sort(Utils::Entity::compareEntity);
-    l_te.unique();
-    vertices.insert(vertices.end(), l_te.begin(), l_te.end());
+    m_vertices_cache.get(m_vertices, vertices);
 }
 /*----------------------------------------------------------------------------*/
 Vertex* TopoManager::getVertex(const std::string& name, const bool exceptionIfNotFound) const
@@ -660,12 +661,7 @@ Vertex* TopoManager::getVertex(const std::string& name, const bool exceptionIfNo
     else
     	new_name = name;
 
-    const std::vector<Vertex* >& vertices = m_vertices.get();
-    for (std::vector<Vertex* >::const_iterator iter2 = vertices.begin();
-    		iter2 != vertices.end(); ++iter2)
-
-    	if (new_name == (*iter2)->getName())
-    		vertex = (*iter2);
+    vertex = m_vertices_index.find(new_name);
 
 #ifdef _DEBUG_TIMER
 	timer.stop();
@@ -706,6 +702,26 @@ TopoEntity* TopoManager::getEntity(const std::string& name, const bool exception
 return entity;
 }
 /*----------------------------------------------------------------------------*/
+void TopoManager::destroyedStateChanged(const TopoEntity* te)
+{
+	switch (te->getType()){
+	case Utils::Entity::TopoBlock:
+		m_blocks_cache.invalidate();
+		break;
+	case Utils::Entity::TopoCoFace:
+		m_cofaces_cache.invalidate();
+		break;
+	case Utils::Entity::TopoCoEdge:
+		m_coedges_cache.invalidate();
+		break;
+	case Utils::Entity::TopoVertex:
+		m_vertices_cache.invalidate();
+		break;
+	default:
+		break;
+	}
+}
+/*----------------------------------------------------------------------------*/
 std::string TopoManager::getVertexAt(const Point& pt1) const
 {
 	// il pourrait y en avoir aucun ou plusieurs, on n'en veut qu'un
@@ -1940,15 +1956,9 @@ Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::fuse2EdgeList(std::vector<std::string>& coedge_names1, std::vector<std::string>& coedge_names2)
 {
     std::vector<Topo::CoEdge* > coedges1;
-    for (std::vector<std::string>::iterator iter = coedge_names1.begin();
-            iter != coedge_names1.end(); ++iter){
-        coedges1.push_back(getCoEdge(*iter));
-    }
+    getCoEdges(coedge_names1, coedges1);
     std::vector<Topo::CoEdge* > coedges2;
-    for (std::vector<std::string>::iterator iter = coedge_names2.begin();
-            iter != coedge_names2.end(); ++iter){
-        coedges2.push_back(getCoEdge(*iter));
-    }
+    getCoEdges(coedge_names2, coedges2);
     return fuse2EdgeList(coedges1, coedges2);
 }
 /*----------------------------------------------------------------------------*/
@@ -2484,10 +2494,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitFacesWithOgrid(std::vect
         cofaces.push_back(getCoFace(*iter));
     }
     std::vector<Topo::CoEdge* > coedges;
-    for (std::vector<std::string>::iterator iter = coedges_names.begin();
-            iter != coedges_names.end(); ++iter){
-    	coedges.push_back(getCoEdge(*iter));
-    }
+    getCoEdges(coedges_names, coedges);
     return splitFacesWithOgrid(cofaces, coedges, ratio_ogrid, nb_bras);
 }
 /*----------------------------------------------------------------------------*/
@@ -2935,9 +2942,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::snapVertices(std::vector<Topo
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::makeBlocksByRevol(std::vector<std::string>& coedges_names, const  Utils::Portion::Type& dt)
 {
     std::vector<CoEdge*> coedges;
-    for (std::vector<std::string>::iterator iter = coedges_names.begin();
-            iter != coedges_names.end(); ++iter)
-        coedges.push_back(getCoEdge(*iter));
+    getCoEdges(coedges_names, coedges);
 
     return makeBlocksByRevol(coedges, dt, 1.0);
 }
@@ -2945,9 +2950,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::makeBlocksByRevol(std::vector
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::makeBlocksByRevolWithRatioOgrid(std::vector<std::string> &coedges_names, const  Utils::Portion::Type& dt, const double& ratio_ogrid)
 {
     std::vector<CoEdge*> coedges;
-    for (std::vector<std::string>::iterator iter = coedges_names.begin();
-            iter != coedges_names.end(); ++iter)
-        coedges.push_back(getCoEdge(*iter));
+    getCoEdges(coedges_names, coedges);
 
     return makeBlocksByRevol(coedges, dt, ratio_ogrid);
 }
@@ -3087,9 +3090,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::makeBlocksByRevol(std::vector
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setMeshingProperty(CoEdgeMeshingProperty& emp, std::vector<std::string> &coedges_names)
 {
     std::vector<CoEdge*> coedges;
-    for (std::vector<std::string>::iterator iter = coedges_names.begin();
-            iter != coedges_names.end(); ++iter)
-        coedges.push_back(getCoEdge(*iter));
+    getCoEdges(coedges_names, coedges);
 
     return setMeshingProperty(emp, coedges);
 }
@@ -3180,9 +3181,7 @@ Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::reverseDirection(std::vector<std::string> &coedges_names)
 {
     std::vector<CoEdge*> coedges;
-    for (std::vector<std::string>::iterator iter = coedges_names.begin();
-            iter != coedges_names.end(); ++iter)
-        coedges.push_back(getCoEdge(*iter));
+    getCoEdges(coedges_names, coedges);
 
     return reverseDirection(coedges);
 }
@@ -3704,9 +3703,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::
 fuseEdges(std::vector<std::string> &coedges_names)
 {
     std::vector<CoEdge*> coedges;
-    for (std::vector<std::string>::iterator iter = coedges_names.begin();
-            iter != coedges_names.end(); ++iter)
-        coedges.push_back(getCoEdge(*iter));
+    getCoEdges(coedges_names, coedges);
     return fuseEdges(coedges);
 }
 /*----------------------------------------------------------------------------*/
@@ -3930,10 +3927,7 @@ projectEdgesOnCurves(std::vector<std::string> & coedges_names)
 {
 	std::vector<CoEdge*> coedges;
 
-    for (std::vector<std::string>::const_iterator iter = coedges_names.begin();
-            iter != coedges_names.end(); ++iter){
-        coedges.push_back(getCoEdge(*iter, true));
-    }
+    getCoEdges(coedges_names, coedges);
 
     return projectEdgesOnCurves(coedges);
 }
@@ -5290,9 +5284,7 @@ Internal::M3DCommandResultIfc* TopoManager::addToGroup(std::vector<std::string>&
     case(1):{
         // reconstitue le vecteur de coedges
         std::vector<CoEdge*> coedges;
-        for (std::vector<std::string>::const_iterator iter = ve.begin();
-                iter != ve.end(); ++iter)
-        	coedges.push_back(getCoEdge(*iter, true));
+        getCoEdges(ve, coedges);
 
         command = new Mesh::CommandAddRemoveGroupName(getLocalContext(), coedges, groupName, Mesh::CommandAddRemoveGroupName::add);
     }
@@ -5375,9 +5367,7 @@ Internal::M3DCommandResultIfc* TopoManager::removeFromGroup(std::vector<std::str
     case(1):{
         // reconstitue le vecteur de coedges
         std::vector<CoEdge*> coedges;
-        for (std::vector<std::string>::const_iterator iter = ve.begin();
-                iter != ve.end(); ++iter)
-        	coedges.push_back(getCoEdge(*iter, true));
+        getCoEdges(ve, coedges);
 
         command = new Mesh::CommandAddRemoveGroupName(getLocalContext(), coedges, groupName, Mesh::CommandAddRemoveGroupName::remove);
     }
@@ -5460,9 +5450,7 @@ Internal::M3DCommandResultIfc* TopoManager::setGroup(std::vector<std::string>& v
     case(1):{
         // reconstitue le vecteur de coedges
         std::vector<CoEdge*> coedges;
-        for (std::vector<std::string>::const_iterator iter = ve.begin();
-                iter != ve.end(); ++iter)
-        	coedges.push_back(getCoEdge(*iter, true));
+        getCoEdges(ve, coedges);
 
         command = new Mesh::CommandAddRemoveGroupName(getLocalContext(), coedges, groupName, Mesh::CommandAddRemoveGroupName::set);
     }
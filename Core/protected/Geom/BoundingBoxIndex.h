@@ -0,0 +1,76 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file BoundingBoxIndex.h
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef BOUNDINGBOXINDEX_H_
+#define BOUNDINGBOXINDEX_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <sys/types.h> // pour uint
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief       Index spatial (grille régulière) de boîtes englobantes
+ *
+ *  Les boîtes sont décrites comme pour Entity::getBounds :
+ *  [xmin, xmax, ymin, ymax, zmin, zmax]. Une boîte vide (min > max) n'est
+ *  jamais candidate, une boîte infinie l'est toujours.
+ *
+ *  Une fois construit, l'index n'est plus modifié et peut être interrogé
+ *  depuis plusieurs threads.
+ */
+class BoundingBoxIndex
+{
+public:
+
+    BoundingBoxIndex();
+
+    /** ajoute une boîte, son indice est le nombre de boîtes déjà ajoutées
+     *  (à faire avant build)
+     */
+    void add(const double bounds[6]);
+
+    /// construit la grille une fois toutes les boîtes ajoutées
+    void build();
+
+    /// \return le nombre de boîtes
+    uint getNbBoxes() const {return m_bounds.size()/6;}
+
+    /// indices croissants des boîtes qui intersectent bounds
+    void getCandidates(const double bounds[6], std::vector<uint>& ids) const;
+
+private:
+
+    /// vrai si la boîte i intersecte bounds
+    bool overlap(uint i, const double bounds[6]) const;
+
+    /// indice de la cellule contenant x dans la direction dir
+    uint cell(uint dir, double x) const;
+
+    /// les boîtes, 6 valeurs par boîte
+    std::vector<double> m_bounds;
+
+    /// origine, pas et nombre de cellules de la grille dans chaque direction
+    double m_min[3];
+    double m_step[3];
+    uint m_nb[3];
+
+    /// boîtes recouvrant chacune des cellules
+    std::vector<std::vector<uint> > m_cells;
+
+    /// boîtes recouvrant trop de cellules, toujours testées
+    std::vector<uint> m_large;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Geom
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* BOUNDINGBOXINDEX_H_ */
+/*----------------------------------------------------------------------------*/
@@ -171,6 +171,11 @@ protected:
      */
     virtual void postExecute(bool hasError);
 
+    /** Retire du GeomManager et détruit les entités marquées comme détruites
+     *  dans l'InfoCommand
+     */
+    void deleteDestroyedEntities();
+
 
 protected:
 
@@ -37,9 +37,10 @@ public:
      *  \param c le contexte
      *  \param e l'entité à conserver
      *  \param es les entités à retirer de e
+     *  \param tolerance tolérance de l'opération OCC (fuzzy), non utilisée si nulle
      */
     CommandCut(Internal::Context& c, GeomEntity* e,
-                std::vector<GeomEntity*>& es);
+                std::vector<GeomEntity*>& es, double tolerance = 0.0);
     /*------------------------------------------------------------------------*/
     /** \brief  Constructeur
      *
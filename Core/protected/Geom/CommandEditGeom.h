@@ -121,6 +121,18 @@ public:
      */
     virtual std::map<GeomEntity*,std::vector<GeomEntity*> >& getReplacedEntities();
 
+    /*------------------------------------------------------------------------*/
+    /// estimation de la mémoire occupée, mémentos, historique OCC et entités détruites compris
+    virtual size_t getMemoryFootprint ( ) const;
+
+    /// estimation de la mémoire que libère releaseUndoData
+    virtual size_t getReleasableMemory ( ) const;
+
+    /** libère les mémentos, l'historique OCC et les entités détruites par la
+     *  commande, qui ne peut plus être annulée (horizon d'annulation)
+     */
+    virtual bool releaseUndoData ( );
+
 
 protected:
 
@@ -35,8 +35,10 @@ public:
      *
      *  \param c le contexte
      *  \param e les entités dont ont veut récupérer la fusion
+     *  \param tolerance tolérance de l'opération OCC (fuzzy), non utilisée si nulle
      */
-    CommandFuse(Internal::Context& c,std::vector<GeomEntity*> e);
+    CommandFuse(Internal::Context& c,std::vector<GeomEntity*> e,
+                double tolerance = 0.0);
 
     /*------------------------------------------------------------------------*/
     /** \brief  Destructeur
@@ -52,10 +52,12 @@ public:
      *  \param disp propriétés d'affichage
      *  \param gprop    les propriétés associées à la courbe
      *  \param compProp les propriétés de calcul
+     *  \param registered à faux pour une courbe temporaire, non référencée
+     *         par le contexte (cf EntityFactory::newTemporaryBSpline)
      */
 #ifndef SWIG
     Curve(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
-            GeomProperty* gprop, GeomRepresentation* compProp);
+            GeomProperty* gprop, GeomRepresentation* compProp, bool registered=true);
 #endif
 
     /*------------------------------------------------------------------------*/
@@ -178,6 +180,13 @@ public:
      */
     virtual void project(Utils::Math::Point& P) const;
 
+    /*------------------------------------------------------------------------*/
+    /** \brief Projete en une fois l'ensemble des points sur la courbe.
+     *         Les points sont modifiés
+     *  \param points les points à projeter
+     */
+    virtual void project(std::vector<Utils::Math::Point>& points) const;
+
     /*------------------------------------------------------------------------*/
     /** \brief Projete le point P1 sur la courbe, le résultat est le point P2.
      */
@@ -189,6 +198,17 @@ public:
      */
     void getPoint(const double& p, Utils::Math::Point& Pt, const bool inO1=false) const ;
 
+    /*------------------------------------------------------------------------*/
+    /** \brief Donne les points en fonction d'un ensemble de paramètres sur la courbe
+     *  (évaluation groupée, la courbe OCC n'est préparée qu'une fois)
+     * \param params les paramètres curvilignes
+     * \param points les points, en retour (un par paramètre)
+     */
+#ifndef SWIG
+    void getPoints(const std::vector<double>& params,
+            std::vector<Utils::Math::Point>& points, const bool inO1=false) const ;
+#endif
+
 
     /*------------------------------------------------------------------------*/
     /** \brief Calcul la tangente à une courbe en un point
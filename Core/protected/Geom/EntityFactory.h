@@ -58,6 +58,7 @@ class MeshImplementation;
 }
 
 namespace Geom {
+class OCCGeomRepresentation;
 class CommandCreateGeom;
 class CommandNewVertexByProjection;
 class CommandNewVertexByCurveParameterization;
@@ -242,6 +243,14 @@ public:
      */
     Curve* newBSpline(const std::vector<Utils::Math::Point>& points, int degMin, int degMax);
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  Création d'une courbe B-Spline temporaire, qui n'a ni nom ni
+     *          identifiant et n'est pas référencée par le contexte.
+     *          N'utilisant pas le NameManager, elle peut être faite dans des
+     *          threads concurrents. Elle est à détruire par l'appelant.
+     */
+    Curve* newTemporaryBSpline(const std::vector<Utils::Math::Point>& points, int degMin, int degMax);
+
     /*------------------------------------------------------------------------*/
     /** \brief
      */
@@ -354,6 +363,10 @@ public:
 
 protected:
 
+    /// factorisation de la construction de la B-Spline OCC pour newBSpline et newTemporaryBSpline
+    OCCGeomRepresentation* newBSplineRepresentation(const std::vector<Utils::Math::Point>& points,
+    		int degMin, int degMax);
+
     /// factorisation de la crétion d'une courbe par projection
     Curve* newCurveByTopoDS_ShapeProjectionOnSurface(TopoDS_Shape shape,
     		Surface* surface);
@@ -64,6 +64,11 @@ public:
      */
     void prePerform();
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  tolérance de l'opération booléenne OCC (fuzzy), non utilisée
+     *          si elle est nulle (valeur par défaut)
+     */
+    void setFuzzyValue(double tol) {m_fuzzy = tol;}
 
 
 protected:
@@ -89,6 +94,9 @@ protected:
 
     /* entités passées en argument à la commande. */
     std::vector<GeomEntity*> m_entities_param;
+
+    /* tolérance de l'opération booléenne, 0 si non utilisée */
+    double m_fuzzy;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
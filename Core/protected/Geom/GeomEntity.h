@@ -73,7 +73,7 @@ protected:
      *          l'entité entrainera celle des propriétés attachées.
      */
     GeomEntity(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
-            GeomProperty* gprop, GeomRepresentation* compProp=0);
+            GeomProperty* gprop, GeomRepresentation* compProp=0, bool registered=true);
 
     /** \brief  Constructeur. Une entité délègue un certain nombre de calculs
      *          géométrique à des objets de type ComputationalProperty.
@@ -15,6 +15,7 @@
 #include "Internal/Context.h"
 /*----------------------------------------------------------------------------*/
 #include <TopoDS_Shape.hxx>
+#include <BRepAlgoAPI_Fuse.hxx>
 /*----------------------------------------------------------------------------*/
 #include <vector>
 /*----------------------------------------------------------------------------*/
@@ -62,9 +63,21 @@ public:
      */
     void prePerform();
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  tolérance de l'opération booléenne OCC (fuzzy), non utilisée
+     *          si elle est nulle (valeur par défaut)
+     */
+    void setFuzzyValue(double tol) {m_fuzzy = tol;}
+
 
 protected:
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  union OCC de toutes les entités initiales en une seule
+     *          opération (parallélisée par OCC)
+     */
+    void fuse(BRepAlgoAPI_Fuse& fuse_operator);
+
     /*------------------------------------------------------------------------*/
     /** \brief  réalisation de l'union de volumes
      */
@@ -82,6 +95,9 @@ protected:
 
     /* entités passées en argument à la commande. */
     std::vector<GeomEntity*> m_entities_param;
+
+    /* tolérance de l'opération booléenne, 0 si non utilisée */
+    double m_fuzzy;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
@@ -13,6 +13,7 @@
 #include <string>
 /*----------------------------------------------------------------------------*/
 #include "Geom/GeomManagerIfc.h"
+#include "Utils/NameIndex.h"
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -1049,12 +1050,16 @@ public:
     /** \brief Fusion Booléenne de n entités géométriques
      *
      *  \param entities les entités sur lesquelles on travaille
+     *  \param tolerance tolérance de l'opération OCC (fuzzy), non utilisée si nulle
      */
     virtual Mgx3D::Internal::M3DCommandResultIfc* fuse(
 			std::vector<std::string>& entities);
 
     virtual Mgx3D::Internal::M3DCommandResultIfc* fuse(
-			std::vector<Geom::GeomEntity*>& entities);
+			std::vector<std::string>& entities, double tolerance);
+
+    virtual Mgx3D::Internal::M3DCommandResultIfc* fuse(
+			std::vector<Geom::GeomEntity*>& entities, double tolerance = 0.0);
 
     /*------------------------------------------------------------------------*/
     /** \brief Intersection Booléenne de n entités géométriques
@@ -1099,18 +1104,27 @@ public:
      *
      *  \param tokeep l(es) entité(s) que l'on conserve
      *  \param tocut  les entités que l'on retire de tokeep
+     *  \param tolerance tolérance de l'opération OCC (fuzzy), non utilisée si nulle
      */
     virtual Mgx3D::Internal::M3DCommandResultIfc* cut(
             std::string tokeep,std::vector<std::string>& tocut);
 
     virtual Mgx3D::Internal::M3DCommandResultIfc* cut(
-            Geom::GeomEntity* tokeep, std::vector<Geom::GeomEntity*>& tocut);
+            std::string tokeep,std::vector<std::string>& tocut, double tolerance);
+
+    virtual Mgx3D::Internal::M3DCommandResultIfc* cut(
+            Geom::GeomEntity* tokeep, std::vector<Geom::GeomEntity*>& tocut,
+            double tolerance = 0.0);
 
     virtual Mgx3D::Internal::M3DCommandResultIfc* cut(
             std::vector<std::string>& tokeep,std::vector<std::string>& tocut);
 
     virtual Mgx3D::Internal::M3DCommandResultIfc* cut(
-            std::vector<Geom::GeomEntity*>& tokeep, std::vector<Geom::GeomEntity*>& tocut);
+            std::vector<std::string>& tokeep,std::vector<std::string>& tocut, double tolerance);
+
+    virtual Mgx3D::Internal::M3DCommandResultIfc* cut(
+            std::vector<Geom::GeomEntity*>& tokeep, std::vector<Geom::GeomEntity*>& tocut,
+            double tolerance = 0.0);
 
 
     /*------------------------------------------------------------------------*/
@@ -1198,13 +1212,13 @@ public:
     virtual int getNbVertices() const;
 
     /** Ajoute un volume au gestionnaire */
-    virtual void add (Volume* v) {m_volumes.push_back(v);}
+    virtual void add (Volume* v);
     /** Ajoute une surface au gestionnaire */
-    virtual void add (Surface* s) {m_surfaces.push_back(s);}
+    virtual void add (Surface* s);
     /** Ajoute une courbe au gestionnaire */
-    virtual void add (Curve* c) {m_curves.push_back(c);}
+    virtual void add (Curve* c);
     /** Ajoute un sommet au gestionnaire */
-    virtual void add (Vertex* v) {m_vertices.push_back(v);}
+    virtual void add (Vertex* v);
     /** Ajoute une entité au gestionnaire */
     virtual void addEntity (GeomEntity* ge);
 
@@ -1281,6 +1295,12 @@ private:
     std::vector<Curve*>   m_curves;
     /** sommets gérés par le manager */
     std::vector<Vertex*>  m_vertices;
+
+    /** index sur les noms des entités précédentes */
+    Utils::NameIndex<Volume>  m_volumes_index;
+    Utils::NameIndex<Surface> m_surfaces_index;
+    Utils::NameIndex<Curve>   m_curves_index;
+    Utils::NameIndex<Vertex>  m_vertices_index;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
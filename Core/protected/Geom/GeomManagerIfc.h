@@ -782,9 +782,13 @@ public:
     /** \brief Fusion Booléenne de n entités géométriques
      *
      *  \param entities les entités sur lesquelles on travaille
+     *  \param tolerance tolérance de l'opération OCC (fuzzy), non utilisée si nulle
      */
     virtual Mgx3D::Internal::M3DCommandResultIfc*
         fuse(std::vector<std::string>& entities);
+
+    virtual Mgx3D::Internal::M3DCommandResultIfc*
+        fuse(std::vector<std::string>& entities, double tolerance);
 	SET_SWIG_COMPLETABLE_METHOD(fuse)
 
     /*------------------------------------------------------------------------*/
@@ -824,13 +828,20 @@ public:
      *
      *  \param tokeep l(es) entité(s) que l'on conserve
      *  \param tocut  les entités que l'on retire de tokeep
+     *  \param tolerance tolérance de l'opération OCC (fuzzy), non utilisée si nulle
      */
     virtual Mgx3D::Internal::M3DCommandResultIfc*
         cut(std::string tokeep,std::vector<std::string>& tocut);
 
+    virtual Mgx3D::Internal::M3DCommandResultIfc*
+        cut(std::string tokeep,std::vector<std::string>& tocut, double tolerance);
+
     virtual Mgx3D::Internal::M3DCommandResultIfc*
         cut(std::vector<std::string>& tokeep,std::vector<std::string>& tocut);
 
+    virtual Mgx3D::Internal::M3DCommandResultIfc*
+        cut(std::vector<std::string>& tokeep,std::vector<std::string>& tocut, double tolerance);
+
     /*------------------------------------------------------------------------*/
     /** \brief Import d'un fichier au format CATIA
      *
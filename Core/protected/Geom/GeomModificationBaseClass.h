@@ -13,6 +13,7 @@
 #include "Utils/Vector.h"
 #include "Geom/GeomEntity.h"
 #include "Internal/Context.h"
+#include "Geom/ShapeHistory.h"
 /*----------------------------------------------------------------------------*/
 #include <vector>
 #include <list>
@@ -24,6 +25,8 @@
 #include <TopoDS_Solid.hxx>
 
 #include <BRepBuilderAPI_MakeShape.hxx>
+#include <NCollection_DataMap.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -34,6 +37,7 @@ class Surface;
 class Curve;
 class Vertex;
 class CommandGeomCopy;
+class BoundingBoxIndex;
 /*----------------------------------------------------------------------------*/
 /**
  * \class GeomModificationBaseClass
@@ -105,6 +109,16 @@ public:
      */
     std::map<GeomEntity*,std::vector<GeomEntity*> >& getReplacedEntities();
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  retourne l'historique OCC de la dernière opération transmise
+     *          à createGeomEntities (vide si l'opération n'en a pas fourni)
+     */
+    const ShapeHistory& getShapeHistory() const {return m_history;}
+
+    /** \brief  oublie l'historique OCC (libère les shapes qu'il retient)
+     */
+    void clearShapeHistory() {m_history.clear();}
+
     /*------------------------------------------------------------------------*/
     /** \brief   Destructeur
      */
@@ -186,6 +200,19 @@ protected:
                             const bool replaceVolumes = false,
 							const bool deleteAloneVertices = true);
 
+    /*------------------------------------------------------------------------*/
+        /** \brief  Idem pour le résultat de l'opération OCC op, dont
+         *          l'historique (Modified, Generated, IsDeleted) est
+         *          enregistré dans m_history. Il permet de retrouver
+         *          directement les entités conservées, nouvelles et celles
+         *          remplaçant les entités supprimées. La comparaison
+         *          géométrique n'est faite que pour les shapes que
+         *          l'historique ne permet pas de retrouver.
+         */
+    void createGeomEntities(BRepBuilderAPI_MakeShape& op,
+                            const bool replaceVolumes = false,
+							const bool deleteAloneVertices = true);
+
 
     /// remplissage de m_removed et identification des entités créées à tord
     void clean(const bool deleteAloneVertices);
@@ -202,6 +229,23 @@ protected:
      *          et placées dans m_newEntities.
      */
 
+    /// association des shapes OCC (par identité) aux entités
+    typedef NCollection_DataMap<TopoDS_Shape, GeomEntity*, TopTools_ShapeMapHasher> ShapeEntityMap;
+
+    /** recherche de sh par identité parmi les shapes des entités de référence
+     *  (refs) et des entités créées (news).
+     *  \return vrai si sh a été trouvée (entité dans found, isRef est vrai
+     *  pour une entité de référence), ou si l'historique indique qu'elle est
+     *  issue de l'opération (found est alors nul) ; dans ce dernier cas, seule
+     *  la comparaison géométrique avec les entités de référence qui ne sont pas
+     *  des arguments de l'opération (entités adjacentes) reste nécessaire
+     */
+    bool findShape(const TopoDS_Shape& sh, const ShapeEntityMap& refs,
+            const ShapeEntityMap& news, GeomEntity*& found, bool& isRef) const;
+
+    /// \return vrai si l'une des shapes de e est une sous-shape d'un argument de l'opération
+    bool isOperationInput(GeomEntity* e) const;
+
     void createNewVertices(const TopoDS_Shape& ref_entity,
             std::vector<TopoDS_Shape>& occ_entities,
             std::vector<Vertex*>& m3d_entities,
@@ -238,9 +282,15 @@ protected:
 
      void buildReplacedList(const bool replaceVolumes);
      void computeReplacedVertex (Vertex*  e);
-     void computeReplacedCurve  (Curve*   e);
-     void computeReplacedSurface(Surface* e);
-     void computeReplacedVolume(Volume* e);
+     /** recherche des entités remplaçant les courbes (resp. surfaces)
+      *  supprimées, faite en parallèle et limitée aux entités conservées et
+      *  nouvelles dont la boîte englobante peut correspondre
+      */
+     void computeReplacedCurves  (const std::vector<Curve*>& removed);
+     void computeReplacedSurfaces(const std::vector<Surface*>& removed);
+     /// recherche des entités remplaçant un volume, parmi les candidats des index
+     void computeReplacedVolume(Volume* e,
+             const BoundingBoxIndex& indexToKeep, const BoundingBoxIndex& indexNews);
      void rebuildAdjacencyEntities(const TopoDS_Shape& shape);
      void rebuildAdjacencyLinks();
 
@@ -304,6 +354,10 @@ protected:
      * aussi supprimée (et donc apparait dans m_removedEntities)*/
     std::map<GeomEntity*,std::vector<GeomEntity*> > m_replacedEntities;
 
+    /* historique de l'opération OCC, vide si on passe uniquement par la
+     * comparaison géométrique */
+    ShapeHistory m_history;
+
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
@@ -133,6 +133,32 @@ public:
     virtual void project(const Utils::Math::Point& P1, Utils::Math::Point& P2,
                          const Curve* C) =0 ;
 
+    /*------------------------------------------------------------------------*/
+    /** \brief Projete en une fois l'ensemble des points sur la surface.
+     *         Par défaut, les points sont projetés un par un.
+     *
+     *  \param points les points à projeter qui seront modifiés
+     *  \param S la surface sur laquelle on projete
+     */
+    virtual void project(std::vector<Utils::Math::Point>& points, const Surface* S)
+    {
+        for (uint i=0; i<points.size(); i++)
+            project(points[i], S);
+    }
+
+    /*------------------------------------------------------------------------*/
+    /** \brief Projete en une fois l'ensemble des points sur la courbe.
+     *         Par défaut, les points sont projetés un par un.
+     *
+     *  \param points les points à projeter qui seront modifiés
+     *  \param C la courbe sur laquelle on projete
+     */
+    virtual void project(std::vector<Utils::Math::Point>& points, const Curve* C)
+    {
+        for (uint i=0; i<points.size(); i++)
+            project(points[i], C);
+    }
+
     /*------------------------------------------------------------------------*/
     /** \brief Calcul la normale à une surface en un point
      *
@@ -159,6 +185,19 @@ public:
     virtual void getPoint(const double& p, Utils::Math::Point& Pt,
             const bool in01=false) =0 ;
 
+    /*------------------------------------------------------------------------*/
+    /** \brief Donne les points pour un ensemble de paramètres sur la courbe
+     * \param params les paramètres curvilignes
+     * \param points les résultats (un par paramètre)
+     */
+    virtual void getPoints(const std::vector<double>& params,
+            std::vector<Utils::Math::Point>& points, const bool in01=false)
+    {
+        points.resize(params.size());
+        for (uint i=0; i<params.size(); i++)
+            getPoint(params[i], points[i], in01);
+    }
+
     /*------------------------------------------------------------------------*/
     /** \brief Donne le point a l'intersection avec le plan
      * \param plan_cut le plan
@@ -12,6 +12,11 @@
 #include "Geom/GeomRepresentation.h"
 #include "Internal/Context.h"
 /*----------------------------------------------------------------------------*/
+#include <TkUtil/Mutex.h>
+/*----------------------------------------------------------------------------*/
+#include <map>
+#include <thread>
+/*----------------------------------------------------------------------------*/
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Edge.hxx>
@@ -25,6 +30,8 @@ namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Geom {
 /*----------------------------------------------------------------------------*/
+class OCCProjector;
+/*----------------------------------------------------------------------------*/
 /**
  * \class OCCGeomRepresentation
  *
@@ -234,6 +241,22 @@ public:
      */
     void project(const Utils::Math::Point& P1, Utils::Math::Point& P2, const Curve* C);
 
+    /*------------------------------------------------------------------------*/
+    /** \brief Projete en une fois l'ensemble des points sur la surface
+     *
+     *  \param points les points à projeter qui seront modifiés
+     *  \param S la surface sur laquelle on projette
+     */
+    void project(std::vector<Utils::Math::Point>& points, const Surface* S);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief Projete en une fois l'ensemble des points sur la courbe
+     *
+     *  \param points les points à projeter qui seront modifiés
+     *  \param C la courbe sur laquelle on projette
+     */
+    void project(std::vector<Utils::Math::Point>& points, const Curve* C);
+
     /*------------------------------------------------------------------------*/
     /** \brief Calcul la normale à une surface en un point
      *
@@ -259,6 +282,13 @@ public:
     void getPoint(const double& p, Utils::Math::Point& Pt,
                     const bool inO1 = false);
 
+    /*------------------------------------------------------------------------*/
+    /** \brief Donne les points pour un ensemble de paramètres sur la courbe,
+     *  l'adaptateur OCC n'est construit qu'une fois
+     */
+    void getPoints(const std::vector<double>& params,
+            std::vector<Utils::Math::Point>& points, const bool inO1 = false);
+
     /*------------------------------------------------------------------------*/
     /** \brief Donne le point a l'intersection avec le plan
      * \param plan_cut le plan
@@ -389,7 +419,7 @@ public:
     /*------------------------------------------------------------------------*/
     /** \brief  Accès à la shape OCC sous-jacente via un pointeur.
      */
-    void setShape(const TopoDS_Shape& sh)  {m_shape=sh;}
+    void setShape(const TopoDS_Shape& sh)  {m_shape=sh; resetProjector();}
 
 
     /*------------------------------------------------------------------------*/
@@ -399,6 +429,17 @@ public:
      */
     static double buildIncrementalBRepMesh(TopoDS_Shape& shape, const double& deflection);
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  Crée en une seule passe parallèle le maillage OCC des faces
+     *          qui n'en ont pas encore ou dont la flèche est plus grossière,
+     *          la flèche étant relative à la taille de chacune des faces.
+     *
+     *          La triangulation est conservée par la TShape, les faces
+     *          inchangées par une opération et déjà maillées assez finement
+     *          ne sont donc pas remaillées.
+     */
+    static void buildIncrementalBRepMesh(const TopTools_IndexedMapOfShape& faces, const double& deflection);
+
     static double getParameterOnTopoDSEdge(const TopoDS_Edge& edge,
             const Utils::Math::Point& Pt, double& p);
 
@@ -453,6 +494,24 @@ protected:
 
     void projectPointOn( Utils::Math::Point& P);
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  Projection avec le projecteur du thread courant, ou avec
+     *          BRepExtrema si projector est nul
+     */
+    void projectPointOn(Utils::Math::Point& P, OCCProjector* projector);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Retourne le projecteur sur m_shape propre au thread appelant,
+     *          le crée si nécessaire. Retourne 0 si la shape n'est ni une
+     *          face ni une arête.
+     */
+    OCCProjector* getProjector();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Détruit les projecteurs, à faire dès que m_shape change
+     */
+    void resetProjector();
+
 
 
 protected:
@@ -467,6 +526,18 @@ protected:
 
     /// le label pour ajouter les construction suivantes
     static TDF_Label m_rootLabel;
+
+    /// projecteurs persistants sur m_shape, un par thread car ils ne sont pas
+    /// réentrants, construits à la première projection faite dans ce thread.
+    /// Les threads éphémères de Utils::executeEnParallele conservent les leurs
+    /// (repérés par m_projectorsId) jusqu'à leur terminaison.
+    std::map<std::thread::id, OCCProjector*> m_projectors;
+
+    /// identifiant des projecteurs courants, changé par resetProjector
+    unsigned long m_projectorsId;
+
+    /// protège m_projectors (mais pas les projections elles-mêmes)
+    TkUtil::Mutex m_projectorMutex;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
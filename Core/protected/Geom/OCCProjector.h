@@ -0,0 +1,155 @@
+/*----------------------------------------------------------------------------*/
+/** \file OCCProjector.h
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef MGX3D_GEOM_OCCPROJECTOR_H_
+#define MGX3D_GEOM_OCCPROJECTOR_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <TopoDS_Shape.hxx>
+#include <TopoDS_Face.hxx>
+#include <Geom_Surface.hxx>
+#include <Geom_Curve.hxx>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <GeomAPI_ProjectPointOnCurve.hxx>
+#include <BRepClass_FaceClassifier.hxx>
+#include <ShapeAnalysis_Surface.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+/*----------------------------------------------------------------------------*/
+/**
+ * \class OCCProjector
+ *
+ * \brief Moteur de projection d'un point sur une face ou une arête OCC,
+ *        initialisé une seule fois pour une shape donnée.
+ *
+ *  Le résultat est le même que celui de BRepExtrema_DistShapeShape entre
+ *  un sommet et la shape : on retient le plus proche parmi les extrema
+ *  intérieurs à la face (filtrés par le classifieur), ceux sur les arêtes du
+ *  bord et les sommets. Les projecteurs OCC (grilles d'échantillonnage
+ *  comprises) sont construits une fois pour toutes. Le (u,v) de la requête
+ *  précédente sert de point de départ à une recherche locale dont le
+ *  résultat, un point de la face, ne sert que de borne : il écarte les
+ *  extrema plus éloignés (sans les classifier) et les arêtes du bord dont
+ *  la boite est trop loin. La recherche exhaustive est toujours faite.
+ *
+ *  Une instance n'est pas réentrante, elle ne doit être utilisée que par
+ *  un thread à la fois.
+ */
+class OCCProjector {
+
+public:
+
+    /// type de l'entité support du point projeté
+    enum SupportType { IsVertex, IsOnEdge, IsInFace };
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Constructeur
+     *
+     *  \param shape une face ou une arête OCC
+     */
+    OCCProjector(const TopoDS_Shape& shape);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Destructeur
+     */
+    ~OCCProjector();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Retourne vrai si le type de shape est pris en charge (face ou
+     *          arête), faux s'il faut se rabattre sur BRepExtrema
+     */
+    static bool isHandled(const TopoDS_Shape& shape);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Projette le point P sur la shape
+     *
+     *  \param P le point à projeter
+     *  \param res le point projeté
+     *  \return le type du support de res
+     */
+    SupportType project(const gp_Pnt& P, gp_Pnt& res);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Paramètres (u,v) sur la surface du dernier projeté, valides
+     *          seulement si project a retourné IsInFace
+     */
+    void getLastParameters(double& u, double& v) const
+    {u = m_hint.X(); v = m_hint.Y();}
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Accès à la surface OCC (nulle pour une arête)
+     */
+    const Handle(Geom_Surface)& getSurface() const {return m_surface;}
+
+private:
+
+    /// projecteur sur une arête (de la shape ou du bord de la face)
+    struct EdgeProjector {
+        Handle(Geom_Curve) curve;
+        GeomAPI_ProjectPointOnCurve projector;
+        /// boite englobante de l'arête
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+    };
+
+    void initFace();
+    void initEdge(const TopoDS_Shape& edge);
+
+    /** Recherche le meilleur extremum intérieur à la face, retourne
+     *  le carré de la distance (RealLast si aucun). bound est le carré de
+     *  la distance au point de la face issu de la recherche locale
+     *  (RealLast si aucun), un majorant de la distance à la face */
+    double projectInFace(const gp_Pnt& P, gp_Pnt& res, double& u, double& v,
+            double& bound);
+
+    /** Retourne le carré de la distance du point à la boite de l'arête */
+    static double squareDistanceToBox(const gp_Pnt& P, const EdgeProjector& ep);
+
+    /// constructeur par copie et opérateur = interdits
+    OCCProjector(const OCCProjector&);
+    OCCProjector& operator = (const OCCProjector&);
+
+    /// la shape sur laquelle on projette
+    TopoDS_Shape m_shape;
+
+    /// la face et sa surface (cas d'une face)
+    TopoDS_Face m_face;
+    Handle(Geom_Surface) m_surface;
+
+    /// projecteur sur la surface, initialisé sur les bornes de la face
+    GeomAPI_ProjectPointOnSurf m_surfaceProjector;
+
+    /// classifieur pour ne garder que les extrema dans la face
+    BRepClass_FaceClassifier m_classifier;
+
+    /// pour la recherche locale depuis le (u,v) précédent
+    Handle(ShapeAnalysis_Surface) m_analysis;
+
+    /// tolérances de projection et de classification
+    double m_tolerance;
+    double m_faceTolerance;
+
+    /// (u,v) du dernier projeté intérieur à la face
+    gp_Pnt2d m_hint;
+    bool m_hasHint;
+
+    /// les arêtes (celle de la shape ou celles du bord de la face)
+    std::vector<EdgeProjector*> m_edges;
+
+    /// les sommets de la shape
+    std::vector<gp_Pnt> m_vertices;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Geom
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* MGX3D_GEOM_OCCPROJECTOR_H_ */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,104 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ShapeHistory.h
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef SHAPEHISTORY_H_
+#define SHAPEHISTORY_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <sys/types.h> // pour uint
+/*----------------------------------------------------------------------------*/
+#include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <BRepBuilderAPI_MakeShape.hxx>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+/*----------------------------------------------------------------------------*/
+/**
+ * \class ShapeHistory
+ * \brief Historique (Modified, Generated, IsDeleted) d'une opération OCC
+ *        pour toutes les sous-shapes (sommets, arêtes, faces et volumes)
+ *        de ses arguments
+ *
+ *  L'historique est recopié lors de l'enregistrement, il reste donc
+ *  utilisable une fois l'opération OCC détruite. Les requêtes se font par
+ *  identité des shapes (IsSame) en temps constant.
+ */
+class ShapeHistory{
+
+public:
+
+    ShapeHistory();
+
+    /// vide l'historique
+    void clear();
+
+    /** enregistre l'historique de op pour toutes les sous-shapes des
+     *  arguments inputs (remplace l'historique précédent)
+     */
+    void record(BRepBuilderAPI_MakeShape& op,
+            const std::vector<TopoDS_Shape>& inputs);
+
+    /// \return vrai si aucun historique n'est enregistré
+    bool isEmpty() const {return m_inputs.IsEmpty();}
+
+    /// \return vrai si sh est une sous-shape d'un argument
+    bool isInput(const TopoDS_Shape& sh) const {return m_inputs.Contains(sh);}
+
+    /// \return vrai si l'historique de sh (sous-shape d'un argument) est connu
+    bool isKnown(const TopoDS_Shape& sh) const;
+
+    /// \return vrai si sh a été supprimée par l'opération
+    bool isDeleted(const TopoDS_Shape& sh) const;
+
+    /// \return les shapes issues de la modification de sh (vide si sh n'est pas modifiée)
+    const TopTools_ListOfShape& modified(const TopoDS_Shape& sh) const;
+
+    /// \return les shapes générées à partir de sh
+    const TopTools_ListOfShape& generated(const TopoDS_Shape& sh) const;
+
+    /** \return vrai si sh est issue de l'opération (modifiée ou générée à
+     *  partir d'un argument) sans être elle-même une sous-shape d'un argument
+     */
+    bool isImage(const TopoDS_Shape& sh) const;
+
+    /** \return une estimation de la mémoire occupée (en octets), hors
+     *  géométrie OCC partagée avec les entités
+     */
+    size_t getMemorySize() const;
+
+private:
+
+    /// sous-shapes des arguments, l'indice (à partir de 1) repère l'historique
+    TopTools_IndexedMapOfShape m_inputs;
+
+    /// vrai si l'historique de la sous-shape a pu être obtenu
+    std::vector<bool> m_known;
+
+    /// vrai si la sous-shape a été supprimée
+    std::vector<bool> m_deleted;
+
+    /// shapes modifiées et générées pour chacune des sous-shapes
+    std::vector<TopTools_ListOfShape> m_modified;
+    std::vector<TopTools_ListOfShape> m_generated;
+
+    /// ensemble des shapes modifiées ou générées
+    TopTools_MapOfShape m_images;
+
+    /// liste vide retournée pour une shape inconnue
+    TopTools_ListOfShape m_empty;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Geom
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* SHAPEHISTORY_H_ */
+/*----------------------------------------------------------------------------*/
@@ -164,6 +164,13 @@ public:
      */
     virtual void project(Utils::Math::Point& P) const;
 
+    /*------------------------------------------------------------------------*/
+    /** \brief Projete en une fois l'ensemble des points sur la surface.
+     *         Les points sont modifiés
+     *  \param points les points à projeter
+     */
+    virtual void project(std::vector<Utils::Math::Point>& points) const;
+
     /*------------------------------------------------------------------------*/
     /** \brief Calcul la normale à une surface en un point
      *
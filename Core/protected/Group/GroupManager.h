@@ -468,8 +468,12 @@ public:
      *
      *  \param nom       nom du groupe avec lequel on effectue la perturbation
      *  \param py_obj    l'objet python auquel il est fait appel pour modifier le maillage
+     *  \param batch     si vrai, l'objet python est appelé une seule fois avec les 3 tableaux
+     *                   (memoryview de doubles) des coordonnées de tous les noeuds à modifier,
+     *                   et retourne les 3 tableaux des nouvelles coordonnées (ou None s'il a
+     *                   modifié les tableaux reçus). Sinon il est appelé pour chaque noeud.
      */
-    virtual void addCartesianPerturbation(const std::string& nom, PyObject* py_obj);
+    virtual void addCartesianPerturbation(const std::string& nom, PyObject* py_obj, bool batch = false);
 
     /*------------------------------------------------------------------------*/
     /** Ajoute une modification du maillage pour un groupe (2D ou 3D)
@@ -479,8 +483,12 @@ public:
      *
      *  \param nom       nom du groupe avec lequel on effectue la perturbation
      *  \param py_obj    l'objet python auquel il est fait appel pour modifier le maillage
+     *  \param batch     si vrai, l'objet python est appelé une seule fois avec les 3 tableaux
+     *                   (memoryview de doubles) des coordonnées de tous les noeuds à modifier,
+     *                   et retourne les 3 tableaux des nouvelles coordonnées (ou None s'il a
+     *                   modifié les tableaux reçus). Sinon il est appelé pour chaque noeud.
      */
-    virtual void addPolarPerturbation(const std::string& nom, PyObject* py_obj);
+    virtual void addPolarPerturbation(const std::string& nom, PyObject* py_obj, bool batch = false);
 
     /*------------------------------------------------------------------------*/
     /** Ajoute un lissage surfacique du maillage pour un groupe 2D
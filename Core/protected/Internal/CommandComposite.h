@@ -58,6 +58,15 @@ public:
      */
     void internalRedo();
 
+    /*------------------------------------------------------------------------*/
+    /// estimation de la mémoire occupée, commandes de la composition comprises
+    virtual size_t getMemoryFootprint ( ) const;
+
+    /// estimation de la mémoire libérable par les commandes de la composition
+    virtual size_t getReleasableMemory ( ) const;
+
+    /// libère les données d'annulation des commandes de la composition
+    virtual bool releaseUndoData ( );
 
 private:
     /// la liste des commandes de la composition
@@ -91,6 +91,12 @@ public:
     virtual void postExecute(bool hasError)
     {}
 
+    /*------------------------------------------------------------------------*/
+    /** Estimation de la mémoire occupée par la commande : la commande, son
+     *  InfoCommand et l'état du NameManager conservé
+     */
+    virtual size_t getMemoryFootprint ( ) const;
+
 protected:
 
     /*------------------------------------------------------------------------*/
@@ -103,8 +109,20 @@ protected:
     /// Opérateur de copie (interdit)
     CommandInternal& operator = (const CommandInternal&);
 
+    /*------------------------------------------------------------------------*/
+    /** Libère l'InfoCommand et l'état du NameManager conservés, pour une
+     *  commande effectuée passée sous l'horizon d'annulation. Sa destruction
+     *  ne touche alors plus ni aux entités ni au NameManager.
+     */
+    void releaseInternalUndoData();
+
     /*------------------------------------------------------------------------*/
 private:
+    /** informe les entités de maillage référencées dans InfoCommand que leur
+     *  maillage a pu changer (représentations conservées à recalculer)
+     */
+    void meshEntitiesModified();
+
     /** le contexte */
     Internal::Context& m_context;
 
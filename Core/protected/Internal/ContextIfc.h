@@ -26,6 +26,7 @@
 #include <PythonUtil/PythonSession.h>
 #include <TkUtil/LogDispatcher.h>
 #include <PrefsCore/BoolNamedValue.h>
+#include <PrefsCore/UnsignedLongNamedValue.h>
 #include <TkUtil/PaintAttributes.h>
 
 /*----------------------------------------------------------------------------*/
@@ -309,6 +310,19 @@ public:
 	 */
 	Preferences::BoolNamedValue			memorizeEdgePreMesh;
 
+	/*------------------------------------------------------------------------*/
+	/** \brief	Budget mémoire (en Mo) des commandes conservées pour être
+	 *			annulées, 0 pour illimité. Au delà, les commandes les plus
+	 *			anciennes ne peuvent plus être annulées.
+	 */
+	Preferences::UnsignedLongNamedValue	undoMemoryBudget;
+
+	/** \brief	Modifie le budget mémoire (en Mo, 0 pour illimité) des
+	 *			commandes conservées pour être annulées et l'applique au
+	 *			gestionnaire d'annulation.
+	 */
+	virtual void setUndoMemoryBudget (unsigned long megaBytes);
+
     /*------------------------------------------------------------------------*/
     /** \brief  Accesseur sur le gestionnaire de sélection.
 	 * \exception	Une exception est levée en l'absence de gestionnaire associé.
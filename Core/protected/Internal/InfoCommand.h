@@ -177,6 +177,9 @@ public:
     /// fonction de nettoyage
     void clear();
 
+    /// estimation, en octets, de la mémoire occupée par les informations stockées
+    size_t getMemoryFootprint() const;
+
     /** Fonction de de mise à jour des connectivités entre entités lors de
      * lors de leur première destruction
      *
@@ -37,10 +37,16 @@ class InternalEntity : public Utils::Entity {
 protected:
     /*------------------------------------------------------------------------*/
     /** \brief  Constructeur.
+     *
+     *  \param registered à faux pour une entité temporaire qui ne reçoit pas
+     *         d'identifiant unique et n'est pas référencée par le contexte.
+     *         Sa construction ne touche pas au NameManager, elle peut donc se
+     *         faire dans des threads concurrents.
      */
 	InternalEntity(Internal::Context& ctx,
 			Utils::Property* prop,
-			Utils::DisplayProperties* disp);
+			Utils::DisplayProperties* disp,
+			bool registered = true);
 
 public:
     /*------------------------------------------------------------------------*/
@@ -70,6 +76,9 @@ private:
 
     /// Un accès au context
     Internal::Context&      m_context;
+
+    /// Vrai si l'entité est référencée par le contexte
+    bool m_registered;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Internal
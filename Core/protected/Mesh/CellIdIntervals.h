@@ -0,0 +1,96 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file CellIdIntervals.h
+ *
+ *  \date 16/10/2026
+ *
+ *  Stockage compressé par intervalles d'identifiants gmds
+ *  */
+/*----------------------------------------------------------------------------*/
+#ifndef MESH_CELLIDINTERVALS_H_
+#define MESH_CELLIDINTERVALS_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <utility>
+#include <GMDS/Utils/CommonTypes.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/** \class CellIdIntervals
+ *  \brief Ensemble d'identifiants de cellules gmds stocké sous forme
+ *  d'intervalles [premier, dernier+1[
+ *
+ *  Les identifiants créés par une commande se suivent presque toujours, un
+ *  nouvel identifiant qui suit le dernier ajouté étend le dernier intervalle.
+ *  L'ordre d'ajout est conservé lors du parcours.
+ */
+/*----------------------------------------------------------------------------*/
+class CellIdIntervals{
+
+public:
+    /// un intervalle [first, second[
+    typedef std::pair<gmds::TCellID, gmds::TCellID> Interval;
+
+    CellIdIntervals()
+    : m_size(0)
+    {}
+
+    /*----------------------------------------------------------------------------*/
+    /// ajoute un identifiant
+    void add(gmds::TCellID id)
+    {
+        if (!m_intervals.empty() && m_intervals.back().second == id)
+            m_intervals.back().second++;
+        else
+            m_intervals.push_back(Interval(id, id+1));
+        m_size++;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// ajoute les identifiants d'un vecteur à partir de l'indice first
+    void add(const std::vector<gmds::TCellID>& ids, size_t first = 0)
+    {
+        for (size_t i = first; i<ids.size(); ++i)
+            add(ids[i]);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// \return le nombre d'identifiants
+    size_t size() const {return m_size;}
+
+    /// \return vrai s'il n'y a aucun identifiant
+    bool empty() const {return m_size == 0;}
+
+    /// \return les intervalles dans l'ordre d'ajout
+    const std::vector<Interval>& intervals() const {return m_intervals;}
+
+    /// \return la mémoire occupée (en octets)
+    size_t getMemorySize() const
+    {
+        return sizeof(CellIdIntervals) + m_intervals.capacity()*sizeof(Interval);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// vide l'ensemble et libère la mémoire
+    void clear()
+    {
+        std::vector<Interval>().swap(m_intervals);
+        m_size = 0;
+    }
+
+private:
+    /// les intervalles
+    std::vector<Interval> m_intervals;
+
+    /// nombre total d'identifiants
+    size_t m_size;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* MESH_CELLIDINTERVALS_H_ */
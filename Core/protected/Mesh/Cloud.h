@@ -14,6 +14,7 @@
 #include <TkUtil/UTF8String.h>
 #include "Utils/Container.h"
 #include "Topo/MeshCloudTopoProperty.h"
+#include "Mesh/MeshGroupView.h"
 
 namespace gmds {
 class Node;
@@ -150,6 +151,13 @@ public:
     ///  Fournit l'accès aux noeuds GMDS
     void getGMDSNodes(std::vector<gmds::Node >& ANodes) const;
 
+#ifndef SWIG
+    /** Fournit une vue sur les noeuds GMDS, sans copie des identifiants
+     *  des arêtes. Un noeud partagé par plusieurs arêtes y est répété.
+     */
+    void getGMDSNodesView(MeshGroupView<gmds::Node>& view) const;
+#endif
+
     /*------------------------------------------------------------------------*/
     /** Duplique le MeshCloudTopoProperty pour en conserver une copie
      *  (non modifiée par les accesseurs divers)
@@ -17,6 +17,7 @@
 #include "Mesh/Line.h"
 #include "Mesh/Surface.h"
 #include "Mesh/Volume.h"
+#include "Mesh/CellIdIntervals.h"
 /*----------------------------------------------------------------------------*/
 namespace gmds {
 class Node;
@@ -62,17 +63,31 @@ public:
      */
     virtual void postExecute(bool hasError);
     /*------------------------------------------------------------------------*/
-    /// Accesseur sur le vecteur des noeuds créés par la commande
-    std::vector<gmds::TCellID>& createdNodes() {return m_created_nodes;}
+    /// Accesseur sur les intervalles des noeuds créés par la commande
+    const CellIdIntervals& createdNodes() const {return m_created_nodes;}
 
-    /// Accesseur sur le vecteur des bras créés par la commande
-    std::vector<gmds::TCellID>& createdEdges() {return m_created_edges;}
+    /// Accesseur sur les intervalles des bras créés par la commande
+    const CellIdIntervals& createdEdges() const {return m_created_edges;}
 
-    /// Accesseur sur le vecteur des polygones créés par la commande
-    std::vector<gmds::TCellID>& createdFaces() {return m_created_faces;}
+    /// Accesseur sur les intervalles des polygones créés par la commande
+    const CellIdIntervals& createdFaces() const {return m_created_faces;}
 
-    /// Accesseur sur le vecteur des polyedres créés par la commande
-    std::vector<gmds::TCellID>& createdRegions() {return m_created_regions;}
+    /// Accesseur sur les intervalles des polyedres créés par la commande
+    const CellIdIntervals& createdRegions() const {return m_created_regions;}
+
+    /// Mémoire occupée (en octets) par le stockage des entités de maillage créées
+    size_t getCreatedMeshMemorySize() const;
+
+    /// estimation de la mémoire occupée, propriétés sauvegardées et entités créées comprises
+    virtual size_t getMemoryFootprint ( ) const;
+
+    /// estimation de la mémoire que libère releaseUndoData
+    virtual size_t getReleasableMemory ( ) const;
+
+    /** libère les propriétés sauvegardées et les intervalles des entités
+     *  créées, la commande ne peut plus être annulée (horizon d'annulation)
+     */
+    virtual bool releaseUndoData ( );
 
     /*------------------------------------------------------------------------*/
     /// Accesseur sur les noms des nuages créés par la commande
@@ -97,6 +112,12 @@ public:
     /// Ajoute au vecteur le polyèdre créé par la commande, suivant la strategie
     void addCreatedRegion(gmds::TCellID id);
 
+    /// Ajoute au vecteur les noeuds créés (à partir de l'indice first), suivant la strategie
+    void addCreatedNodes(const std::vector<gmds::TCellID>& ids, size_t first = 0);
+
+    /// Ajoute au vecteur les polyèdres créés (à partir de l'indice first), suivant la strategie
+    void addCreatedRegions(const std::vector<gmds::TCellID>& ids, size_t first = 0);
+
     /*------------------------------------------------------------------------*/
     /// Ajoute un nuage à la structure, ce nuage est déjà créé dans le maillage
     void addNewCloud(const std::string& name);
@@ -293,16 +314,16 @@ protected:
 
 
     /// stockage des noeuds créés par la commande
-    std::vector<gmds::TCellID> m_created_nodes;
+    CellIdIntervals m_created_nodes;
 
     /// stockage des bras créés par la commande
-    std::vector<gmds::TCellID> m_created_edges;
+    CellIdIntervals m_created_edges;
 
     /// stockage des polygones créés par la commande
-    std::vector<gmds::TCellID> m_created_faces;
+    CellIdIntervals m_created_faces;
 
     /// stockage des polyèdres créés par la commande
-    std::vector<gmds::TCellID> m_created_regions;
+    CellIdIntervals m_created_regions;
 
 
     /// stockage des nuages créés par la commande
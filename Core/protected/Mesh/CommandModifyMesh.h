@@ -11,11 +11,20 @@
 #define MGX3D_MESH_COMMANDMODIFYMESH_H_
 /*----------------------------------------------------------------------------*/
 #include "Internal/CommandInternal.h"
+#include <GMDS/Utils/CommonTypes.h>
+#include <GMDS/IG/Node.h>
+#include <vector>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
+class MeshEntity;
 /*----------------------------------------------------------------------------*/
+/** \brief  Lissage des blocs maillés.
+ *
+ *  Seuls les noeuds déplacés sont conservés (positions avant et après
+ *  lissage) pour permettre l'annulation et le rejeu.
+ */
 class CommandModifyMesh: public Internal::CommandInternal {
 
 public:
@@ -48,6 +57,23 @@ public:
 protected:
 
 private:
+	/// récupère les coordonnées des noeuds (x, y, z à la suite)
+	void _getCoords(const std::vector<gmds::TCellID>& nodes, std::vector<double>& coords);
+
+	/// replace les noeuds déplacés aux coordonnées données
+	void _setCoords(const std::vector<double>& coords);
+
+	/// les noeuds GMDS d'un groupe de mailles (volume, surface, ligne ou nuage)
+	void _getGMDSNodes(Mesh::MeshEntity* me, std::vector<gmds::Node>& nodes);
+
+	/// les noeuds déplacés par le lissage
+	std::vector<gmds::TCellID> m_nodes;
+
+	/// les coordonnées de ces noeuds avant lissage
+	std::vector<double> m_coords_before;
+
+	/// les coordonnées de ces noeuds après lissage
+	std::vector<double> m_coords_after;
 
 //	/*------------------------------------------------------------------------*/
 //	/** \brief  constructeur par recopie
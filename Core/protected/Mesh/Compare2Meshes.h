@@ -11,6 +11,7 @@
 #define COMPARE2MESHES_H_
 /*----------------------------------------------------------------------------*/
 #include "GMDS/IG/IGMesh.h"
+#include <TkUtil/UTF8String.h>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -23,23 +24,95 @@ namespace Mesh {
 /** \class Compare2Meshes
  *  \brief Compare deux maillages
  *
+ *  Les noeuds sont appariés spatialement (grille de hachage sur le deuxième
+ *  maillage) à la tolérance près, indépendamment de leur numérotation.
+ *  Les bras, polygones et polyèdres sont appariés par leurs noeuds (une fois
+ *  ceux-ci appariés), pris dans le même ordre à une permutation circulaire
+ *  près (et à l'orientation près pour les bras et les polygones).
+ *  Les appariements sont bijectifs, les mailles ou noeuds doublés ne sont
+ *  appariés qu'une fois.
+ *
  *  Sont comparés:
  *    les quantités (nombres de noeuds, de bras, ... de groupes ...)
- *    les coordonées des noeuds
- *    les id des polygones et polyèdres (on ne fait rien pour les bras, car pas construit par Magix3D)
- *    les groupes (existance), leur contenu (id des noeuds, polygones et polyèdres) (rien pour les lignes)
+ *    les positions des noeuds (écart à la tolérance près)
+ *    les bras, polygones et polyèdres
+ *    les groupes (existance), leur contenu (noeuds, bras, polygones et polyèdres)
+ *
+ *  Le résultat est disponible sous forme d'un rapport (getReport), les
+ *  appariements sont faits en parallèle.
  */
 /*----------------------------------------------------------------------------*/
 class Compare2Meshes {
 public:
-    /// constructeur avec 2 maillages chargés
-    Compare2Meshes(Internal::Context* context, gmds::IGMesh& mesh1, gmds::IGMesh& mesh2);
+    /// résultat de la comparaison d'un ensemble de cellules (maillage complet ou groupe)
+    struct CellsReport {
+        CellsReport(const std::string& nom, int d)
+        : name(nom), dim(d), nbCells1(0), nbCells2(0), nbUnmatched1(0), nbUnmatched2(0)
+        , maxDeviation(0.0), meanDeviation(0.0)
+        {}
+
+        /// vrai si les nombres de cellules sont égaux et toutes les cellules appariées
+        bool isOk() const {return nbCells1 == nbCells2 && nbUnmatched1 == 0 && nbUnmatched2 == 0;}
+
+        /// nom du groupe, vide pour le maillage complet
+        std::string name;
+        /// dimension des cellules (0 pour les noeuds ... 3 pour les polyèdres)
+        int dim;
+        /// nombre de cellules dans chacun des maillages
+        long nbCells1;
+        long nbCells2;
+        /// nombre de cellules non appariées dans chacun des maillages
+        long nbUnmatched1;
+        long nbUnmatched2;
+        /// id des premières cellules non appariées (limité à getMaxNbIds())
+        std::vector<gmds::TCellID> unmatched1;
+        std::vector<gmds::TCellID> unmatched2;
+        /** écarts maximum et moyen entre les cellules appariées, l'écart d'une
+         *  maille est le plus grand écart entre ses noeuds
+         */
+        double maxDeviation;
+        double meanDeviation;
+    };
+
+    /// résultat de la comparaison
+    struct Report {
+        Report() : tolerance(0.0) {}
+
+        /// tolérance utilisée pour l'appariement des noeuds
+        double tolerance;
+        /// comparaison des noeuds, polygones et polyèdres des maillages complets
+        std::vector<CellsReport> meshes;
+        /// comparaison des groupes présents dans les 2 maillages
+        std::vector<CellsReport> groups;
+        /// noms des groupes présents dans un seul des maillages
+        std::vector<std::string> groupsOnly1;
+        std::vector<std::string> groupsOnly2;
+
+        /// vrai si les maillages sont identiques à la tolérance près
+        bool isOk() const;
+
+        /// représentation textuelle
+        TkUtil::UTF8String toString() const;
+    };
+
+    /** constructeur avec 2 maillages chargés, et la tolérance pour
+     *  l'appariement des noeuds (une tolérance nulle prend la racine de
+     *  MgxNumeric::mgxDoubleEpsilon)
+     */
+    Compare2Meshes(Internal::Context* context, gmds::IGMesh& mesh1, gmds::IGMesh& mesh2,
+            double tolerance = 0.0);
 
     ~Compare2Meshes() {}
 
     /// effectue la comparaison et retourne true si tout est ok
     bool perform();
 
+    /// le rapport de la dernière comparaison
+    const Report& getReport() const {return m_report;}
+
+    /// nombre maximum d'id de cellules non appariées conservés par ensemble
+    static uint getMaxNbIds() {return 100;}
+
     /** retourne le contexte */
     Internal::Context& getContext() {return *(m_context);}
 
@@ -51,11 +124,41 @@ private:
             std::vector<std::string> &common,
             std::vector<std::string> &add1, std::vector<std::string> &add2);
 
+    /// appariement spatial des noeuds
+    void matchNodes();
+
+    /** appariement des cellules d'id ids1 du premier maillage avec les cellules
+     *  d'id ids2 du deuxième, map1to2 et deviation sont indicés par les id du
+     *  premier maillage
+     */
+    template<typename TCell>
+    void matchCells(const std::vector<gmds::TCellID>& ids1, const std::vector<gmds::TCellID>& ids2,
+            std::vector<gmds::TCellID>& map1to2, std::vector<double>& deviation,
+            CellsReport& report);
+
+    /** comparaison d'un groupe de cellules déjà appariées, map1to2 et
+     *  deviation sont indicés par les id du premier maillage
+     */
+    template<typename TCell>
+    void compareGroup(const std::vector<TCell>& cells1, const std::vector<TCell>& cells2,
+            const std::vector<gmds::TCellID>& map1to2, const std::vector<double>& deviation,
+            CellsReport& report);
+
     /** le contexte */
     Internal::Context* m_context;
 
     gmds::IGMesh& m_gmds_mesh1;
     gmds::IGMesh& m_gmds_mesh2;
+
+    /// tolérance pour l'appariement des noeuds
+    double m_tolerance;
+
+    /// noeud apparié du deuxième maillage et écart, indicés par les id du premier
+    std::vector<gmds::TCellID> m_node_1to2;
+    std::vector<double> m_node_deviation;
+
+    /// le rapport
+    Report m_report;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
@@ -14,6 +14,7 @@
 #include <TkUtil/UTF8String.h>
 #include "Utils/Container.h"
 #include "Topo/MeshLineTopoProperty.h"
+#include "Mesh/MeshGroupView.h"
 
 namespace gmds {
 class Node;
@@ -133,6 +134,11 @@ public:
     ///  Fournit l'accès aux bras GMDS
     void getGMDSEdges(std::vector<gmds::Edge >& AEdges) const;
 
+#ifndef SWIG
+    ///  Fournit une vue sur les bras GMDS, sans copie des identifiants
+    void getGMDSEdgesView(MeshGroupView<gmds::Edge>& view) const;
+#endif
+
     ///  Fournit l'accès aux noeuds GMDS
     void getGMDSNodes(std::vector<gmds::Node >& ANodes) const;
 
@@ -0,0 +1,85 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MeshComparisonReport.h
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef MGX3D_MESH_MESHCOMPARISONREPORT_H_
+#define MGX3D_MESH_MESHCOMPARISONREPORT_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <string>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/** \class MeshComparisonReport
+ *  \brief Résultat de la comparaison du maillage actuel (1) avec un maillage
+ *  sur disque (2), cf MeshManagerIfc::compareWithMesh
+ *
+ *  Les quantités sont données par dimension des cellules du maillage
+ *  complet (0 pour les noeuds, 1 pour les bras, 2 pour les polygones et 3
+ *  pour les polyèdres).
+ */
+class MeshComparisonReport{
+
+public:
+    MeshComparisonReport();
+
+#ifndef SWIG
+    /// vrai si les maillages sont identiques à la tolérance près
+    bool ok;
+    /// tolérance utilisée pour l'appariement des noeuds
+    double tolerance;
+    /// nombres de cellules dans chacun des maillages, par dimension
+    long nb_cells1[4];
+    long nb_cells2[4];
+    /// nombres de cellules non appariées dans chacun des maillages, par dimension
+    long nb_unmatched1[4];
+    long nb_unmatched2[4];
+    /// écarts maximum et moyen entre les cellules appariées, par dimension
+    double max_deviation[4];
+    double mean_deviation[4];
+    /// noms des groupes présents dans les 2 maillages dont le contenu diffère
+    std::vector<std::string> different_groups;
+    /// noms des groupes présents dans un seul des maillages
+    std::vector<std::string> groups_only1;
+    std::vector<std::string> groups_only2;
+    /// description complète de la comparaison
+    std::string description;
+#endif
+
+    /// vrai si les maillages sont identiques à la tolérance près
+    bool isOk() const;
+    /// tolérance utilisée pour l'appariement des noeuds
+    double getTolerance() const;
+    /// nombre de cellules de dimension dim dans le maillage actuel
+    long getNbCells1(int dim) const;
+    /// nombre de cellules de dimension dim dans le maillage sur disque
+    long getNbCells2(int dim) const;
+    /// nombre de cellules de dimension dim du maillage actuel non appariées
+    long getNbUnmatched1(int dim) const;
+    /// nombre de cellules de dimension dim du maillage sur disque non appariées
+    long getNbUnmatched2(int dim) const;
+    /// écart maximum entre les cellules de dimension dim appariées
+    double getMaxDeviation(int dim) const;
+    /// écart moyen entre les cellules de dimension dim appariées
+    double getMeanDeviation(int dim) const;
+    /// noms des groupes présents dans les 2 maillages dont le contenu diffère
+    std::vector<std::string> getDifferentGroups() const;
+    /// noms des groupes présents uniquement dans le maillage actuel
+    std::vector<std::string> getGroupsOnly1() const;
+    /// noms des groupes présents uniquement dans le maillage sur disque
+    std::vector<std::string> getGroupsOnly2() const;
+    /// description complète de la comparaison
+    std::string toString() const;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* MGX3D_MESH_MESHCOMPARISONREPORT_H_ */
+/*----------------------------------------------------------------------------*/
@@ -15,6 +15,11 @@
 #include "Utils/DisplayProperties.h"
 #include "Mesh/MeshManagerIfc.h"
 /*----------------------------------------------------------------------------*/
+#ifndef SWIG
+#include <TkUtil/Mutex.h>
+#include <memory>
+#endif
+/*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 /*!
@@ -27,6 +32,7 @@ namespace Mgx3D {
 namespace Mesh {
 
 class CommandCreateMesh;
+class MeshLevelOfDetail;
 
 /*----------------------------------------------------------------------------*/
 /**
@@ -141,6 +147,14 @@ public:
     Mesh::MeshManagerIfc& getMeshManager() const;
 #endif
 
+    /*------------------------------------------------------------------------*/
+#ifndef SWIG
+    /** Signale que le maillage de l'entité a changé : la boite englobante et
+     *  la représentation dégradée seront recalculées
+     */
+    virtual void meshModified();
+#endif
+
 private:
     /// Un accès au maillage via le manager
     Mesh::MeshManagerIfc* m_mesh_manager;
@@ -157,6 +171,18 @@ protected:
 
     /// Pour savoir si m_bounds est à jour
     mutable bool m_bounds_to_be_calculate;
+
+#ifndef SWIG
+    /** Représentation dégradée conservée, vide si elle est à recalculer.
+     *  Partagée avec les appelants de getLevelOfDetail pour qu'une
+     *  invalidation depuis le thread de la commande ne la détruise pas
+     *  pendant son utilisation
+     */
+    mutable std::shared_ptr<const MeshLevelOfDetail> m_lod;
+
+    /// Protège la création, la lecture et l'invalidation de m_lod
+    mutable TkUtil::Mutex m_lodMutex;
+#endif
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
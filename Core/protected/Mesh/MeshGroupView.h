@@ -0,0 +1,113 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MeshGroupView.h
+ *
+ *  \date 16/10/2026
+ *
+ *  Vue sur les cellules gmds d'un groupe de maillage
+ *  */
+/*----------------------------------------------------------------------------*/
+#ifndef MESH_MESHGROUPVIEW_H_
+#define MESH_MESHGROUPVIEW_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <GMDS/Utils/CommonTypes.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/** \class MeshGroupView
+ *  \brief Vue (sans copie) sur les cellules gmds d'un groupe de maillage
+ *  (Cloud, Line, Surface, Volume et leurs dérivés)
+ *
+ *  La vue référence les vecteurs d'identifiants portés par les entités
+ *  topologiques (nodes(), edges(), faces(), regions()) ou les vecteurs de
+ *  cellules des sous-groupes (SubSurface, SubVolume). Seuls les identifiants
+ *  isolés (noeuds des sommets) sont copiés.
+ *
+ *  La vue n'est valide que tant que le maillage n'est pas modifié.
+ *  Un même identifiant peut apparaitre plusieurs fois (noeuds partagés entre
+ *  arêtes d'un nuage par exemple).
+ */
+/*----------------------------------------------------------------------------*/
+template<typename TCell>
+class MeshGroupView{
+
+public:
+    MeshGroupView()
+    : m_size(0)
+    {}
+
+    /*----------------------------------------------------------------------------*/
+    /// référence un vecteur d'identifiants
+    void add(const std::vector<gmds::TCellID>& ids)
+    {
+        if (ids.empty())
+            return;
+        m_id_chunks.push_back(&ids);
+        m_size += ids.size();
+    }
+
+    /// référence un vecteur de cellules
+    void add(const std::vector<TCell>& cells)
+    {
+        if (cells.empty())
+            return;
+        m_cell_chunks.push_back(&cells);
+        m_size += cells.size();
+    }
+
+    /// ajoute un identifiant isolé
+    void add(gmds::TCellID id)
+    {
+        m_ids.push_back(id);
+        m_size++;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// \return le nombre d'identifiants (doublons compris)
+    size_t size() const {return m_size;}
+
+    /// \return vrai s'il n'y a aucun identifiant
+    bool empty() const {return m_size == 0;}
+
+    /*----------------------------------------------------------------------------*/
+    /// appelle f(id) pour chacun des identifiants de la vue
+    template<typename F>
+    void forEach(F f) const
+    {
+        for (size_t i=0; i<m_ids.size(); ++i)
+            f(m_ids[i]);
+        for (size_t i=0; i<m_id_chunks.size(); ++i){
+            const std::vector<gmds::TCellID>& ids = *m_id_chunks[i];
+            for (size_t j=0; j<ids.size(); ++j)
+                f(ids[j]);
+        }
+        for (size_t i=0; i<m_cell_chunks.size(); ++i){
+            const std::vector<TCell>& cells = *m_cell_chunks[i];
+            for (size_t j=0; j<cells.size(); ++j)
+                f(cells[j].getID());
+        }
+    }
+
+private:
+    /// les identifiants isolés
+    std::vector<gmds::TCellID> m_ids;
+
+    /// les vecteurs d'identifiants référencés
+    std::vector<const std::vector<gmds::TCellID>* > m_id_chunks;
+
+    /// les vecteurs de cellules référencés
+    std::vector<const std::vector<TCell>* > m_cell_chunks;
+
+    /// nombre total d'identifiants
+    size_t m_size;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* MESH_MESHGROUPVIEW_H_ */
@@ -12,6 +12,7 @@
 /*----------------------------------------------------------------------------*/
 #include "Mesh/MeshItf.h"
 #include "Utils/Point.h"
+#include <unordered_map>
 
 /*----------------------------------------------------------------------------*/
 // GMSH
@@ -135,7 +136,10 @@ public:
     /// Lecture d'un maillage au format vtk (vtk vtp vtu)
     virtual void readVTK(std::string nom, uint id);
 
-    /// Sauvegarde d'un maillage au format vtk (vtk vtp vtu)
+    /** Sauvegarde d'un maillage au format vtk (vtk vtp vtu)
+     *  Le format legacy (extension vtk) est écrit directement, sans créer
+     *  de groupes gmds, les autres formats le sont par gmds
+     */
     virtual void writeVTK(std::string nom);
 
     /// Lecture d'un maillage au format lima (mli) (dans le gmds mesh d'id)
@@ -185,6 +189,9 @@ public:
     /// Réinitialise la structure GMDS pour le maillage en sortie, avec nouvelle dimension
     virtual void updateMeshDim();
 
+    /// nombre de noeuds internes à partir duquel le remplissage transfini d'un bloc est fait en parallèle
+    static const uint NB_NOEUDS_MIN_TRANSFINI_PARALLELE;
+
 private:
     /** Création des nuages et y ajoute les noeuds de l'arête */
     void _addNodesInClouds(Mesh::CommandCreateMesh* command, Topo::CoEdge* ed);
@@ -204,6 +211,12 @@ private:
 //    /** Ajoute les polygones à une surface */
 //    void _addFacesInSurface(std::vector<gmds::Face*>& elem, gmds::Mesh<TMask>::surface& sf);
 
+    /** Test de l'orientation des hexaèdres d'un bloc sur un échantillon de
+     *  mailles, à partir des points calculés (thread-safe). Le résultat est
+     *  conservé dans le BlockMeshingData pour _addRegionsInVolumes */
+    void _testRegionsOrientation(Topo::Block* bl,
+            uint nbBrasI, uint nbBrasJ, uint nbBrasK);
+
     /** Création des polyèdres, des volumes de maillage et y ajoute les polyèdres */
     void _addRegionsInVolumes(Mesh::CommandCreateMesh* command, Topo::Block* bl,
             uint nbBrasI, uint nbBrasJ, uint nbBrasK);
@@ -363,16 +376,48 @@ private:
     /// met à val une des coordonnées
     void _setToVal(Utils::Math::Point* uij, uint indCoord, uint nbNoeudsI, uint nbNoeudsJ, double val);
 
+    /** Remplissage transfini des points internes d'un bloc pour les tranches kDeb <= kk < kFin,
+     *  à partir des coordonnées sur le cube unité calculées sur les faces du bloc.
+     *  Les tranches sont indépendantes, cette méthode peut être appelée depuis plusieurs threads.
+     */
+    void _discretiseTransfinieTranche(uint nbBrasI, uint nbBrasJ, uint nbBrasK,
+            Utils::Math::Point* l_points,
+            Utils::Math::Point* ui0k, Utils::Math::Point* uiYk,
+            Utils::Math::Point* uij0, Utils::Math::Point* uijZ,
+            Utils::Math::Point* u0jk, Utils::Math::Point* uXjk,
+            uint kDeb, uint kFin);
+
     /// ajoute un noeud gmds au sommet gmsh en parcourant les sommets d'une Edge, retourne l'indice du sommet dans l'arête
     uint _addGMDSVertex2GVertex(Topo::Edge* edge,
             GVertex* gv1,
             std::map<gmds::TCellID, MVertex*>& cor_gmdsNode_gmshVertex,
             std::map<MVertex*, gmds::TCellID>& cor_gmshVertex_gmdsNode);
 
-    /** recherche des indices (idxI, idxJ, idxK) d'un noeud parmi ceux d'un bloc structuré
+    /// écriture directe au format VTK legacy (ascii)
+    void _writeLegacyVTK(std::string nom);
+
+    /// écriture au format VTK (vtu, vtp) par gmds, via les groupes gmds
+    void _writeGMDSVTK(std::string nom);
+
+    /** écriture dans le fichier CGNS ouvert d'une zone non structurée pour les blocs
+     *  non structurés ou dégénérés, avec une section par groupe de volumes et une
+     *  section et une condition aux limites par groupe de surfaces (familles)
+    */
+    void _writeCGNSUnstructuredZone(int index_file, int index_base,
+    		std::vector<Topo::Block*>& blocs);
+
+    /** construit la table (noeud -> indice i + j*ni + k*ni*nj) des noeuds au bord d'un bloc structuré
     */
-    void _getIndexNode(gmds::TCellID node, std::vector<gmds::TCellID>& nodes,
+    static void _buildIndexNodeMap(const std::vector<gmds::TCellID>& nodes,
     		uint ni, uint nj, uint nk,
+    		std::unordered_map<gmds::TCellID, uint>& indices);
+
+    /** recherche des indices (idxI, idxJ, idxK) d'un noeud au bord d'un bloc structuré
+     *  à partir de la table construite par _buildIndexNodeMap
+    */
+    void _getIndexNode(gmds::TCellID node,
+    		const std::unordered_map<gmds::TCellID, uint>& indices,
+    		uint ni, uint nj,
     		uint &idxI, uint &idxJ, uint &idxK);
 
     /** recherche indice dans tableau de 2 valeurs identiques et non marquée dans filtre
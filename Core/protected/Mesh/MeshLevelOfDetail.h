@@ -0,0 +1,140 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MeshLevelOfDetail.h
+ *
+ *  \date 16/10/2026
+ *
+ *  Représentation dégradée (niveau de détail) des volumes et surfaces de maillage
+ *  */
+/*----------------------------------------------------------------------------*/
+#ifndef MESH_MESHLEVELOFDETAIL_H_
+#define MESH_MESHLEVELOFDETAIL_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/Point.h"
+/*----------------------------------------------------------------------------*/
+#include <GMDS/Utils/CommonTypes.h>
+#include <vector>
+#include <unordered_map>
+#include <sys/types.h> // pour uint
+/*----------------------------------------------------------------------------*/
+namespace gmds {
+class IGMesh;
+}
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+class Block;
+class CoFace;
+}
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/** \class MeshLevelOfDetail
+ *  \brief Représentation dégradée d'un ensemble de blocs ou de faces communes
+ *
+ *  Pour les blocs structurés (non dégénérés), on ne garde qu'un noeud sur
+ *  ratio dans chacune des directions (le dernier noeud est toujours conservé),
+ *  ce qui donne des hexaèdres. Les autres blocs sont représentés par leur
+ *  peau (les polygones des faces communes vues une seule fois parmi ces blocs).
+ *
+ *  Pour les faces communes, les structurées sont échantillonnées de la même
+ *  manière (quadrangles), les autres sont conservées entièrement.
+ *
+ *  Les mailles sont décrites comme pour MeshDisplayRepresentation::setCells :
+ *  pour chaque maille le nombre de noeuds, puis les indices des points.
+ *  Les hexaèdres sont dans l'ordre de VTK.
+ *
+ *  Cette représentation est conservée par les entités de maillage
+ *  (cf MeshEntity::meshModified) et n'est reconstruite que si le maillage
+ *  ou le ratio changent.
+ */
+/*----------------------------------------------------------------------------*/
+class MeshLevelOfDetail{
+
+public:
+    /** constructeur pour un facteur de dégradation ratio, skin est vrai pour
+     *  la représentation de la peau d'un volume
+     */
+    MeshLevelOfDetail(uint ratio, bool skin);
+
+    /// ajoute la représentation dégradée des blocs maillés
+    void addBlocks(const std::vector<Topo::Block*>& blocs, gmds::IGMesh& gmdsMesh);
+
+    /// ajoute la représentation dégradée des faces communes maillées
+    void addCoFaces(const std::vector<Topo::CoFace*>& cofaces, gmds::IGMesh& gmdsMesh);
+
+    /// \return le facteur de dégradation
+    uint getRatio() const {return m_ratio;}
+
+    /// \return vrai pour la représentation de la peau d'un volume
+    bool isSkin() const {return m_skin;}
+
+    /// \return les points
+    const std::vector<Utils::Math::Point>& getPoints() const {return m_points;}
+
+    /// \return l'id du noeud gmds de chacun des points
+    const std::vector<gmds::TCellID>& getNodeIds() const {return m_node_ids;}
+
+    /// \return les polyèdres (hexaèdres)
+    const std::vector<size_t>& getPolyedres() const {return m_polyedres;}
+
+    /// \return les polygones
+    const std::vector<size_t>& getPolygones() const {return m_polygones;}
+
+    /// \return le nombre de polyèdres
+    size_t getNbPolyedres() const {return m_nb_polyedres;}
+
+    /// \return le nombre de polygones
+    size_t getNbPolygones() const {return m_nb_polygones;}
+
+private:
+    /// constructeur par copie et opérateur = interdits
+    MeshLevelOfDetail(const MeshLevelOfDetail&);
+    MeshLevelOfDetail& operator = (const MeshLevelOfDetail&);
+
+    /** indices conservés parmi les nbEdges+1 noeuds d'une direction,
+     *  un sur m_ratio et le dernier
+     */
+    void sampledIndices(uint nbEdges, std::vector<uint>& indices) const;
+
+    /// \return l'indice du point pour le noeud gmds, ajouté si nécessaire
+    size_t addPoint(gmds::TCellID id, gmds::IGMesh& gmdsMesh);
+
+    /// ajoute les hexaèdres échantillonnés d'un bloc structuré
+    void addStructuredBlock(Topo::Block* bloc, gmds::IGMesh& gmdsMesh);
+
+    /** ajoute les quadrangles échantillonnés d'une face commune structurée
+     *  \return faux si la face commune ne peut être échantillonnée
+     */
+    bool addStructuredCoFace(Topo::CoFace* coface, gmds::IGMesh& gmdsMesh);
+
+    /// ajoute tous les polygones d'une face commune
+    void addPolygons(Topo::CoFace* coface, gmds::IGMesh& gmdsMesh);
+
+    /// facteur de dégradation
+    uint m_ratio;
+
+    /// vrai pour la peau d'un volume
+    bool m_skin;
+
+    /// les points et les noeuds gmds correspondants
+    std::vector<Utils::Math::Point> m_points;
+    std::vector<gmds::TCellID> m_node_ids;
+
+    /// indice du point pour un noeud gmds
+    std::unordered_map<gmds::TCellID, size_t> m_node2point;
+
+    /// les mailles
+    std::vector<size_t> m_polyedres;
+    std::vector<size_t> m_polygones;
+    size_t m_nb_polyedres;
+    size_t m_nb_polygones;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* MESH_MESHLEVELOFDETAIL_H_ */
@@ -12,6 +12,7 @@
 /*----------------------------------------------------------------------------*/
 #include "Mesh/MeshManagerIfc.h"
 #include "Utils/Container.h"
+#include "Utils/NameIndex.h"
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -91,8 +92,8 @@ public:
     virtual void smooth();
 
     /*------------------------------------------------------------------------*/
-    /// Compare le maillage actuel avec un maillage sur disque, return true si ok
-    virtual bool compareWithMesh(std::string nom);
+    /// Compare le maillage actuel avec un maillage sur disque, à la tolérance près
+    virtual MeshComparisonReport compareWithMesh(std::string nom, double tolerance = 0.0);
 
     /*------------------------------------------------------------------------*/
     /// Accesseur sur la strategie
@@ -252,6 +253,12 @@ private:
     // stockage des groupes de polyèdres
     Utils::Container<Volume> m_volumes;
 
+    // index sur les noms des groupes précédents
+    Utils::NameIndex<Cloud> m_clouds_index;
+    Utils::NameIndex<Line> m_lines_index;
+    Utils::NameIndex<Surface> m_surfaces_index;
+    Utils::NameIndex<Volume> m_volumes_index;
+
 
     /// Stategie pour la conservation des créations et modifications de maillage
     strategy m_strategy;
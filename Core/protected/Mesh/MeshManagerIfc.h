@@ -12,6 +12,7 @@
 /*----------------------------------------------------------------------------*/
 #include "Internal/CommandCreator.h"
 #include "Internal/M3DCommandResultIfc.h"
+#include "Mesh/MeshComparisonReport.h"
 #include "Utils/SwigCompletion.h"
 #include <string>
 #include <vector>
@@ -113,8 +114,15 @@ public:
     virtual void smooth();
 
     /*------------------------------------------------------------------------*/
-    /// Compare le maillage actuel avec un maillage sur disque, return true si ok
-    virtual bool compareWithMesh(std::string nom);
+    /** Compare le maillage actuel avec un maillage sur disque
+     *
+     *  \param nom le fichier du maillage (format lima)
+     *  \param tolerance la tolérance pour l'appariement des noeuds (une
+     *  tolérance nulle prend la racine de MgxNumeric::mgxDoubleEpsilon)
+     *  \return le résultat de la comparaison (isOk() si les maillages sont
+     *  identiques)
+     */
+    virtual MeshComparisonReport compareWithMesh(std::string nom, double tolerance = 0.0);
 	SET_SWIG_COMPLETABLE_METHOD(compareWithMesh)
 
     /*------------------------------------------------------------------------*/
@@ -21,6 +21,8 @@ namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
+class NodeFilter;
+/*----------------------------------------------------------------------------*/
 /**
  * \class MeshModificationByPythonFunction
  *
@@ -33,7 +35,11 @@ public:
 	/// type de coordonnées, polaires ou cartésiennes
 	enum eTypeCoord {cartesian,polar};
 
-	MeshModificationByPythonFunction(PyObject* py_obj, eTypeCoord typeCoord);
+	/** Constructeur
+	 *  \param batch si vrai, la fonction est appelée une seule fois avec les
+	 *  tableaux des coordonnées de tous les noeuds, sinon pour chaque noeud
+	 */
+	MeshModificationByPythonFunction(PyObject* py_obj, eTypeCoord typeCoord, bool batch = false);
 
 	virtual ~MeshModificationByPythonFunction();
 
@@ -41,7 +47,7 @@ public:
 	 *  Ne sont modifiés que ceux dont la valeur est différente de la marque dans le filtre
 	 */
 	virtual void applyModification(std::vector<gmds::Node >& gmdsNodes,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
+			const NodeFilter& filtre_nodes,
 			uint maskFixed);
 
 	/** \brief  Fournit une représentation textuelle de l'entité.
@@ -51,7 +57,7 @@ public:
 
 protected:
 	MeshModificationByPythonFunction(const MeshModificationByPythonFunction&)
-    :MeshModificationItf(), m_py_obj(0), m_typeCoord(cartesian)
+    :MeshModificationItf(), m_py_obj(0), m_typeCoord(cartesian), m_batch(false)
     {
         MGX_FORBIDDEN("MeshModificationByPythonFunction::MeshModificationByPythonFunction is not allowed.");
     }
@@ -62,11 +68,23 @@ protected:
         return *this;
     }
 private:
+	/// appel de la fonction pour chacun des noeuds
+	void applyByNode(std::vector<gmds::Node >& nodes);
+
+	/** appel unique de la fonction avec les tableaux (copies appartenant à
+	 *  Python) des coordonnées des noeuds, elle retourne les tableaux des
+	 *  nouvelles coordonnées ou None si elle a modifié ceux reçus
+	 */
+	void applyByBatch(std::vector<gmds::Node >& nodes);
+
 	/// fonction utilisateur en python de perturbation du maillage
 	PyObject* m_py_obj;
 
 	/// type de coordonnées sur lesquelles doit être utilisé la fonction python
 	eTypeCoord m_typeCoord;
+
+	/// appel unique avec les tableaux de coordonnées
+	bool m_batch;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
@@ -0,0 +1,82 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MeshPatches.h
+ *
+ *  \date 16/10/2026
+ *
+ *  Découpage d'un ensemble de mailles en patchs colorés
+ *  */
+/*----------------------------------------------------------------------------*/
+#ifndef MESH_MESHPATCHES_H_
+#define MESH_MESHPATCHES_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <sys/types.h> // pour uint
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+class CellsCSR;
+/*----------------------------------------------------------------------------*/
+/** \class MeshPatches
+ *  \brief Découpage en patchs colorés pour les lissages en parallèle
+ *
+ *  Les mailles sont prises par tranches consécutives de nbCellsPerPatch,
+ *  un noeud appartient au patch de la première maille qui le contient.
+ *  Un patch est constitué des mailles qui contiennent au moins un de ses
+ *  noeuds déplaçables (son étoile), seuls ces noeuds sont déplacés lors du
+ *  traitement du patch, les autres noeuds de l'étoile sont figés.
+ *
+ *  Deux patchs de même couleur ne lisent pas les noeuds que l'autre
+ *  déplace : ils peuvent être traités en même temps, dans n'importe quel
+ *  ordre. Le découpage et la coloration ne dépendent que des mailles, le
+ *  résultat est le même quel que soit le nombre de threads.
+ */
+/*----------------------------------------------------------------------------*/
+class MeshPatches{
+
+public:
+    /// un patch, les indices sont ceux de la connectivité globale
+    struct Patch {
+        /// les mailles de l'étoile
+        std::vector<int> cells;
+        /// les noeuds de ces mailles (triés)
+        std::vector<int> nodes;
+        /// vrai pour les noeuds (indicés comme nodes) déplacés dans ce patch
+        std::vector<bool> movable;
+        /// nombre de noeuds par maille et connectivité en indices dans nodes
+        std::vector<int> nbNodesCell;
+        std::vector<int> cellNodes;
+    };
+
+    /** Découpage des mailles de la connectivité, movable indique les noeuds
+     *  déplaçables (indicés comme dans la connectivité)
+     */
+    MeshPatches(const CellsCSR& connectivite, const std::vector<bool>& movable,
+            uint nbCellsPerPatch);
+
+    /// \return le nombre de patchs
+    size_t getNbPatches() const {return m_patches.size();}
+
+    /// \return le patch i
+    const Patch& getPatch(size_t i) const {return m_patches[i];}
+
+    /// \return les patchs par couleur
+    const std::vector<std::vector<uint> >& getColors() const {return m_colors;}
+
+private:
+    /// constructeur par copie et opérateur = interdits
+    MeshPatches(const MeshPatches&);
+    MeshPatches& operator = (const MeshPatches&);
+
+    std::vector<Patch> m_patches;
+    std::vector<std::vector<uint> > m_colors;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* MESH_MESHPATCHES_H_ */
@@ -0,0 +1,270 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file NodeFilter.h
+ *
+ *  \date 16/10/2026
+ *
+ *  Filtres, numérotation locale et connectivité compacte des noeuds gmds
+ *  */
+/*----------------------------------------------------------------------------*/
+#ifndef MESH_NODEFILTER_H_
+#define MESH_NODEFILTER_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <unordered_set>
+#include <sys/types.h> // pour uint
+#include <GMDS/Utils/CommonTypes.h>
+#include <GMDS/IG/Node.h>
+#include <TkUtil/Exception.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/** \class NodeFilter
+ *  \brief Marque (entier) par noeud gmds, stockée dans un tableau indicé par
+ *  les identifiants
+ *
+ *  Un noeud non marqué vaut 0, la lecture et l'écriture se font en temps
+ *  constant. Le tableau est dimensionné une fois pour toutes
+ *  (gmds::IGMesh::getMaxLocalID(0)+1) et s'agrandit si nécessaire.
+ *
+ *  Les identifiants marqués sont mémorisés, ce qui permet de réutiliser le
+ *  filtre (reset) pour un autre ensemble de noeuds sans reparcourir tout le
+ *  tableau.
+ */
+/*----------------------------------------------------------------------------*/
+class NodeFilter{
+
+public:
+    /// constructeur, size est le nombre d'identifiants prévus
+    NodeFilter(size_t size = 0)
+    : m_values(size, 0)
+    {}
+
+    /*----------------------------------------------------------------------------*/
+    /// \return la marque du noeud, 0 s'il n'est pas marqué
+    uint get(gmds::TCellID id) const
+    {
+        return (id < m_values.size() ? m_values[id] : 0);
+    }
+
+    /// \return vrai si le noeud est marqué
+    bool isMarked(gmds::TCellID id) const {return get(id) != 0;}
+
+    /*----------------------------------------------------------------------------*/
+    /// marque le noeud avec val
+    void set(gmds::TCellID id, uint val)
+    {
+        if (id >= m_values.size())
+            m_values.resize(id+1 > 2*m_values.size() ? id+1 : 2*m_values.size(), 0);
+        if (m_values[id] == 0 && val != 0)
+            m_marked.push_back(id);
+        m_values[id] = val;
+    }
+
+    /** marque le noeud avec val s'il ne l'est pas déjà
+     *  \return vrai si le noeud n'était pas marqué
+     */
+    bool setIfUnmarked(gmds::TCellID id, uint val)
+    {
+        if (get(id) != 0)
+            return false;
+        set(id, val);
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /** \return les identifiants marqués depuis la dernière remise à zéro
+     *  (certains peuvent avoir été remis à 0 par set)
+     */
+    const std::vector<gmds::TCellID>& marked() const {return m_marked;}
+
+    /// remet à 0 les noeuds marqués, le tableau est conservé
+    void reset()
+    {
+        for (size_t i=0; i<m_marked.size(); ++i)
+            m_values[m_marked[i]] = 0;
+        m_marked.clear();
+    }
+
+private:
+    /// les marques indicées par les identifiants
+    std::vector<uint> m_values;
+
+    /// les identifiants marqués
+    std::vector<gmds::TCellID> m_marked;
+};
+/*----------------------------------------------------------------------------*/
+/** \class NodeSet
+ *  \brief Ensemble d'identifiants de noeuds gmds, pour écarter les doublons
+ *
+ *  Le NodeFilter (tableau à la taille du maillage) n'est utilisé que si le
+ *  nombre de noeuds attendus n'est pas petit devant la taille du maillage,
+ *  sinon une table de hachage évite un coût proportionnel à tout le maillage.
+ */
+/*----------------------------------------------------------------------------*/
+class NodeSet{
+
+public:
+    /** constructeur, size est le nombre d'identifiants du maillage et
+     *  expected un majorant du nombre de noeuds qui seront ajoutés
+     */
+    NodeSet(size_t size, size_t expected)
+    : m_dense(expected*RATIO_DENSE >= size)
+    , m_filter(m_dense ? size : 0)
+    {
+        if (!m_dense)
+            m_ids.reserve(expected);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /** ajoute le noeud
+     *  \return vrai s'il n'était pas déjà dans l'ensemble
+     */
+    bool insert(gmds::TCellID id)
+    {
+        if (m_dense)
+            return m_filter.setIfUnmarked(id, 1);
+        return m_ids.insert(id).second;
+    }
+
+private:
+    /// rapport taille du maillage / nombre de noeuds attendus en deçà duquel le filtre est dense
+    static const size_t RATIO_DENSE = 16;
+
+    /// vrai si le filtre dense est utilisé
+    bool m_dense;
+
+    /// le filtre dense
+    NodeFilter m_filter;
+
+    /// les identifiants, hors filtre dense
+    std::unordered_set<gmds::TCellID> m_ids;
+};
+/*----------------------------------------------------------------------------*/
+/** \class NodeIndex
+ *  \brief Numérotation locale (0..n-1) d'un ensemble de noeuds gmds, dans
+ *  l'ordre du vecteur donné, avec un accès direct depuis les identifiants
+ */
+/*----------------------------------------------------------------------------*/
+class NodeIndex{
+
+public:
+    NodeIndex(const std::vector<gmds::Node>& nodes)
+    {
+        gmds::TCellID max_id = 0;
+        for (size_t i=0; i<nodes.size(); ++i)
+            if (nodes[i].getID() > max_id)
+                max_id = nodes[i].getID();
+        m_index.resize(nodes.empty() ? 0 : max_id+1, -1);
+        for (size_t i=0; i<nodes.size(); ++i)
+            m_index[nodes[i].getID()] = (int)i;
+        m_size = nodes.size();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// \return l'indice local du noeud, -1 s'il n'est pas dans l'ensemble
+    int get(gmds::TCellID id) const
+    {
+        return (id < m_index.size() ? m_index[id] : -1);
+    }
+
+    /// \return le nombre de noeuds
+    size_t size() const {return m_size;}
+
+private:
+    /// les indices locaux indicés par les identifiants
+    std::vector<int> m_index;
+
+    /// nombre de noeuds
+    size_t m_size;
+};
+/*----------------------------------------------------------------------------*/
+/** \class CellsCSR
+ *  \brief Connectivité mailles -> noeuds au format compressé (CSR) en indices
+ *  locaux
+ *
+ *  Les noeuds de la maille i sont indices()[offsets()[i]] à
+ *  indices()[offsets()[i+1]-1], dans l'ordre gmds.
+ */
+/*----------------------------------------------------------------------------*/
+class CellsCSR{
+
+public:
+    CellsCSR() {}
+
+    /*----------------------------------------------------------------------------*/
+    /** construit la connectivité des mailles, tous leurs noeuds doivent être
+     *  dans index
+     */
+    template<typename TCell>
+    void build(const std::vector<TCell>& cells, const NodeIndex& index)
+    {
+        m_offsets.resize(cells.size()+1);
+        m_indices.clear();
+        m_offsets[0] = 0;
+
+        std::vector<gmds::TCellID> ids;
+        for (size_t i=0; i<cells.size(); ++i){
+            ids.clear();
+            cells[i].template getAllIDs<gmds::Node>(ids);
+            for (size_t j=0; j<ids.size(); ++j){
+                int ind = index.get(ids[j]);
+                if (ind == -1)
+                    throw TkUtil::Exception (TkUtil::UTF8String ("Erreur interne, CellsCSR avec une maille dont un noeud n'est pas numéroté", TkUtil::Charset::UTF_8));
+                m_indices.push_back(ind);
+            }
+            m_offsets[i+1] = (int)m_indices.size();
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// \return le nombre de mailles
+    size_t getNbCells() const {return m_offsets.empty() ? 0 : m_offsets.size()-1;}
+
+    /// \return le nombre de noeuds de la maille i
+    int getNbNodes(size_t i) const {return m_offsets[i+1] - m_offsets[i];}
+
+    /// \return le premier indice (dans indices()) de la maille i
+    const int* getNodes(size_t i) const {return &m_indices[m_offsets[i]];}
+
+    /// \return le début de chaque maille, suivi du nombre total d'indices
+    const std::vector<int>& offsets() const {return m_offsets;}
+
+    /// \return les indices locaux des noeuds, maille après maille
+    const std::vector<int>& indices() const {return m_indices;}
+    std::vector<int>& indices() {return m_indices;}
+
+    /*----------------------------------------------------------------------------*/
+    /** connectivité inverse noeuds -> mailles pour nbNodes noeuds, les mailles
+     *  du noeud i sont cells[offsets[i]] à cells[offsets[i+1]-1], dans l'ordre
+     *  croissant
+     */
+    void buildNodeToCells(size_t nbNodes, std::vector<int>& offsets, std::vector<int>& cells) const
+    {
+        const size_t nb_cells = getNbCells();
+        offsets.assign(nbNodes+1, 0);
+        for (size_t i=0; i<m_indices.size(); ++i)
+            offsets[m_indices[i]+1]++;
+        for (size_t i=0; i<nbNodes; ++i)
+            offsets[i+1] += offsets[i];
+        cells.resize(offsets[nbNodes]);
+        std::vector<int> pos(offsets.begin(), offsets.end()-1);
+        for (size_t c=0; c<nb_cells; ++c)
+            for (int j=m_offsets[c]; j<m_offsets[c+1]; ++j)
+                cells[pos[m_indices[j]]++] = (int)c;
+    }
+
+private:
+    std::vector<int> m_offsets;
+    std::vector<int> m_indices;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* MESH_NODEFILTER_H_ */
@@ -78,6 +78,11 @@ public:
     ///  Fournit l'accès aux faces GMDS
     virtual void getGMDSFaces(std::vector<gmds::Face >& faces) const;
 
+#ifndef SWIG
+    ///  Fournit une vue sur les faces GMDS, sans copie
+    virtual void getGMDSFacesView(MeshGroupView<gmds::Face>& view) const;
+#endif
+
     ///  Fournit l'accès aux noeuds GMDS
     virtual void getGMDSNodes(std::vector<gmds::Node >& nodes) const;
 
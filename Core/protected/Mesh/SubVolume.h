@@ -91,6 +91,11 @@ public:
     ///  Fournit l'accès aux regions (polyèdres) GMDS
     virtual void getGMDSRegions(std::vector<gmds::Region>& ARegions) const;
 
+#ifndef SWIG
+    ///  Fournit une vue sur les régions GMDS, sans copie
+    virtual void getGMDSRegionsView(MeshGroupView<gmds::Region>& view) const;
+#endif
+
     /// Vide le conteneur de polyèdres
     virtual void clear();
      /*------------------------------------------------------------------------*/
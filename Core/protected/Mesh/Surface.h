@@ -14,6 +14,7 @@
 #include <TkUtil/UTF8String.h>
 #include "Utils/Container.h"
 #include "Topo/MeshSurfaceTopoProperty.h"
+#include "Mesh/MeshGroupView.h"
 /*----------------------------------------------------------------------------*/
 namespace gmds {
 class Face;
@@ -138,8 +139,20 @@ public:
     ///  Fournit l'accès aux faces GMDS
     virtual void getGMDSFaces(std::vector<gmds::Face >& AFaces) const;
 
+#ifndef SWIG
+    ///  Fournit une vue sur les faces GMDS, sans copie des identifiants
+    virtual void getGMDSFacesView(MeshGroupView<gmds::Face>& view) const;
+#endif
+
     ///  Fournit l'accès aux noeuds GMDS
     virtual void getGMDSNodes(std::vector<gmds::Node >& ANodes) const;
+#ifndef SWIG
+    /** Représentation dégradée d'un facteur ratio, conservée jusqu'à la
+     *  prochaine modification du maillage.
+     *  La représentation retournée reste valide tant qu'elle est référencée
+     */
+    std::shared_ptr<const MeshLevelOfDetail> getLevelOfDetail(uint ratio) const;
+#endif
 
     /*------------------------------------------------------------------------*/
     /** Duplique le MeshSurfaceTopoProperty pour en conserver une copie
@@ -14,6 +14,7 @@
 #include <TkUtil/UTF8String.h>
 #include "Utils/Container.h"
 #include "Topo/MeshVolumeTopoProperty.h"
+#include "Mesh/MeshGroupView.h"
 /*----------------------------------------------------------------------------*/
 namespace gmds {
 class Region;
@@ -138,8 +139,20 @@ public:
     ///  Fournit l'accès aux regions (polyèdres) GMDS
     virtual void getGMDSRegions(std::vector<gmds::Region >& ARegions) const;
 
+#ifndef SWIG
+    ///  Fournit une vue sur les régions GMDS, sans copie des identifiants
+    virtual void getGMDSRegionsView(MeshGroupView<gmds::Region>& view) const;
+#endif
+
     ///  Fournit l'accès aux noeuds GMDS
     virtual void getGMDSNodes(std::vector<gmds::Node >& ANodes) const;
+#ifndef SWIG
+    /** Représentation dégradée d'un facteur ratio, du volume (skin à faux) ou
+     *  de sa peau, conservée jusqu'à la prochaine modification du maillage.
+     *  La représentation retournée reste valide tant qu'elle est référencée
+     */
+    std::shared_ptr<const MeshLevelOfDetail> getLevelOfDetail(uint ratio, bool skin) const;
+#endif
 
     /*------------------------------------------------------------------------*/
     /** Duplique le MeshVolumeTopoProperty pour en conserver une copie
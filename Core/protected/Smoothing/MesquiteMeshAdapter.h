@@ -11,7 +11,6 @@
 #define MESQUITEMESHADAPTER_H_
 /*----------------------------------------------------------------------------*/
 #include <vector>
-#include <map>
 #include <sys/types.h> // pour uint
 #include <GMDS/Utils/CommonTypes.h>
 /*----------------------------------------------------------------------------*/
@@ -32,14 +31,17 @@ namespace Mesh {
 class MesquiteMeshAdapter : public MESQUITE_NS::MeshImpl
 {
 public:
-	/// passage de Gmds vers Mesquite dans le cas d'une surface
+	/** passage de Gmds vers Mesquite dans le cas d'une surface,
+	 *  isNodeFixed est indicé comme gmdsNodes et isPolyInverted comme gmdsPolygones
+	 */
 	MesquiteMeshAdapter(std::vector<gmds::Face>& gmdsPolygones,
 			std::vector<gmds::Node>& gmdsNodes,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
-			std::map<gmds::TCellID, bool>& isPolyInverted,
-			uint maskFixed);
+			const std::vector<bool>& isNodeFixed,
+			const std::vector<bool>& isPolyInverted);
 
-	/// retour de Mesquite vers Gmds (modif des positions des noeuds)
+	/** retour de Mesquite vers Gmds (modif des positions des noeuds),
+	 *  seuls les noeuds déplacés sont modifiés
+	 */
 	virtual ~MesquiteMeshAdapter();
 
 private:
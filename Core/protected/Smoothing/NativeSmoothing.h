@@ -0,0 +1,73 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file NativeSmoothing.h
+ *
+ *  \date 16/10/2026
+ *
+ *  Lissages volumiques laplacien et de type Tipton, sans Smooth3D
+ *  */
+/*----------------------------------------------------------------------------*/
+#ifndef MESH_NATIVESMOOTHING_H_
+#define MESH_NATIVESMOOTHING_H_
+/*----------------------------------------------------------------------------*/
+#include <sys/types.h> // pour uint
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/** \class NativeSmoothing
+ *  \brief Lisseurs volumiques internes, avec les mêmes arguments que ceux de
+ *  Smooth3D (S3_laplace, S3_Tipton)
+ *
+ *  Les coordonnées sont des tableaux séparés (x, y, z) et la connectivité est
+ *  donnée par le nombre de noeuds par maille (nb_node_cell) suivi des noeuds
+ *  maille après maille (nodes_number).
+ *
+ *  À chaque itération (de type Jacobi) on calcule le centre de chaque maille,
+ *  puis la cible d'un noeud comme la moyenne des centres des mailles qui le
+ *  contiennent. Le noeud est déplacé vers sa cible de relax[i] (0 pour un noeud
+ *  figé, 1 pour un déplacement complet).
+ *
+ *  Pour laplace, les mailles ont le même poids. Pour tipton, un centre est
+ *  pondéré par la taille de la maille (moyenne des carrés des distances des
+ *  noeuds au centre), ce qui, comme la méthode de Tipton, tend à équilibrer
+ *  la taille des mailles voisines.
+ *
+ *  Le résultat ne dépend pas de l'ordre de traitement, les mailles puis les
+ *  noeuds sont traités par tranches en parallèle (sauf si parallel est faux).
+ */
+/*----------------------------------------------------------------------------*/
+class NativeSmoothing{
+
+public:
+    /** lissage laplacien
+     *  \return 0 en cas de succès
+     */
+    static int laplace(int nb_cells, int nb_vtx,
+            const int* nb_node_cell, const int* nodes_number,
+            double* x, double* y, double* z,
+            const double* relax, int nbIterations, bool parallel = true);
+
+    /** lissage pondéré par la taille des mailles, de type Tipton
+     *  \return 0 en cas de succès
+     */
+    static int tipton(int nb_cells, int nb_vtx,
+            const int* nb_node_cell, const int* nodes_number,
+            double* x, double* y, double* z,
+            const double* relax, int nbIterations, bool parallel = true);
+
+private:
+    /// lissage commun aux 2 méthodes
+    static int smooth(bool weighted, int nb_cells, int nb_vtx,
+            const int* nb_node_cell, const int* nodes_number,
+            double* x, double* y, double* z,
+            const double* relax, int nbIterations, bool parallel);
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* MESH_NATIVESMOOTHING_H_ */
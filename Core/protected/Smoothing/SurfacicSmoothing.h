@@ -28,6 +28,8 @@ class Surface;
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
+class NodeFilter;
+/*----------------------------------------------------------------------------*/
 /**
  * \class SurfacicSmoothing
  *
@@ -48,8 +50,10 @@ public:
 	/// Constructeur pour fonction de lissage surfacique avec les arguments par défaut
 	SurfacicSmoothing();
 
-	/// Constructeur avec paramètres différents du défaut
-	SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solver);
+	/** Constructeur avec paramètres différents du défaut,
+	 *  patchSize est le nombre de mailles par patch (0 pour un lissage sans découpage)
+	 */
+	SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solver, int patchSize = 0);
 
 	/// change le nombre d'itérations
 	void setNbIterations(int nbIterations);
@@ -60,6 +64,12 @@ public:
 	/// change le type de solver utilisé par Mesquite
 	void setSolver(eSolver solver);
 
+	/** change le nombre de mailles par patch. Une surface de plus de patchSize
+	 *  mailles est lissée par patchs colorés, traités en parallèle si le
+	 *  lisseur est réentrant (0 pour un lissage sans découpage)
+	 */
+	void setPatchSize(int patchSize);
+
 	/// accesseur sur le nombre d'itérations
 	int getNbIterations() const {return m_nbIterations;}
 
@@ -69,11 +79,19 @@ public:
 	/// accesseur sur le solver
 	eSolver getSolver() const {return m_solver;}
 
+	/// accesseur sur le nombre de mailles par patch
+	int getPatchSize() const {return m_patchSize;}
+
 #ifndef SWIG
 
 	/// converti en chaine de caractères une méthode de lissage
 	static std::string toString(eSurfacicMethod method);
 
+	/** vrai si le lisseur peut être appelé par plusieurs threads à la fois,
+	 *  faux tant que la réentrance de Mesquite n'est pas vérifiée
+	 */
+	bool isReentrant() const {return false;}
+
 	/// converti en chaine de caractères le nom d'un solver
 	static std::string toString(eSolver solver);
 
@@ -85,13 +103,17 @@ public:
 
 	/** Fonction d'appel pour modifier un ensemble de noeuds du maillage
 	 *  Ne sont modifiés que ceux dont la valeur est différente de la marque dans le filtre
+	 *  isPolyInverted est indicé comme gmdsPolygones
+	 *  Les patchs ne sont lissés en parallèle que si parallel est vrai
+	 *  (décision de la commande, projections OCAF non réentrantes)
 	 */
 	virtual void applyModification(std::vector<gmds::Node >& gmdsNodes,
 			std::vector<gmds::Face>& gmdsPolygones,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
-			std::map<gmds::TCellID, bool>& isPolyInverted,
+			const NodeFilter& filtre_nodes,
+			const std::vector<bool>& isPolyInverted,
 			uint maskFixed,
-			Geom::Surface* surface);
+			Geom::Surface* surface,
+			bool parallel);
 
 	/** \brief  Fournit une représentation textuelle de l'entité.
 	 * \return	Description, à détruire par l'appelant.
@@ -107,6 +129,29 @@ protected:
 	SurfacicSmoothing& operator = (const SurfacicSmoothing&);
 
 private:
+	/** lissage avec Mesquite de l'ensemble des polygones, isNodeFixed est
+	 *  indicé comme gmdsNodes et isPolyInverted comme gmdsPolygones.
+	 *  Sans itération, les noeuds sont seulement projetés.
+	 */
+	void smooth(std::vector<gmds::Node >& gmdsNodes,
+			std::vector<gmds::Face>& gmdsPolygones,
+			const std::vector<bool>& isNodeFixed,
+			const std::vector<bool>& isPolyInverted,
+			Geom::Surface* surface,
+			int nbIterations,
+			bool withQualityAssessment) const;
+
+	/** lissage par patchs colorés (cf MeshPatches), une itération sur chacun
+	 *  des patchs à chaque passe, les patchs d'une couleur sont traités en
+	 *  parallèle si parallel est vrai
+	 */
+	void smoothByPatches(std::vector<gmds::Node >& gmdsNodes,
+			std::vector<gmds::Face>& gmdsPolygones,
+			const std::vector<bool>& isNodeFixed,
+			const std::vector<bool>& isPolyInverted,
+			Geom::Surface* surface,
+			bool parallel) const;
+
 	/// mémorise le fait que l'utilisateur ait changé un paramètre, pour getScriptCommand
 	bool m_useDefaults;
 
@@ -119,6 +164,9 @@ private:
 	/// le solver pour les algos de Mesquite
 	eSolver m_solver;
 
+	/// nombre de mailles par patch, 0 pour un lissage sans découpage
+	int m_patchSize;
+
 #endif
 };
 /*----------------------------------------------------------------------------*/
@@ -28,6 +28,9 @@ class Volume;
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
+class NodeFilter;
+class CellsCSR;
+/*----------------------------------------------------------------------------*/
 /**
  * \class VolumicSmoothing
  *
@@ -48,8 +51,10 @@ public:
 	/// Constructeur pour fonction de lissage volumique avec les arguments par défaut
 	VolumicSmoothing();
 
-	/// Constructeur avec paramètres différents du défaut
-	VolumicSmoothing(int nbIterations, eVolumicMethod methodeLissage);
+	/** Constructeur avec paramètres différents du défaut,
+	 *  patchSize est le nombre de mailles par patch (0 pour un lissage sans découpage)
+	 */
+	VolumicSmoothing(int nbIterations, eVolumicMethod methodeLissage, int patchSize = 0);
 
 	/// change le nombre d'itérations
 	void setNbIterations(int nbIterations);
@@ -57,17 +62,31 @@ public:
 	/// change la méthode de lissage
 	void setMethod(eVolumicMethod methodeLissage);
 
+	/** change le nombre de mailles par patch. Un volume de plus de patchSize
+	 *  mailles est lissé par patchs colorés, traités en parallèle si le
+	 *  lisseur est réentrant (0 pour un lissage sans découpage)
+	 */
+	void setPatchSize(int patchSize);
+
 	/// accesseur sur le nombre d'itérations
 	int getNbIterations() const {return m_nbIterations;}
 
 	/// accesseur sur la méthode de lissage
 	eVolumicMethod getMethod() const {return m_methodeLissage;}
 
+	/// accesseur sur le nombre de mailles par patch
+	int getPatchSize() const {return m_patchSize;}
+
 #ifndef SWIG
 
 	/// converti en chaine de caractères une méthode de lissage
 	static std::string toString(eVolumicMethod method);
 
+	/** vrai si le lisseur peut être appelé par plusieurs threads à la fois,
+	 *  ce n'est le cas que de NativeSmoothing (réentrance de Smooth3D non vérifiée)
+	 */
+	bool isReentrant() const;
+
     /** Création d'un clone, on copie toutes les informations */
     virtual VolumicSmoothing* clone() const;
 
@@ -76,12 +95,14 @@ public:
 
 	/** Fonction d'appel pour modifier un ensemble de noeuds du maillage
 	 *  Ne sont modifiés que ceux dont la valeur est différente de la marque dans le filtre
+	 *  Les patchs ne sont lissés en parallèle que si parallel est vrai
 	 */
 	virtual void applyModification(std::vector<gmds::Node >& gmdsNodes,
 			std::vector<gmds::Region>& gmdsPolyedres,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
+			const NodeFilter& filtre_nodes,
 			uint maskFixed,
-			Geom::Volume* volume);
+			Geom::Volume* volume,
+			bool parallel);
 
 	/** \brief  Fournit une représentation textuelle de l'entité.
 	 * \return	Description, à détruire par l'appelant.
@@ -97,6 +118,21 @@ protected:
 	VolumicSmoothing& operator = (const VolumicSmoothing&);
 
 private:
+	/** appel au lisseur pour nbIterations (Smooth3D s'il est disponible,
+	 *  NativeSmoothing sinon), les noeuds dont relax est nul ne sont pas déplacés.
+	 *  NativeSmoothing ne traite les noeuds en parallèle que si parallel est vrai
+	 */
+	int smoothCells(int nb_cells, int nb_vtx, int* nb_node_cell, int* nodes_number,
+			double* x, double* y, double* z, double* relax, int nbIterations,
+			bool parallel) const;
+
+	/** lissage par patchs colorés (cf MeshPatches), une itération sur chacun
+	 *  des patchs à chaque passe, les patchs d'une couleur sont traités en
+	 *  parallèle si parallel est vrai
+	 */
+	int smoothByPatches(int nb_vtx, const CellsCSR& connectivite,
+			double* x, double* y, double* z, double* relax, bool parallel) const;
+
 	/// mémorise le fait que l'utilisateur ait changé un paramètre, pour getScriptCommand
 	bool m_useDefaults;
 
@@ -106,6 +142,9 @@ private:
 	/// la méthode de lissage du volume
 	eVolumicMethod m_methodeLissage;
 
+	/// nombre de mailles par patch, 0 pour un lissage sans découpage
+	int m_patchSize;
+
 #endif
 };
 /*----------------------------------------------------------------------------*/
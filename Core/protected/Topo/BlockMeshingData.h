@@ -26,6 +26,8 @@ public:
     : m_is_meshed(false)
     , m_is_premeshed(false)
 	, m_is_mesh_crossed(false)
+	, m_are_regions_tested(false)
+	, m_are_regions_inverted(false)
 	, m_points(0)
     {
     	//std::cout<<"BlockMeshingData()"<<std::endl;
@@ -41,6 +43,8 @@ public:
         emd->m_is_meshed = m_is_meshed;
         emd->m_is_premeshed = m_is_premeshed;
         emd->m_is_mesh_crossed = m_is_mesh_crossed;
+        emd->m_are_regions_tested = m_are_regions_tested;
+        emd->m_are_regions_inverted = m_are_regions_inverted;
         emd->m_nodes.insert(emd->m_nodes.end(), m_nodes.begin(), m_nodes.end());
         emd->m_poly.insert(emd->m_poly.end(), m_poly.begin(), m_poly.end());
         emd->m_points =  m_points;
@@ -67,6 +71,18 @@ public:
     /** Modificateur de l'état du maillage */
     void setMeshCrossed(bool val) { m_is_mesh_crossed = val; }
 
+    /*------------------------------------------------------------------------*/
+    /** Accesseur sur le test de l'orientation des hexaèdres (fait lors du
+     *  calcul des points) */
+    bool areRegionsTested() const {return m_are_regions_tested;}
+
+    /** Accesseur sur le résultat du test de l'orientation des hexaèdres */
+    bool areRegionsInverted() const {return m_are_regions_inverted;}
+
+    /** Modificateur du résultat du test de l'orientation des hexaèdres */
+    void setRegionsOrientation(bool tested, bool inverted)
+    { m_are_regions_tested = tested; m_are_regions_inverted = inverted; }
+
     /*------------------------------------------------------------------------*/
     /** Accesseur sur la liste des points */
     Utils::Math::Point*& points() {return m_points;}
@@ -89,6 +105,12 @@ private:
     /// Maillage associé avec maille croisée ou non
     bool m_is_mesh_crossed;
 
+    /// Orientation des hexaèdres testée lors du calcul des points
+    bool m_are_regions_tested;
+
+    /// Hexaèdres à créer avec l'orientation inversée
+    bool m_are_regions_inverted;
+
     /// Liste des noeuds (gmds) associés
     std::vector<gmds::TCellID> m_nodes;
 
@@ -15,6 +15,7 @@
 #include "Topo/CoEdgeMeshingProperty.h"
 #include "Topo/CoEdgeTopoProperty.h"
 #include "Topo/CoEdgeMeshingData.h"
+#include "Utils/ReadWriteLock.h"
 #include <TkUtil/Mutex.h>
 /*----------------------------------------------------------------------------*/
 namespace gmds {
@@ -381,6 +382,37 @@ public:
      */
     void getPoints(std::vector<Utils::Math::Point> &points) const;
 
+    /** \class PointsView
+     *  \brief Accès en lecture aux points de l'arête, sans copie si le
+     *  prémaillage est à jour (les points sont calculés si nécessaire).
+     *
+     *  Le prémaillage est verrouillé en lecture pendant toute la durée de vie
+     *  de l'instance, il ne peut être ni échangé ni vidé par un autre thread.
+     *  Pour une arête maillée ou dont le prémaillage n'est pas à jour, les
+     *  points sont copiés dans l'instance.
+     *  Il ne faut pas modifier la discrétisation de l'arête tant que
+     *  l'instance existe.
+     */
+    class PointsView {
+    public:
+        PointsView(const CoEdge* coedge);
+        ~PointsView();
+
+        /// \return les points de l'arête
+        const std::vector<Utils::Math::Point>& points() const {return *m_points;}
+
+    private:
+        PointsView(const PointsView&);
+        PointsView& operator = (const PointsView&);
+
+        /// verrou pris en lecture sur le prémaillage, 0 en cas de copie
+        Utils::ReadWriteLock* m_lock;
+        /// copie des points si nécessaire
+        std::vector<Utils::Math::Point> m_buffer;
+        /// les points accessibles
+        const std::vector<Utils::Math::Point>* m_points;
+    };
+
     /// nettoyage du preMesh (les points)
     void clearPoints();
 
@@ -426,6 +458,14 @@ public:
     /// Nombre de noeuds internes: le nombre de noeuds sans ceux du bord
     virtual unsigned long getNbInternalMeshingNodes();
 
+    /*------------------------------------------------------------------------*/
+    /** Constitue la liste des arêtes dont dépend la discrétisation de cette
+     *  arête (cas interpolé ou interpolé globalement), vide sinon.
+     *  Les arêtes inexistantes sont ignorées, l'erreur sera signalée lors
+     *  du calcul des points.
+     */
+    void getInterpolationReferences(std::vector<CoEdge*>& coedges) const;
+
 
 private:
     /*------------------------------------------------------------------------*/
@@ -457,6 +497,10 @@ private:
     Geom::Curve* createBSplineByProj(Utils::Math::Point& pt0, Utils::Math::Point& pt1, Geom::Surface* surface) const;
     Geom::Curve* createBSplineByProjWithOrthogonalIntersection(Utils::Math::Point& pt0, Utils::Math::Point& pt1, Geom::Surface* surface) const;
 
+    /*------------------------------------------------------------------------*/
+    /// ajoute à points les coordonnées des noeuds de l'arête maillée
+    void getNodesPoints(std::vector<Utils::Math::Point> &points) const;
+
     /*------------------------------------------------------------------------*/
 
     /// Propriétés topologiques de l'arête (liens sur les faces et les sommets)
@@ -479,6 +523,10 @@ private:
 
     /// Protection pour l'accès au premaillages (m_mesh_data->points())
     mutable TkUtil::Mutex   preMeshMutex;
+
+    /** Protection de l'état du prémaillage pour les lecteurs (PointsView),
+     *  pris en écriture seulement lors de la mise à jour des points */
+    mutable Utils::ReadWriteLock m_points_lock;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
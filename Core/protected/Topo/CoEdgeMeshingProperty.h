@@ -13,6 +13,7 @@
 #define COEDGEPROPERTYMESHING_H_
 /*----------------------------------------------------------------------------*/
 #include <sys/types.h>
+#include <vector>
 #include <TkUtil/UTF8String.h>
 #include "Utils/SerializedRepresentation.h"
 #include "Utils/Point.h"
@@ -132,6 +133,12 @@ public:
     /// retourne le coefficient suivant pour les noeuds internes (ratio dans ]0, 1[, entre distance au premier point / longueur de l'ensemble)
     virtual double nextCoeff() =0;
 
+    /** Calcul en une seule fois de l'ensemble des coefficients (après initCoeff),
+     *  coeffs est redimensionné à nbEdges+1 avec coeffs[0] = 0 et coeffs[nbEdges] = 1,
+     *  les valeurs intermédiaires sont celles qu'auraient retourné les appels successifs à nextCoeff
+     */
+    virtual void getCoeffs(std::vector<double>& coeffs);
+
     /// retourne vrai pour les méthodes qui nécessitent d'avoir la longueur du contour pour l'initialisation
     virtual bool needLengthToInitialize() {return false;}
 
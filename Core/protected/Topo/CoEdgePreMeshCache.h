@@ -0,0 +1,93 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file CoEdgePreMeshCache.h
+ *
+ *  \date 16/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef TOPO_COEDGEPREMESHCACHE_H_
+#define TOPO_COEDGEPREMESHCACHE_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <string>
+#include <list>
+#include <unordered_map>
+#include "Utils/Point.h"
+#include <TkUtil/Mutex.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+class CoEdge;
+class CoEdgeMeshingProperty;
+/*----------------------------------------------------------------------------*/
+/**
+   @brief Cache des points de la discrétisation (projetés) des arêtes communes
+
+   La clé est construite à partir du contenu de la discrétisation (loi et
+   ses paramètres, nombre de bras, sens, orthogonalité), de l'entité
+   géométrique associée à l'arête (identifiant unique et boite englobante),
+   et des extrémités (coordonnées, association et état maillé).
+   Pour une discrétisation orthogonale, la normale dépend aussi du voisinage
+   du sommet de départ (courbes et surfaces voisines de son association,
+   arêtes, faces et blocs adjacents), qui est ajouté à la clé.
+   Deux arêtes, ou la même arête avant et après un undo/redo, qui ont la même
+   clé ont les mêmes points, sans qu'il soit nécessaire de refaire la
+   discrétisation et les projections.
+
+   Les discrétisations qui dépendent d'autres arêtes (interpolations) ne sont
+   pas mises en cache.
+
+   Le cache est limité en nombre de points, les entrées les plus anciennes
+   sont retirées en premier. Il est protégé pour les accès depuis les threads
+   de prémaillage.
+ */
+class CoEdgePreMeshCache {
+public:
+    /// Constructeur, avec le nombre maximum de points mémorisés
+    CoEdgePreMeshCache(size_t maxNbPoints = 2000000);
+
+    /*------------------------------------------------------------------------*/
+    /** Construit la clé pour la discrétisation prop de l'arête coedge,
+     *  retourne une chaine vide si cette discrétisation n'est pas mise en cache
+     */
+    static std::string computeKey(const CoEdge* coedge, CoEdgeMeshingProperty* prop);
+
+    /*------------------------------------------------------------------------*/
+    /** Recherche les points associés à la clé, retourne vrai et les ajoute
+     *  à points s'ils sont présents
+     */
+    bool find(const std::string& key, std::vector<Utils::Math::Point>& points);
+
+    /** Mémorise les points associés à la clé */
+    void add(const std::string& key, const std::vector<Utils::Math::Point>& points);
+
+    /** Vide le cache */
+    void clear();
+
+private:
+    /// constructeur par copie et opérateur = interdits
+    CoEdgePreMeshCache(const CoEdgePreMeshCache&);
+    CoEdgePreMeshCache& operator = (const CoEdgePreMeshCache&);
+
+    /// les points par clé
+    std::unordered_map<std::string, std::vector<Utils::Math::Point> > m_points;
+
+    /// les clés dans l'ordre d'ajout
+    std::list<std::string> m_keys;
+
+    /// nombre de points mémorisés et nombre maximum
+    size_t m_nbPoints;
+    size_t m_maxNbPoints;
+
+    /// protection des accès
+    TkUtil::Mutex m_mutex;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* TOPO_COEDGEPREMESHCACHE_H_ */
+/*----------------------------------------------------------------------------*/
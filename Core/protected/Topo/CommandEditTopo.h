@@ -176,6 +176,20 @@ protected:
     /// destruction des propriétés internes des entités modifiés
     virtual void deleteInternalsStats();
 
+public:
+    /// estimation de la mémoire occupée, propriétés sauvegardées et entités détruites comprises
+    virtual size_t getMemoryFootprint ( ) const;
+
+    /// estimation de la mémoire que libère releaseUndoData
+    virtual size_t getReleasableMemory ( ) const;
+
+    /** libère les propriétés sauvegardées et les entités détruites par la
+     *  commande, qui ne peut plus être annulée (horizon d'annulation)
+     */
+    virtual bool releaseUndoData ( );
+
+protected:
+
     /** destructions des entités créées par la commande
      * (dans le cas où on ne veut plus faire machine arrière)
      *  et les retire du topomanager
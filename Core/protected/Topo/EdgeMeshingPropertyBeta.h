@@ -53,6 +53,9 @@ public:
     /// retourne le coefficient suivant pour les noeuds internes
     virtual double nextCoeff();
 
+    /// calcul de l'ensemble des coefficients en une fois
+    virtual void getCoeffs(std::vector<double>& coeffs);
+
     /*------------------------------------------------------------------------*/
     /// Script pour la commande de création Python
     virtual TkUtil::UTF8String getScriptCommand() const;
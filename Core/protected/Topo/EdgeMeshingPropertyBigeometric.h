@@ -56,6 +56,9 @@ public:
     /// retourne le coefficient suivant pour les noeuds internes
     virtual double nextCoeff();
 
+    /// calcul de l'ensemble des coefficients en une fois
+    virtual void getCoeffs(std::vector<double>& coeffs);
+
     /// retourne vrai pour les méthodes qui nécessitent d'avoir la longueur du contour pour l'initialisation
     virtual bool needLengthToInitialize() {return true;}
 
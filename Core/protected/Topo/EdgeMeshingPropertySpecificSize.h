@@ -40,6 +40,9 @@ public:
     /// retourne le coefficient suivant pour les noeuds internes
     virtual double nextCoeff();
 
+    /// calcul de l'ensemble des coefficients en une fois
+    virtual void getCoeffs(std::vector<double>& coeffs);
+
     /// Retourne vrai s'il est nécessaire de faire une initialisation à l'aide de la géométrie
     virtual bool needGeomUpdate() const {return true;}
 
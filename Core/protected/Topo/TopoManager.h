@@ -19,7 +19,10 @@
 #include "Topo/Vertex.h"
 #include "Topo/TopoManagerIfc.h"
 #include "Topo/TopoInfo.h"
+#include "Topo/CoEdgePreMeshCache.h"
 #include "Utils/Container.h"
+#include "Utils/NameIndex.h"
+#include "Utils/EntityCache.h"
 #include "Utils/Plane.h"
 /*----------------------------------------------------------------------------*/
 //#define _DEBUG_TIMER
@@ -1502,6 +1505,11 @@ public:
     /** Retourne l'arête suivant le nom en argument */
     virtual CoEdge* getCoEdge(const std::string& name, const bool exceptionIfNotFound=true) const;
 
+    /** Retourne les arêtes suivant les noms en argument, en une seule passe
+     *  (celles non trouvées sont ignorées si exceptionIfNotFound est faux) */
+    virtual void getCoEdges(const std::vector<std::string>& names, std::vector<CoEdge* >& edges,
+            const bool exceptionIfNotFound=true) const;
+
     /** Ajoute une CoEdge au manager */
     virtual void add(CoEdge* ce);
 
@@ -1524,6 +1532,10 @@ public:
 	/** Retourne l'entité suivant le nom en argument */
 	virtual TopoEntity* getEntity(const std::string& name, const bool exceptionIfNotFound=true) const;
 
+    /** Signale le changement de l'état détruit d'une entité, pour
+     *  l'invalidation des listes triées et nombres d'entités non détruites */
+    virtual void destroyedStateChanged(const TopoEntity* te);
+
 
     /** Retourne le nom du sommet en fonction d'une position géométrique */
     virtual std::string getVertexAt(const Point& pt1) const;
@@ -1551,6 +1563,10 @@ public:
     /// retourne le nombre de d'arêtes communes référencées par le TopoManager
     virtual int getNbEdges() const;
 
+    /*------------------------------------------------------------------------*/
+    /// Cache des points de la discrétisation des arêtes communes
+    CoEdgePreMeshCache& getPreMeshCache() {return m_premesh_cache;}
+
     /*------------------------------------------------------------------------*/
     /** Récupère des informations relatives à l'entité topologique */
     virtual Topo::TopoInfo getInfos(const std::string& name, int dim) const;
@@ -1597,8 +1613,27 @@ private:
     /** sommets accessibles depuis le manager */
     Utils::Container<Vertex> m_vertices;
 
+    /** index sur les noms des entités des conteneurs précédents */
+    Utils::NameIndex<Block> m_blocks_index;
+    Utils::NameIndex<Face> m_faces_index;
+    Utils::NameIndex<CoFace> m_cofaces_index;
+    Utils::NameIndex<Edge> m_edges_index;
+    Utils::NameIndex<CoEdge> m_coedges_index;
+    Utils::NameIndex<Vertex> m_vertices_index;
+
+    /** listes triées et nombres des entités non détruites, reconstruits
+     *  à la demande après une modification */
+    mutable Utils::EntityCache<Block> m_blocks_cache;
+    mutable Utils::EntityCache<CoFace> m_cofaces_cache;
+    mutable Utils::EntityCache<CoEdge> m_coedges_cache;
+    mutable Utils::EntityCache<Vertex> m_vertices_cache;
+
     /// Nombre de bras par défaut pour une arête
     int m_defaultNbMeshingEdges;
+
+    /** points des discrétisations des arêtes, suivant leur contenu
+     *  (réutilisés après un undo/redo ou une discrétisation identique) */
+    CoEdgePreMeshCache m_premesh_cache;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
@@ -17,6 +17,8 @@
 #include "Mesh/Line.h"
 #include "Mesh/Surface.h"
 #include "Mesh/Volume.h"
+#include "Mesh/MeshLevelOfDetail.h"
+#include "Utils/ParallelExecution.h"
 
 #include <TkUtil/InternalError.h>
 #include <TkUtil/MemoryError.h>
@@ -46,6 +48,103 @@ namespace Mgx3D
 namespace QtVtkComponents
 {
 
+// ===========================================================================
+//               CONVERSION DES MAILLES GMDS EN STRUCTURES VTK
+// ===========================================================================
+
+/// nombre de mailles (ou de points) traités par une même tâche lors de la conversion
+static const size_t NB_ENTITES_TACHE_VTK = 4096;
+
+/**
+ * Remplit idsArray avec la connectivité VTK des mailles (pour chaque maille
+ * le nombre de noeuds puis les indices locaux des noeuds) et nodes avec les
+ * ids GMDS des points locaux, dans l'ordre de première référence.
+ * La numérotation locale passe par un tableau indicé par les ids GMDS, sans
+ * allocation par maille. Les buffers VTK sont remplis en parallèle.
+ */
+template <typename TCell>
+static void buildVTKConnectivity (
+		gmds::IGMesh& gmdsMesh, const std::vector<TCell>& cells,
+		vtkIdTypeArray& idsArray, std::vector<gmds::TCellID>& nodes)
+{
+	const size_t	cellNum	= cells.size ( );
+
+	// position de chaque maille dans le buffer VTK
+	std::vector<vtkIdType>	offsets (cellNum + 1, 0);
+	Utils::executeParTranches (cellNum, NB_ENTITES_TACHE_VTK,
+			[&] (size_t debut, size_t fin)
+	{
+		std::vector<gmds::TCellID>	nds;
+		for (size_t c = debut; c < fin; c++)
+		{
+			nds.clear ( );
+			cells [c].template getAllIDs<gmds::Node> (nds);
+			offsets [c + 1]	= nds.size ( ) + 1;
+		}
+	});
+	for (size_t c = 0; c < cellNum; c++)
+		offsets [c + 1]	+= offsets [c];
+
+	// ids GMDS des noeuds, directement à leur place
+	idsArray.SetNumberOfValues (offsets [cellNum]);
+	vtkIdType*	cellsPtr	= idsArray.GetPointer (0);
+	Utils::executeParTranches (cellNum, NB_ENTITES_TACHE_VTK,
+			[&] (size_t debut, size_t fin)
+	{
+		std::vector<gmds::TCellID>	nds;
+		for (size_t c = debut; c < fin; c++)
+		{
+			nds.clear ( );
+			cells [c].template getAllIDs<gmds::Node> (nds);
+			vtkIdType*	ptr	= cellsPtr + offsets [c];
+			*ptr++	= nds.size ( );
+			for (size_t j = 0; j < nds.size ( ); j++)
+				*ptr++	= nds [j];
+		}
+	});
+
+	// numérotation locale, dans l'ordre de première référence
+	std::vector<vtkIdType>	node2id (gmdsMesh.getMaxLocalID (0) + 1, -1);
+	nodes.clear ( );
+	for (size_t c = 0; c < cellNum; c++)
+		for (vtkIdType k = offsets [c] + 1; k < offsets [c + 1]; k++)
+		{
+			vtkIdType&	local	= node2id [cellsPtr [k]];
+			if (-1 == local)
+			{
+				local	= nodes.size ( );
+				nodes.push_back (cellsPtr [k]);
+			}
+			cellsPtr [k]	= local;
+		}
+}	// buildVTKConnectivity
+
+
+/**
+ * Remplit points (en double) avec les coordonnées des noeuds GMDS, en
+ * parallèle.
+ */
+static void buildVTKPoints (gmds::IGMesh& gmdsMesh,
+		const std::vector<gmds::TCellID>& nodes, vtkPoints& points)
+{
+	points.SetDataTypeToDouble ( );
+	points.SetNumberOfPoints (nodes.size ( ));
+	double*	coords	=
+		vtkDoubleArray::SafeDownCast (points.GetData ( ))->GetPointer (0);
+	Utils::executeParTranches (nodes.size ( ), NB_ENTITES_TACHE_VTK,
+			[&] (size_t debut, size_t fin)
+	{
+		for (size_t i = debut; i < fin; i++)
+		{
+			gmds::Node	nd	= gmdsMesh.get<gmds::Node> (nodes [i]);
+			coords [3 * i]		= nd.X ( );
+			coords [3 * i + 1]	= nd.Y ( );
+			coords [3 * i + 2]	= nd.Z ( );
+		}
+	});
+}	// buildVTKPoints
+
+
 // ===========================================================================
 //                      LA CLASSE VTKGMDSEntityRepresentation
 // ===========================================================================
@@ -753,10 +852,11 @@ createMeshEntitySurfacicRepresentation2D(Mesh::MeshEntity* meshEntity, gmds::IGM
 
 	surf->getCoFaces(cofaces);
 
-	if (meshEntity->getContext().getRatioDegrad() == 1 || !surf->isStructured())
+	if (meshEntity->getContext().getRatioDegrad() == 1)
 		createCoFacesSurfacicRepresentationRatio1(cofaces, gmdsMesh);
 	else
-		createCoFacesSurfacicRepresentationRatioN(cofaces, gmdsMesh, meshEntity->getContext().getRatioDegrad());
+		createLevelOfDetailSurfacicRepresentation(
+				*surf->getLevelOfDetail(meshEntity->getContext().getRatioDegrad()));
 
 } // createMeshEntitySurfacicRepresentation2D
 
@@ -780,6 +880,14 @@ createMeshEntitySurfacicRepresentation3D(Mesh::MeshEntity* meshEntity, gmds::IGM
 	std::vector<Topo::Block* > blocs;
 	vol->getBlocks(blocs);
 
+	if (meshEntity->getContext().getRatioDegrad() != 1)
+	{
+		// peau dégradée, conservée par le volume
+		createLevelOfDetailSurfacicRepresentation(
+				*vol->getLevelOfDetail(meshEntity->getContext().getRatioDegrad(), true));
+		return;
+	}
+
 	// la liste des faces externes au groupe de blocs
 	// on utilise une map et on marque les faces à chaque fois qu'elles sont vus
 	std::map<Topo::CoFace*, int> marque_faces;
@@ -812,10 +920,7 @@ createMeshEntitySurfacicRepresentation3D(Mesh::MeshEntity* meshEntity, gmds::IGM
 		if (iter->second == 1)
 			cofaces.push_back(iter->first);
 
-	if (meshEntity->getContext().getRatioDegrad() == 1 || !vol->isStructured())
-		createCoFacesSurfacicRepresentationRatio1(cofaces, gmdsMesh);
-	else
-		createCoFacesSurfacicRepresentationRatioN(cofaces, gmdsMesh, meshEntity->getContext().getRatioDegrad());
+	createCoFacesSurfacicRepresentationRatio1(cofaces, gmdsMesh);
 
 } // createMeshEntitySurfacicRepresentation3D
 
@@ -828,84 +933,35 @@ createCoFacesSurfacicRepresentationRatio1(std::vector<Topo::CoFace*> cofaces, gm
 #endif
 	vtkPoints* points = vtkPoints::New();
 	CHECK_NULL_PTR_ERROR(points)
-    points->SetDataTypeToDouble();	// Correctif CP
 
-	// on cumule les noeuds, en évitant les doublons
-	std::vector<gmds::Node> nodes;
+	// les polygones des Topo::CoFace
 	std::vector<gmds::Face> polygones;
-	std::map<gmds::TCellID, int> node2id;
-	uint nbRefIds = 0; /// nombres de références sur les ids dans les polygones
-	int done = gmdsMesh.getNewMark<gmds::Node>();
-
 	for (std::vector<Topo::CoFace*>::iterator iter=cofaces.begin(); iter!=cofaces.end(); ++iter){
-		Topo::CoFace* face = *iter;
-
-		std::vector<gmds::TCellID>& loc_polygones = face->faces(); //les polygones de la Topo::CoFace
-
+		std::vector<gmds::TCellID>& loc_polygones = (*iter)->faces();
 		for (std::vector<gmds::TCellID>::const_iterator iter_p = loc_polygones.begin();
-				iter_p != loc_polygones.end(); ++iter_p){
-
-			gmds::Face current = gmdsMesh.get<gmds::Face>(*iter_p);
-			std::vector<gmds::Node> nds = current.getAll<gmds::Node>();
-			polygones.push_back(current);
-
-			for (std::vector<gmds::Node>::const_iterator iter_n = nds.begin();
-					iter_n != nds.end(); ++iter_n){
-
-				gmds::Node current_node =*iter_n;
-				gmds::TCellID current_node_id =current_node.getID();
-				if (!gmdsMesh.isMarked<gmds::Node>(current_node_id, done)){
-
-					node2id[current_node_id] = nodes.size();
-					nodes.push_back(current_node);
-					gmdsMesh.mark<gmds::Node>(current_node_id, done);
-				}
-			} // end for iter_n
-			nbRefIds += nds.size();
-		} // for (std::vector<gmds::Face*>::const_iterator iter_p = polygones.begin();
+				iter_p != loc_polygones.end(); ++iter_p)
+			polygones.push_back(gmdsMesh.get<gmds::Face>(*iter_p));
 	} // end for iter=cofaces.begin()
 
-	// on démarque les noeuds
-	for (std::vector<gmds::Node>::iterator iter = nodes.begin();
-			iter != nodes.end(); ++iter)
-		gmdsMesh.unmark<gmds::Node>(iter->getID(), done);
-	gmdsMesh.freeMark<gmds::Node>(done);
-
-	const size_t pointsNum = nodes.size();
 	const size_t polygonNum = polygones.size();
 
+	// la connectivité, et les noeuds sans doublon
+	std::vector<gmds::TCellID> nodes;
+	vtkIdTypeArray* idsArray = vtkIdTypeArray::New();
+	buildVTKConnectivity(gmdsMesh, polygones, *idsArray, nodes);
+
 	// Les sommets :
-	points->SetNumberOfPoints(pointsNum);
+	buildVTKPoints(gmdsMesh, nodes, *points);
 	_surfacicGrid->Allocate(polygonNum, 1000);
 	_surfacicGrid->SetPoints(points);
 	_surfacicPointsVTK2GMDSID.clear();
-	vtkIdType id = 0;
-	for (std::vector<gmds::Node>::const_iterator itp =
-			nodes.begin(); nodes.end() != itp; itp++, id++)
-	{
-		double coords[3] = { (*itp).X(), (*itp).Y(), (*itp).Z() };
-		points->SetPoint(id, coords);
-		_surfacicPointsVTK2GMDSID[id] = (*itp).getID();
-	} // for (vector<Math::Point>::const_iterator itp = nodes.begin ( );
+	for (size_t id = 0; id < nodes.size(); id++)
+		_surfacicPointsVTK2GMDSID[id] = nodes[id];
 
 	int* cellTypes = new int[polygonNum];
-	vtkCellArray* cellArray = vtkCellArray::New();
-	vtkIdTypeArray* idsArray = vtkIdTypeArray::New();
-
-	idsArray->SetNumberOfValues(polygonNum + nbRefIds);
-	vtkIdType* cellsPtr = idsArray->GetPointer(0);
-	size_t pos = 0;
-	for (id = 0; id < polygonNum; id++)
-	{
+	for (size_t id = 0; id < polygonNum; id++)
 		cellTypes[id] = VTK_POLYGON;
-		gmds::Face poly = polygones[id];
-
-		std::vector<gmds::TCellID> ndsIDs = poly.getAllIDs<gmds::Node>();
-
-		cellsPtr[pos++] = ndsIDs.size();
-		for (size_t j = 0; j < ndsIDs.size(); j++)
-			cellsPtr[pos++] = node2id[ndsIDs[j]];
-	} // for (id = 0; id < polygonNum; id++)
+	vtkCellArray* cellArray = vtkCellArray::New();
 
 	cellArray->SetCells(polygonNum, idsArray);
 	_surfacicGrid->SetCells(cellTypes, cellArray);
@@ -921,167 +977,75 @@ createCoFacesSurfacicRepresentationRatio1(std::vector<Topo::CoFace*> cofaces, gm
 } // createCoFacesSurfacicRepresentationRatio1
 
 void VTKGMDSEntityRepresentation::
-createCoFacesSurfacicRepresentationRatioN(std::vector<Topo::CoFace*> cofaces, gmds::IGMesh& gmdsMesh, int ratio_degrad)
+createLevelOfDetailSurfacicRepresentation(const Mesh::MeshLevelOfDetail& lod)
 {
 #ifdef _DEBUG_VTKGMDSEntityRepresentation
-	std::cout<<"cas ratio "<<ratio_degrad<<std::endl;
+	std::cout<<"cas ratio "<<lod.getRatio()<<std::endl;
 #endif
-	// cas 2D avec dégradation
-	vtkPoints* points = vtkPoints::New();
-	CHECK_NULL_PTR_ERROR(points)
-
-	uint pointsNum = 0;
-	uint polygonNum = 0;
-
-	// on compte les sommets et les éléments, et on teste les prérequis
-	for (std::vector<Topo::CoFace* >::iterator iter =
-			cofaces.begin(); iter != cofaces.end(); ++iter)
-	{
-		// on se limite au cas avec des Faces structurées, non dégénérées
-//		if ((*iter)->getNbEdges() != 4)
-//		{
-//			INTERNAL_ERROR(exc,
-//					"Le cas avec dégénérescence d'une Face n'est pas implémenté.",
-//					"VTKGMDSEntityRepresentation::createMeshEntitySurfacicRepresentation");
-//			throw exc;
-//		}
-		if (!(*iter)->isStructured())
-		{
-			INTERNAL_ERROR(exc,
-					"Le cas non structuré d'une Face n'est pas implémenté.",
-					"VTKGMDSEntityRepresentation::createMeshEntitySurfacicRepresentation");
-			throw exc;
-		}
+	createLevelOfDetailRepresentation(*_surfacicGrid, lod);
 
-		uint ni, nj;
-		(*iter)->getNbMeshingEdges(ni, nj);
-#ifdef _DEBUG_VTKGMDSEntityRepresentation
-		std::cout<<" pour "<<(*iter)->getName()<<" getNbMeshingEdges => ni = "<<ni<<", nj = "<<nj<<std::endl;
-#endif
+	_surfacicPointsVTK2GMDSID.clear();
+	const std::vector<gmds::TCellID>& ids = lod.getNodeIds();
+	for (size_t id = 0; id < ids.size(); id++)
+		_surfacicPointsVTK2GMDSID[id] = ids[id];
 
-		ni = ni / ratio_degrad + 1;
-		nj = nj / ratio_degrad + 1;
-		if (ni<2)
-			ni=2;
-		if (nj<2)
-			nj=2;
+} // createLevelOfDetailSurfacicRepresentation
 
-#ifdef _DEBUG_VTKGMDSEntityRepresentation
-		std::cout<<" ratio_degrad = "<<ratio_degrad<<" => ni = "<<ni<<", nj = "<<nj<<std::endl;
-#endif
+void VTKGMDSEntityRepresentation::
+createLevelOfDetailRepresentation(vtkUnstructuredGrid& grid, const Mesh::MeshLevelOfDetail& lod)
+{
+	vtkPoints* points = vtkPoints::New();
+	CHECK_NULL_PTR_ERROR(points)
+	points->SetDataTypeToDouble();
 
-		pointsNum += ni * nj;
-		polygonNum += (ni - 1) * (nj - 1);
-	} // for (iter...
-#ifdef _DEBUG_VTKGMDSEntityRepresentation
-	std::cout<<" pointsNum = "<<pointsNum<<", polygonNum = "<<polygonNum<<std::endl;
-#endif
+	const std::vector<Utils::Math::Point>& pts = lod.getPoints();
+	const std::vector<size_t>& polyedres = lod.getPolyedres();
+	const std::vector<size_t>& polygones = lod.getPolygones();
+	const size_t cellNum = lod.getNbPolyedres() + lod.getNbPolygones();
 
-	points->SetNumberOfPoints(pointsNum);
-	_surfacicGrid->Allocate(polygonNum, 1000);
-	_surfacicGrid->SetPoints(points);
-	_surfacicPointsVTK2GMDSID.clear();
+	// Les sommets :
+	points->SetNumberOfPoints(pts.size());
+	for (size_t id = 0; id < pts.size(); id++)
+		points->SetPoint(id, pts[id].getX(), pts[id].getY(), pts[id].getZ());
+	grid.Allocate(cellNum, 1000);
+	grid.SetPoints(points);
 
-	int* cellTypes = new int[polygonNum];
+	int* cellTypes = new int[cellNum];
 	vtkCellArray* cellArray = vtkCellArray::New();
 	vtkIdTypeArray* idsArray = vtkIdTypeArray::New();
 
-	idsArray->SetNumberOfValues(polygonNum * 5); // ATTENTION aux cas dégénérés ou non-structurés
+	// les mailles sont déjà préfixées par leur nombre de noeuds
+	idsArray->SetNumberOfValues(polyedres.size() + polygones.size());
 	vtkIdType* cellsPtr = idsArray->GetPointer(0);
-
-	// remplissage de la structure pour les points et pour les éléments
-	vtkIdType idNd = 0;
-	vtkIdType idEl = 0;
 	size_t pos = 0;
-	for (std::vector<Topo::CoFace* >::iterator iter =
-			cofaces.begin(); iter != cofaces.end(); ++iter)
+	size_t id = 0;
+	// les hexaèdres échantillonnés, dans l'ordre de VTK
+	for (size_t i = 0; i < polyedres.size(); i += polyedres[i] + 1, id++)
 	{
-		uint niMax =
-				(*iter)->getEdge(Topo::CoFace::j_min)->getNbNodes();
-		uint njMax =
-				(*iter)->getEdge(Topo::CoFace::i_min)->getNbNodes();
-
-#ifdef _DEBUG_VTKGMDSEntityRepresentation
-		std::cout<<" pour "<<(*iter)->getName()<<" niMax = "<<niMax<<", njMax = "<<njMax<<std::endl;
-#endif
-
-		uint ni, nj;
-		(*iter)->getNbMeshingEdges(ni, nj);
-		ni = ni / ratio_degrad + 1;
-		nj = nj / ratio_degrad + 1;
-		if (ni<2)
-			ni=2;
-		if (nj<2)
-			nj=2;
-
-		// on utilise les noeuds du maillage
-		std::vector<gmds::TCellID>& nodes = (*iter)->nodes();
-#ifdef _DEBUG_VTKGMDSEntityRepresentation
-		std::cout<<" nodes.size() = "<<nodes.size()<<std::endl;
-#endif
-
-		for (uint i = 0; i < ni; i++)
-		{
-			for (uint j = 0; j < nj; j++)
-			{
-				uint indI = i * ratio_degrad;
-				uint indJ = j * ratio_degrad;
-				if (i == ni - 1)
-					indI = niMax - 1;
-				if (j == nj - 1)
-					indJ = njMax - 1;
-
-#ifdef _DEBUG_VTKGMDSEntityRepresentation
-				std::cout<<" indI + indJ * niMax = "<<indI<<"+"<<indJ<<"*"<<niMax<<" = "<<indI + indJ * niMax<<" / "<<nodes.size()<<std::endl;
-				if (indI + indJ * niMax >= nodes.size())
-					std::cout<<"DEPASSEMENT indice sur nodes"<<std::endl;
-#endif
-
-				gmds::Node node = gmdsMesh.get<gmds::Node>(nodes[indI + indJ * niMax]);
-
-				double coords[3] = { node.X(), node.Y(), node.Z() };
-				points->SetPoint(idNd, coords);
-				_surfacicPointsVTK2GMDSID[idNd] = node.getID();
-
-#ifdef _DEBUG_VTKGMDSEntityRepresentation
-				std::cout << "nodeVTK ("<<i<<","<<j<<") id "<<idNd<<" : "<<coords[0]<<", "<<coords[1]<<", "<<coords[2]<<std::endl;
-#endif
-
-				if ((ni - 1) != i && (nj - 1) != j)
-				{
-
-#ifdef _DEBUG_VTKGMDSEntityRepresentation
-					std::cout <<" elemVTK id : "<<idEl<<" : "<<idNd<<", "<<idNd+1<<", "<<idNd+ni+1<<", "<<idNd+ni<<std::endl;
-#endif
-
-					cellTypes[idEl++] = VTK_POLYGON;
-					cellsPtr[pos++] = 4;
-
-					cellsPtr[pos++] = idNd;
-					cellsPtr[pos++] = idNd + 1;
-					cellsPtr[pos++] = idNd + nj + 1;
-					cellsPtr[pos++] = idNd + nj;
-#ifdef _DEBUG_VTKGMDSEntityRepresentation
-					if (idNd + nj + 1 >= pointsNum)
-						std::cout<<"DEPASSEMENT indices noeuds"<<std::endl;
-#endif
-				}
-				idNd += 1;
-			} // for (uint j=0; j<=nj; j++)
-		} // for (uint i=0; i<=ni; i++)
-
-	} // for (iter...
+		cellTypes[id] = VTK_HEXAHEDRON;
+		for (size_t j = 0; j <= polyedres[i]; j++)
+			cellsPtr[pos++] = polyedres[i + j];
+	}
+	// les polygones (faces communes ou peau des blocs non structurés)
+	for (size_t i = 0; i < polygones.size(); i += polygones[i] + 1, id++)
+	{
+		cellTypes[id] = VTK_POLYGON;
+		for (size_t j = 0; j <= polygones[i]; j++)
+			cellsPtr[pos++] = polygones[i + j];
+	}
 
-	cellArray->SetCells(polygonNum, idsArray);
-	_surfacicGrid->SetCells(cellTypes, cellArray);
+	cellArray->SetCells(cellNum, idsArray);
+	grid.SetCells(cellTypes, cellArray);
 	delete[] cellTypes;
 	cellTypes = 0;
 	idsArray->Delete();
 	idsArray = 0;
 	cellArray->Delete();
 	cellArray = 0;
+	points->Delete ( );
+	points	= 0;
 
-} // createCoFacesSurfacicRepresentationRatioN
+} // createLevelOfDetailRepresentation
 
 
 void VTKGMDSEntityRepresentation::createMeshEntityVolumicRepresentation(
@@ -1119,15 +1083,6 @@ void VTKGMDSEntityRepresentation::createMeshEntityVolumicRepresentation(
     _volumicGrid->Initialize();
 //    points->SetDataTypeToDouble ( );
 
-    if (meshEntity->getContext().getRatioDegrad() != 1)
-    {
-    	MGX_NOT_YET_IMPLEMENTED("Cas du maillage volumique en représentation pleine ne tient pas compte de la dégradation de la représentation du maillage")
-//        INTERNAL_ERROR(exc,
-//                "Le cas avec ratio pour le maillage volumique d'un volume.",
-//                "VTKGMDSEntityRepresentation::createMeshEntityVolumicRepresentation");
-//        throw exc;
-    }
-
     if (3 != meshEntity->getDim())
     {
         INTERNAL_ERROR(exc,
@@ -1151,90 +1106,62 @@ void VTKGMDSEntityRepresentation::createMeshEntityVolumicRepresentation(
             throw exc;
         }
 
-        std::vector<gmds::Region>   polyedres;
-        vol->getGMDSRegions(polyedres);
-
-        // Constitution d'un vecteur avec les noeuds de la surface
-        // et une map pour l'indirection entre gmds::Node vers indice local
-        std::vector<gmds::Node> nodes;
-        std::map<gmds::TCellID, int> node2id;
-        uint nbRefIds = 0; /// nombres de références sur les ids dans les polyêdres
-
-        const int done = gmdsMesh.getNewMark<gmds::Node>();
-        for (std::vector<gmds::Region>::const_iterator iter_p =
-                polyedres.begin(); iter_p != polyedres.end(); ++iter_p)
+        // représentation dégradée, conservée par le volume (les blocs
+        // non structurés y sont représentés par leur peau)
+        std::vector<Topo::Block*> blocs;
+        vol->getBlocks(blocs);
+        if ((1 != meshEntity->getContext().getRatioDegrad()) && (false == blocs.empty()))
         {
-            std::vector<gmds::Node> nds = (*iter_p).getAll<gmds::Node>();
-
-            for (std::vector<gmds::Node>::const_iterator iter_n = nds.begin();
-                    iter_n != nds.end(); ++iter_n)
-            {
-                gmds::Node current_node =*iter_n;
-                gmds::TCellID current_node_id =current_node.getID();
-                if (!gmdsMesh.isMarked<gmds::Node>(current_node_id, done))
-                {
+            createLevelOfDetailRepresentation(*_volumicGrid,
+                    vol->getLevelOfDetail(meshEntity->getContext().getRatioDegrad(), false));
+            points->Delete ( );
+            points	= 0;
+            return;
+        }
 
-                    node2id[current_node_id] = nodes.size();
-                    nodes.push_back(current_node);
-                    gmdsMesh.mark<gmds::Node>(current_node_id, done);
-                }
-            }
-            nbRefIds += nds.size();
-        } // for (std::vector<gmds::Region*>::const_iterator iter_p = polyedres.begin();
+        std::vector<gmds::Region>   polyedres;
+        vol->getGMDSRegions(polyedres);
 
-        // on démarque les noeuds
-        for (std::vector<gmds::Node>::iterator iter = nodes.begin();
-                iter != nodes.end(); ++iter)
-            gmdsMesh.unmark<gmds::Node>(iter->getID(), done);
+        const size_t polyedreNum = polyedres.size();
 
-        gmdsMesh.freeMark<gmds::Node>(done);
+        // la connectivité, et les noeuds sans doublon
+        std::vector<gmds::TCellID> nodes;
+        vtkIdTypeArray* idsArray = vtkIdTypeArray::New();
+        buildVTKConnectivity(gmdsMesh, polyedres, *idsArray, nodes);
 
-        const size_t pointsNum = nodes.size();
-        const size_t polyedreNum = polyedres.size();
-        //cout << "PTS : " << pointsNum << " POLYGONES : " << polyedreNum << endl;
         // Les sommets :
-        points->SetNumberOfPoints(pointsNum);
+        buildVTKPoints(gmdsMesh, nodes, *points);
         _volumicGrid->Allocate(polyedreNum, 1000);
         _volumicGrid->SetPoints(points);
-        vtkIdType id = 0;
-        for (std::vector<gmds::Node>::const_iterator itp = nodes.begin();
-                nodes.end() != itp; itp++, id++)
-        {
-            double coords[3] = { (*itp).X(), (*itp).Y(), (*itp).Z() };
-            points->SetPoint(id, coords);
-        } // for (vector<Math::Point>::const_iterator itp = nodes.begin ( );
 
         int* cellTypes = new int[polyedreNum];
         vtkCellArray* cellArray = vtkCellArray::New();
-        vtkIdTypeArray* idsArray = vtkIdTypeArray::New();
 
-        idsArray->SetNumberOfValues(polyedreNum + nbRefIds);
-        vtkIdType* cellsPtr = idsArray->GetPointer(0);
+        const vtkIdType* cellsPtr = idsArray->GetPointer(0);
         size_t pos = 0;
-        for (id = 0; id < polyedreNum; id++)
+        for (size_t id = 0; id < polyedreNum; id++)
         {
-            gmds::Region poly = polyedres[id];
-
-            std::vector<gmds::TCellID> nds = poly.getAllIDs<gmds::Node>();
-            if (nds.size() == 8)
+            const vtkIdType nbNodes = cellsPtr[pos];
+            if (nbNodes == 8)
                 cellTypes[id] = VTK_HEXAHEDRON;
-            else if (nds.size() == 6)
+            else if (nbNodes == 6)
                 cellTypes[id] = VTK_WEDGE;
-            else if (nds.size() == 5)
+            else if (nbNodes == 5)
                 cellTypes[id] = VTK_PYRAMID;
-            else if (nds.size() == 4)
+            else if (nbNodes == 4)
                 cellTypes[id] = VTK_TETRA;
             else
             {
+                delete[] cellTypes;
+                idsArray->Delete();
+                cellArray->Delete();
+                points->Delete();
                 INTERNAL_ERROR(exc,
                         "Représentation volumique d'un polyèdre d'un type non prévu.",
                         "VTKGMDSEntityRepresentation::createMeshEntityVolumicRepresentation");
                 throw exc;
             }
-
-            cellsPtr[pos++] = nds.size();
-            for (size_t j = 0; j < nds.size(); j++)
-                cellsPtr[pos++] = node2id[nds[j]];
+            pos += nbNodes + 1;
         } // for (id = 0; id < polyedreNum; id++)
 
         cellArray->SetCells(polyedreNum, idsArray);
@@ -22,6 +22,7 @@ namespace Mgx3D
 namespace Mesh
 {
 class MeshEntity;
+class MeshLevelOfDetail;
 }
 
 /*!
@@ -175,9 +176,16 @@ private :
 	virtual void createCoFacesSurfacicRepresentationRatio1(std::vector<Topo::CoFace*> cofaces, gmds::IGMesh& gmdsMesh);
 
 	/**
-	 * Créé la représentation surfacique VTK pour des cofaces avec ratio de dégradation
+	 * Créé la représentation surfacique VTK à partir d'une représentation
+	 * dégradée (ratio de dégradation différent de 1)
 	 */
-	virtual void createCoFacesSurfacicRepresentationRatioN(std::vector<Topo::CoFace*> cofaces, gmds::IGMesh& gmdsMesh, int ratio);
+	virtual void createLevelOfDetailSurfacicRepresentation(const Mesh::MeshLevelOfDetail& lod);
+
+	/**
+	 * Remplit la grille avec les points et les mailles de la représentation
+	 * dégradée (hexaèdres puis polygones)
+	 */
+	virtual void createLevelOfDetailRepresentation(vtkUnstructuredGrid& grid, const Mesh::MeshLevelOfDetail& lod);
 
 
 	/**
@@ -436,14 +436,21 @@ void CommandManager::setUndoManager (UndoRedoManagerIfc* mgr)
 	AutoMutex	autoMutex (getMutex ( ));
 
 	TkUtil::LogOutputStream*	stream	= 0;
+	size_t						budget	= 0;
 	UndoRedoManager*	urm	= dynamic_cast<UndoRedoManager*>(_undoManager);
 	if (0 != urm)
+	{
 		stream	= urm->getLogStream ( );
+		budget	= urm->getMemoryBudget ( );
+	}	// if (0 != urm)
 	delete _undoManager;
 	_undoManager	= mgr;
 	urm	= dynamic_cast<UndoRedoManager*>(_undoManager);
 	if (0 != urm)
+	{
 		urm->setLogStream (stream);
+		urm->setMemoryBudget (budget);
+	}	// if (0 != urm)
 }
 
 
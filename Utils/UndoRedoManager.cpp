@@ -11,6 +11,9 @@
 #include "Utils/Magix3DEvents.h"
 #include "Utils/Command.h"
 #include <TkUtil/MemoryError.h>
+#include <TkUtil/InformationLog.h>
+#include <TkUtil/WarningLog.h>
+#include <TkUtil/UTF8String.h>
 
 
 using namespace TkUtil;
@@ -22,7 +25,8 @@ namespace Utils {
 /*----------------------------------------------------------------------------*/
 UndoRedoManager::UndoRedoManager(const std::string& name)
 	: UndoRedoManagerIfc ( ), ReferencedObject ( ),
-	  m_name (name), m_done ( ), m_undone ( ), m_mutex (0), m_logStream (0)
+	  m_name (name), m_done ( ), m_undone ( ), m_mutex (0), m_logStream (0),
+	  m_memoryBudget (0), m_memoryUsed (0), m_footprints ( ), m_horizon (0)
 {
 	m_mutex	= new Mutex ( );
 }
@@ -41,6 +45,9 @@ void UndoRedoManager::clear()
 {
 	m_done.clear ( );
 	m_undone.clear ( );
+	m_footprints.clear ( );
+	m_memoryUsed	= 0;
+	m_horizon		= 0;
 	unregisterReferences ( );	// Provoque l'éventuel suicide des commandes.
 }
 /*----------------------------------------------------------------------------*/
@@ -62,6 +69,19 @@ void UndoRedoManager::store(CommandIfc* command)
 		registerObservable (cmd, true);
     m_done.push_back(command);
 
+	// seule la mémoire que la commande saura libérer est décomptée
+	const size_t	footprint	= command->getReleasableMemory ( );
+	m_footprints [command]	= footprint;
+	m_memoryUsed	+= footprint;
+	UTF8String	message (Charset::UTF_8);
+	message << "Commande " << command->getName ( )
+	        << " : mémoire libérable conservée pour l'annulation " << footprint / 1024
+	        << " Ko (total " << m_memoryUsed / 1024 << " Ko pour "
+	        << m_done.size ( ) + m_undone.size ( ) << " commandes).";
+	log (InformationLog (message));
+
+	applyMemoryBudget ( );
+
 	notifyObserversForModification (COMMAND_STACK);
 }
 /*----------------------------------------------------------------------------*/
@@ -72,7 +92,9 @@ void UndoRedoManager::clearUndone()
     m_undone.clear ( );
     for (std::vector<CommandIfc*>::iterator iter = oldCommands.begin();
          iter != oldCommands.end(); ++iter)
-    {   // Les commandes se suicideront si elles n'ont pas un observateur
+    {
+        forgetMemoryFootprint (*iter);
+        // Les commandes se suicideront si elles n'ont pas un observateur
         // qui n'est pas d'accord :
         Command* cmd = dynamic_cast<Command*>(*iter);
         if (0 != cmd)
@@ -96,7 +118,8 @@ CommandIfc* UndoRedoManager::undoableCommand ( )
 {
 	AutoMutex	autoMutex (mutex ( ));
 
-	CommandIfc*	cmd	= 0 == m_done.size( ) ? 0 : m_done [m_done.size( ) - 1];
+	CommandIfc*	cmd	= m_done.size( ) <= m_horizon ?
+						  0 : m_done [m_done.size( ) - 1];
 
 	//std::cout <<" UndoRedoManager::undoableCommand retourne "<<(cmd?cmd->getName():"(pas de commande)")<<std::endl;
 
@@ -107,7 +130,8 @@ std::string UndoRedoManager::undoableCommandName ( ) const
 {
 	AutoMutex	autoMutex (mutex ( ));
 
-	const CommandIfc*	cmd	= 0 == m_done.size( ) ? 0 : m_done [m_done.size( ) - 1];
+	const CommandIfc*	cmd	= m_done.size( ) <= m_horizon ?
+							  0 : m_done [m_done.size( ) - 1];
 
 	return 0 == cmd ? "" : cmd->getName ( );
 }	// UndoRedoManager::undoableCommandName
@@ -116,6 +140,9 @@ CommandIfc* UndoRedoManager::undo()
 {
 	AutoMutex	autoMutex (mutex ( ));
 
+	if (m_done.size ( ) <= m_horizon)
+		throw Exception (UTF8String ("UndoRedoManager::undo : la dernière commande effectuée est sous l'horizon d'annulation.", Charset::UTF_8));
+
     CommandIfc* c =  m_done.back();
     m_done.pop_back();
     m_undone.push_back(c);
@@ -158,6 +185,81 @@ CommandIfc* UndoRedoManager::redo()
     return c;
 }
 /*----------------------------------------------------------------------------*/
+void UndoRedoManager::setMemoryBudget (size_t budget)
+{
+	AutoMutex	autoMutex (mutex ( ));
+
+	const size_t	horizon	= m_horizon;
+	m_memoryBudget	= budget;
+	applyMemoryBudget ( );
+
+	if (horizon != m_horizon)
+		notifyObserversForModification (COMMAND_STACK);
+}	// UndoRedoManager::setMemoryBudget
+/*----------------------------------------------------------------------------*/
+size_t UndoRedoManager::getMemoryBudget ( ) const
+{
+	return m_memoryBudget;
+}	// UndoRedoManager::getMemoryBudget
+/*----------------------------------------------------------------------------*/
+size_t UndoRedoManager::getMemoryUsed ( ) const
+{
+	return m_memoryUsed;
+}	// UndoRedoManager::getMemoryUsed
+/*----------------------------------------------------------------------------*/
+size_t UndoRedoManager::getUndoHorizon ( ) const
+{
+	return m_horizon;
+}	// UndoRedoManager::getUndoHorizon
+/*----------------------------------------------------------------------------*/
+void UndoRedoManager::applyMemoryBudget ( )
+{
+	AutoMutex	autoMutex (mutex ( ));
+
+	if (0 == m_memoryBudget)
+		return;
+
+	// mémoire libérable par les commandes que l'on peut passer sous
+	// l'horizon (la dernière commande effectuée reste annulable)
+	size_t	releasable	= 0;
+	for (size_t i = m_horizon; i + 1 < m_done.size ( ); i++)
+		releasable	+= m_footprints [m_done [i]];
+
+	// on n'avance pas l'horizon si plus rien ne peut être libéré
+	while ((m_memoryUsed > m_memoryBudget) && (0 != releasable))
+	{
+		CommandIfc*	command	= m_done [m_horizon];
+		m_horizon++;
+
+		// la commande ne compte plus dans le budget, qu'elle ait pu libérer
+		// ses données ou non
+		const size_t	freed	= m_footprints [command];
+		command->releaseUndoData ( );
+		m_footprints [command]	= 0;
+		m_memoryUsed	-= freed < m_memoryUsed ? freed : m_memoryUsed;
+		releasable		-= freed;
+
+		UTF8String	message (Charset::UTF_8);
+		message << "Budget mémoire d'annulation de " << m_memoryBudget / 1024
+		        << " Ko dépassé : la commande " << command->getName ( )
+		        << " ne peut plus être annulée (" << freed / 1024
+		        << " Ko libérés).";
+		log (WarningLog (message));
+	}	// while ((m_memoryUsed > m_memoryBudget) && ...
+}	// UndoRedoManager::applyMemoryBudget
+/*----------------------------------------------------------------------------*/
+void UndoRedoManager::forgetMemoryFootprint (CommandIfc* command)
+{
+	AutoMutex	autoMutex (mutex ( ));
+
+	std::map<CommandIfc*, size_t>::iterator	itf	= m_footprints.find (command);
+	if (m_footprints.end ( ) == itf)
+		return;
+
+	m_memoryUsed	-= itf->second < m_memoryUsed ? itf->second : m_memoryUsed;
+	m_footprints.erase (itf);
+}	// UndoRedoManager::forgetMemoryFootprint
+/*----------------------------------------------------------------------------*/
 bool UndoRedoManager::hasCommand (CommandIfc* command)
 {
 	AutoMutex	autoMutex (mutex ( ));
@@ -86,6 +86,21 @@ CommandIfc* UndoRedoManagerIfc::redo()
 	throw Exception ("UndoRedoManagerIfc::redo should be overloaded.");
 }
 /*----------------------------------------------------------------------------*/
+void UndoRedoManagerIfc::setMemoryBudget (size_t budget)
+{
+	throw Exception ("UndoRedoManagerIfc::setMemoryBudget should be overloaded.");
+}	// UndoRedoManagerIfc::setMemoryBudget
+/*----------------------------------------------------------------------------*/
+size_t UndoRedoManagerIfc::getMemoryBudget ( ) const
+{
+	throw Exception ("UndoRedoManagerIfc::getMemoryBudget should be overloaded.");
+}	// UndoRedoManagerIfc::getMemoryBudget
+/*----------------------------------------------------------------------------*/
+size_t UndoRedoManagerIfc::getMemoryUsed ( ) const
+{
+	throw Exception ("UndoRedoManagerIfc::getMemoryUsed should be overloaded.");
+}	// UndoRedoManagerIfc::getMemoryUsed
+/*----------------------------------------------------------------------------*/
 } // end namespace Utils
 /*----------------------------------------------------------------------------*/
 } // end namespace Mgx3D
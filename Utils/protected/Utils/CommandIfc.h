@@ -361,6 +361,39 @@ class CommandIfc
 	virtual TkUtil::Timer& getTimer ( );
 	//@}
 
+	/**
+	 * Méthodes relatives à la mémoire conservée par une commande en vue de
+	 * pouvoir être défaite.
+	 */
+	//@{
+	/**
+	 * \return		Une estimation, en octets, de la mémoire occupée par la
+	 *				commande et par les données qu'elle conserve pour être
+	 *				défaite. Retourne 0 par défaut.
+	 */
+	virtual size_t getMemoryFootprint ( ) const
+	{ return 0; }
+
+	/**
+	 * \return		Une estimation, en octets, de la mémoire que libérerait
+	 *				releaseUndoData. Retourne 0 par défaut (commande qui ne sait
+	 *				pas libérer ses données).
+	 */
+	virtual size_t getReleasableMemory ( ) const
+	{ return 0; }
+
+	/**
+	 * Libère les données conservées par une commande effectuée pour être
+	 * défaite. La commande ne peut alors plus être défaite, c'est au
+	 * gestionnaire d'annulation de ne plus le proposer.
+	 * \return		<I>true</I> si les données ont été libérées, <I>false</I>
+	 *				si la commande ne sait pas le faire (cas par défaut).
+	 * \see			getReleasableMemory
+	 */
+	virtual bool releaseUndoData ( )
+	{ return false; }
+	//@}
+
 
 	protected :
 
@@ -0,0 +1,106 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file EntityCache.h
+ *
+ *  \date 16/10/2026
+ *
+ *  Cache des entités non détruites d'un conteneur de manager
+ *  */
+/*----------------------------------------------------------------------------*/
+#ifndef UTILS_ENTITYCACHE_H_
+#define UTILS_ENTITYCACHE_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <algorithm>
+#include "Utils/Container.h"
+#include "Utils/Entity.h"
+#include <TkUtil/Mutex.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Utils {
+/*----------------------------------------------------------------------------*/
+/** \class EntityCache
+ *  \brief Vecteur trié (suivant l'unique id) des entités non détruites d'un
+ *  Container, avec leur nombre
+ *
+ *  Le cache porte un numéro de version incrémenté à chaque invalidation
+ *  (ajout ou retrait dans le conteneur, changement de l'état détruit d'une
+ *  entité). Il n'est reconstruit qu'à la première interrogation qui suit une
+ *  invalidation, les interrogations suivantes n'en font qu'une copie.
+ */
+/*----------------------------------------------------------------------------*/
+template<class T>
+class EntityCache{
+
+public:
+    EntityCache()
+    : m_version(1), m_cache_version(0), m_nb(0)
+    {}
+
+    /*----------------------------------------------------------------------------*/
+    /// le conteneur ou l'une de ses entités a changé
+    void invalidate()
+    {
+        TkUtil::AutoMutex autoMutex (&m_mutex);
+        m_version++;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// copie les entités non détruites du conteneur, triées suivant l'unique id
+    void get(const Container<T>& cont, std::vector<T* >& entities)
+    {
+        TkUtil::AutoMutex autoMutex (&m_mutex);
+        update(cont);
+        entities = m_sorted;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// \return  Le nombre d'entités non détruites du conteneur
+    uint getNb(const Container<T>& cont)
+    {
+        TkUtil::AutoMutex autoMutex (&m_mutex);
+        update(cont);
+        return m_nb;
+    }
+
+private:
+    /// reconstruit le cache si nécessaire
+    void update(const Container<T>& cont)
+    {
+        if (m_cache_version == m_version)
+            return;
+
+        const std::vector<T* >& all = cont.get();
+        m_sorted.clear();
+        m_sorted.reserve(all.size());
+        for (uint i = 0; i<all.size(); ++i)
+            if (!all[i]->isDestroyed())
+                m_sorted.push_back(all[i]);
+        std::sort(m_sorted.begin(), m_sorted.end(), Entity::compareEntity);
+        m_sorted.erase(std::unique(m_sorted.begin(), m_sorted.end()), m_sorted.end());
+        m_nb = m_sorted.size();
+
+        m_cache_version = m_version;
+    }
+
+    /// version courante et version à laquelle le cache a été construit
+    unsigned long m_version;
+    unsigned long m_cache_version;
+
+    /// les entités non détruites, triées
+    std::vector<T* > m_sorted;
+
+    /// nombre d'entités non détruites
+    uint m_nb;
+
+    /// protection des accès (interrogations depuis les threads de maillage)
+    TkUtil::Mutex m_mutex;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Utils
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* UTILS_ENTITYCACHE_H_ */
@@ -0,0 +1,109 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file NameIndex.h
+ *
+ *  \date 16/10/2026
+ *
+ *  Index nom -> entité pour les managers
+ *  */
+/*----------------------------------------------------------------------------*/
+#ifndef UTILS_NAMEINDEX_H_
+#define UTILS_NAMEINDEX_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Utils {
+/*----------------------------------------------------------------------------*/
+/** \class NameIndex
+ *  \brief Table de hachage sur les noms des entités d'un manager
+ *
+ *  Elle doit être maintenue en parallèle du conteneur du manager (ajout,
+ *  retrait, vidage). Le nom d'une entité ne change pas au cours de sa vie.
+ *
+ *  Plusieurs entités peuvent avoir le même nom (une entité détruite conservée
+ *  pour le undo et une nouvelle entité après retour en arrière des compteurs
+ *  du NameManager). Comme le faisait la recherche séquentielle dans le
+ *  conteneur, find retourne la dernière entité ajoutée avec ce nom, et
+ *  findFirst la première (pour les recherches qui s'arrêtaient à la
+ *  première entité trouvée).
+ */
+/*----------------------------------------------------------------------------*/
+template<class T>
+class NameIndex{
+
+public:
+    /// ajoute une entité
+    void add(T* entity)
+    {
+        m_index[entity->getName()].push_back(entity);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// ajoute un vecteur d'entités
+    void add(const std::vector<T* >& entities)
+    {
+        for (uint i = 0; i<entities.size(); ++i)
+            add(entities[i]);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// enlève l'entité si elle est présente
+    void remove(T* entity)
+    {
+        typename std::unordered_map<std::string, std::vector<T*> >::iterator iter =
+                m_index.find(entity->getName());
+        if (iter == m_index.end())
+            return;
+
+        std::vector<T*>& entities = iter->second;
+        typename std::vector<T*>::iterator iter2 = std::find(entities.begin(), entities.end(), entity);
+        if (iter2 != entities.end())
+            entities.erase(iter2);
+        if (entities.empty())
+            m_index.erase(iter);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// retourne la dernière entité ajoutée avec ce nom, 0 si aucune
+    T* find(const std::string& name) const
+    {
+        typename std::unordered_map<std::string, std::vector<T*> >::const_iterator iter =
+                m_index.find(name);
+        if (iter == m_index.end())
+            return 0;
+        return iter->second.back();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// retourne la première entité ajoutée avec ce nom, 0 si aucune
+    T* findFirst(const std::string& name) const
+    {
+        typename std::unordered_map<std::string, std::vector<T*> >::const_iterator iter =
+                m_index.find(name);
+        if (iter == m_index.end())
+            return 0;
+        return iter->second.front();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// vide l'index
+    void clear()
+    {
+        m_index.clear();
+    }
+
+private:
+    std::unordered_map<std::string, std::vector<T*> > m_index;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Utils
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* UTILS_NAMEINDEX_H_ */
@@ -0,0 +1,105 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ParallelExecution.h
+ *
+ *  \date 16/10/2026
+ *
+ *  Exécution de tâches indépendantes sur les threads disponibles
+ *  */
+/*----------------------------------------------------------------------------*/
+#ifndef UTILS_PARALLELEXECUTION_H_
+#define UTILS_PARALLELEXECUTION_H_
+/*----------------------------------------------------------------------------*/
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <exception>
+#include <sys/types.h> // pour uint
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Utils {
+/*----------------------------------------------------------------------------*/
+/// vrai pour les threads lancés par executeEnParallele
+inline bool& dansExecutionParallele()
+{
+    static thread_local bool dans = false;
+    return dans;
+}
+/*----------------------------------------------------------------------------*/
+/// vrai pendant l'exécution d'une tâche d'un gestionnaire de tâches (ThreadPool)
+inline bool& dansTacheParallele()
+{
+    static thread_local bool dans = false;
+    return dans;
+}
+/*----------------------------------------------------------------------------*/
+/** marque le thread courant comme exécutant une tâche parallèle d'un
+ *  gestionnaire de tâches, le temps de la vie de l'instance
+ */
+class TacheParallele{
+public:
+    TacheParallele() : m_avant(dansTacheParallele()) {dansTacheParallele() = true;}
+    ~TacheParallele() {dansTacheParallele() = m_avant;}
+private:
+    bool m_avant;
+};
+/*----------------------------------------------------------------------------*/
+/** exécute les tâches [0, nbTaches[ sur les threads disponibles,
+ *  une exception est relancée une fois tous les threads terminés.
+ *
+ *  Un appel depuis une tâche déjà exécutée en parallèle (par
+ *  executeEnParallele ou dans une TacheParallele) est séquentiel, ce
+ *  qui évite de multiplier les threads lors d'appels imbriqués.
+ */
+inline void executeEnParallele(uint nbTaches, const std::function<void(uint)>& tache)
+{
+    uint nbThreads = std::thread::hardware_concurrency();
+    if (nbThreads > nbTaches)
+        nbThreads = nbTaches;
+    if (nbThreads <= 1 || dansExecutionParallele() || dansTacheParallele()){
+        for (uint i=0; i<nbTaches; i++)
+            tache(i);
+        return;
+    }
+
+    std::atomic<uint> suivante(0);
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> erreurs(nbThreads);
+    for (uint t=0; t<nbThreads; t++)
+        threads.push_back(std::thread([&, t](){
+            dansExecutionParallele() = true;
+            try {
+                for (uint i=suivante++; i<nbTaches; i=suivante++)
+                    tache(i);
+            }
+            catch (...){
+                erreurs[t] = std::current_exception();
+            }
+        }));
+    for (uint t=0; t<nbThreads; t++)
+        threads[t].join();
+
+    for (uint t=0; t<nbThreads; t++)
+        if (erreurs[t])
+            std::rethrow_exception(erreurs[t]);
+}
+/*----------------------------------------------------------------------------*/
+/// exécute tache(début, fin) sur des tranches de taille tranche de [0, nb[
+inline void executeParTranches(size_t nb, size_t tranche,
+        const std::function<void(size_t, size_t)>& tache)
+{
+    uint nbTaches = (nb + tranche - 1) / tranche;
+    executeEnParallele(nbTaches, [&](uint t){
+        size_t fin = (t+1)*tranche;
+        tache(t*tranche, fin < nb ? fin : nb);
+    });
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Utils
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* UTILS_PARALLELEXECUTION_H_ */
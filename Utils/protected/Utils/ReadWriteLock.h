@@ -0,0 +1,97 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ReadWriteLock.h
+ *
+ *  \date 16/10/2026
+ *
+ *  Verrou lecteurs / écrivain
+ *  */
+/*----------------------------------------------------------------------------*/
+#ifndef UTILS_READWRITELOCK_H_
+#define UTILS_READWRITELOCK_H_
+/*----------------------------------------------------------------------------*/
+#include <pthread.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Utils {
+/*----------------------------------------------------------------------------*/
+/** \class ReadWriteLock
+ *  \brief Verrou permettant plusieurs lecteurs simultanés ou un seul écrivain
+ *
+ *  Contrairement à TkUtil::Mutex, il n'est pas récursif : le code protégé
+ *  en écriture ne doit pas reprendre le verrou.
+ */
+/*----------------------------------------------------------------------------*/
+class ReadWriteLock{
+
+public:
+    ReadWriteLock()
+    {
+        pthread_rwlock_init(&m_lock, 0);
+    }
+
+    ~ReadWriteLock()
+    {
+        pthread_rwlock_destroy(&m_lock);
+    }
+
+    /// verrouillage en lecture (partagé)
+    void readLock() {pthread_rwlock_rdlock(&m_lock);}
+
+    /// verrouillage en écriture (exclusif)
+    void writeLock() {pthread_rwlock_wrlock(&m_lock);}
+
+    /// déverrouillage
+    void unlock() {pthread_rwlock_unlock(&m_lock);}
+
+private:
+    /// constructeur par copie et opérateur = interdits
+    ReadWriteLock(const ReadWriteLock&);
+    ReadWriteLock& operator = (const ReadWriteLock&);
+
+    pthread_rwlock_t m_lock;
+};
+/*----------------------------------------------------------------------------*/
+/** \class AutoReadLock
+ *  \brief Verrouillage en lecture pour la durée de vie de l'instance
+ */
+class AutoReadLock{
+public:
+    AutoReadLock(ReadWriteLock* lock)
+    : m_lock(lock)
+    {m_lock->readLock();}
+
+    ~AutoReadLock() {m_lock->unlock();}
+
+private:
+    AutoReadLock(const AutoReadLock&);
+    AutoReadLock& operator = (const AutoReadLock&);
+
+    ReadWriteLock* m_lock;
+};
+/*----------------------------------------------------------------------------*/
+/** \class AutoWriteLock
+ *  \brief Verrouillage en écriture pour la durée de vie de l'instance
+ */
+class AutoWriteLock{
+public:
+    AutoWriteLock(ReadWriteLock* lock)
+    : m_lock(lock)
+    {m_lock->writeLock();}
+
+    ~AutoWriteLock() {m_lock->unlock();}
+
+private:
+    AutoWriteLock(const AutoWriteLock&);
+    AutoWriteLock& operator = (const AutoWriteLock&);
+
+    ReadWriteLock* m_lock;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Utils
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* UTILS_READWRITELOCK_H_ */
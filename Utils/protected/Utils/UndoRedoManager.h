@@ -13,6 +13,7 @@
 #include <TkUtil/ReferencedObject.h>
 #include <TkUtil/LogOutputStream.h>
 #include <vector>
+#include <map>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -117,6 +118,28 @@ public:
      */
     virtual CommandIfc* redo();
 
+	/**
+	 * Méthodes relatives à la mémoire occupée par les commandes conservées.
+	 * La mémoire libérable de chaque commande est estimée lors de son
+	 * stockage (CommandIfc::getReleasableMemory). Lorsque le budget est
+	 * dépassé, les données d'annulation des commandes effectuées les plus
+	 * anciennes sont libérées (CommandIfc::releaseUndoData) : elles passent
+	 * alors sous l'horizon d'annulation et ne peuvent plus être défaites.
+	 * L'horizon n'avance pas si aucune commande avant la dernière effectuée
+	 * (toujours annulable) ne peut libérer de mémoire.
+	 */
+	//@{
+	virtual void setMemoryBudget (size_t budget);
+	virtual size_t getMemoryBudget ( ) const;
+	virtual size_t getMemoryUsed ( ) const;
+
+	/**
+	 * \return	Le nombre de commandes effectuées qui ne peuvent plus être
+	 *			défaites.
+	 */
+	virtual size_t getUndoHorizon ( ) const;
+	//@}
+
 	/**
 	 * Méthodes relatives à l'affichage d'informations relatives à l'instance
 	 * dans des flux.
@@ -160,6 +183,19 @@ public:
 	 */
 	virtual void log (const TkUtil::Log& log);
 
+	/**
+	 * Libère les données d'annulation des commandes effectuées les plus
+	 * anciennes tant que le budget mémoire est dépassé et que de la mémoire
+	 * peut être libérée.
+	 */
+	virtual void applyMemoryBudget ( );
+
+	/**
+	 * Retire la commande transmise en argument du décompte de la mémoire
+	 * occupée.
+	 */
+	virtual void forgetMemoryFootprint (CommandIfc* command);
+
 
 private:
 
@@ -173,6 +209,15 @@ private:
 	mutable TkUtil::Mutex*				m_mutex;
 	/** L'éventuel afficheur. */
 	TkUtil::LogOutputStream*			m_logStream;
+	/** Le budget mémoire, en octets (0 : illimité). */
+	size_t								m_memoryBudget;
+	/** La mémoire libérable estimée des commandes conservées, en octets. */
+	size_t								m_memoryUsed;
+	/** La mémoire libérable estimée de chacune des commandes conservées. */
+	std::map<CommandIfc*, size_t>		m_footprints;
+	/** Le nombre de commandes en tête de m_done qui ne peuvent plus être
+	 * défaites. */
+	size_t								m_horizon;
 
 };
 /*----------------------------------------------------------------------------*/
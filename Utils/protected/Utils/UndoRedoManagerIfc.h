@@ -11,6 +11,7 @@
 /*----------------------------------------------------------------------------*/
 #include <vector>
 #include <string>
+#include <cstddef>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -105,6 +106,25 @@ public:
      */
     virtual CommandIfc* redo();
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  Budget mémoire, en octets, des commandes conservées pour être
+     *          défaites (0 : illimité). Au delà, les données d'annulation
+     *          des commandes les plus anciennes sont libérées et ces
+     *          commandes ne peuvent plus être défaites.
+     */
+    virtual void setMemoryBudget (size_t budget);
+
+    /**
+     * \return Le budget mémoire, en octets, des commandes (0 : illimité).
+     */
+    virtual size_t getMemoryBudget ( ) const;
+
+    /**
+     * \return Une estimation, en octets, de la mémoire occupée par les
+     *         commandes conservées.
+     */
+    virtual size_t getMemoryUsed ( ) const;
+
 
 	protected :
 
@@ -67,6 +67,7 @@ using std::ptrdiff_t;
 #include "Topo/BlockMeshingPropertyDelaunayTetgen.h"
 #include "Topo/BlockMeshingPropertyInsertion.h"
 
+#include "Mesh/MeshComparisonReport.h"
 #include "Mesh/MeshManagerIfc.h"
 #include "Smoothing/SurfacicSmoothing.h"
 #include "Smoothing/VolumicSmoothing.h"
@@ -345,6 +346,7 @@ using std::ptrdiff_t;
 %include Topo/BlockMeshingPropertyDelaunayTetgen.h
 %include Topo/BlockMeshingPropertyInsertion.h
 
+%include Mesh/MeshComparisonReport.h
 %include Mesh/MeshManagerIfc.h
 %include Smoothing/SurfacicSmoothing.h
 %include Smoothing/VolumicSmoothing.h
@@ -380,6 +382,18 @@ using std::ptrdiff_t;
 	return &temp[0];
   }
 }
+%extend Mgx3D::Mesh::MeshComparisonReport {
+  std::string __str__() {
+	return $self->toString();
+  }
+  // pour un test direct du résultat (if mm.compareWithMesh(...):)
+  bool __bool__() {
+	return $self->isOk();
+  }
+  bool __nonzero__() {
+	return $self->isOk();
+  }
+}
 
 // surcharges de fonctions pour utilisation de script Erebos
 // il est nécessaire de faire 'from pyMagix3D import *' au début et non 'import pyMagix3D as Mgx3D'
@@ -832,6 +832,7 @@ Différence Booléenne de n entités géométriques avec la première entité qu
 
 tokeep : l'entité que l'on conserve 
 tocut : les entités que l'on retire de tokeep 
+tolerance : (optionnel) tolérance de l'opération OCC (fuzzy), non utilisée si nulle 
 
 ";
 %feature("docstring") Mgx3D::Geom::GeomManagerIfc::destroy "
@@ -882,6 +883,7 @@ virtual Mgx3D::Internal::M3DCommandResultIfc* Mgx3D::Geom::GeomManagerIfc::fuse(
 Union Booléenne de n entités géométriques. 
 
 entities : les entités sur lesquelles on travaille 
+tolerance : (optionnel) tolérance de l'opération OCC (fuzzy), non utilisée si nulle 
 
 ";
 %feature("docstring") Mgx3D::Geom::GeomManagerIfc::getCurves "
@@ -1270,7 +1272,7 @@ Interface de gestionnaire des opérations effectuées au niveau des groupes.
 ";
 
 %feature("docstring") Mgx3D::Group::GroupManagerIfc::addCartesianPerturbation "
-virtual void Mgx3D::Group::GroupManagerIfc::addCartesianPerturbation(const std::string &nom, PyObject *py_obj)
+virtual void Mgx3D::Group::GroupManagerIfc::addCartesianPerturbation(const std::string &nom, PyObject *py_obj, bool batch=false)
 
 
 Ajoute une modification du maillage pour un groupe (2D ou 3D)
@@ -1278,10 +1280,11 @@ Il peut s'agir d'une perturbation sous forme de fonction Python Les coordonnées
 
 nom : nom du groupe avec lequel on effectue la perturbation 
 py_obj : l'objet python auquel il est fait appel pour modifier le maillage 
+batch : si vrai, l'objet python est appelé une seule fois avec les 3 tableaux (memoryview de doubles en Python 3, listes en Python 2) des coordonnées de tous les noeuds à modifier, et retourne les 3 tableaux des nouvelles coordonnées (ou None s'il a modifié les tableaux reçus). Sinon il est appelé pour chaque noeud. 
 
 ";
 %feature("docstring") Mgx3D::Group::GroupManagerIfc::addPolarPerturbation "
-virtual void Mgx3D::Group::GroupManagerIfc::addPolarPerturbation(const std::string &nom, PyObject *py_obj)
+virtual void Mgx3D::Group::GroupManagerIfc::addPolarPerturbation(const std::string &nom, PyObject *py_obj, bool batch=false)
 
 
 Ajoute une modification du maillage pour un groupe (2D ou 3D)
@@ -1289,6 +1292,7 @@ Il peut s'agir d'une perturbation sous forme de fonction Python Les coordonnées
 
 nom : nom du groupe avec lequel on effectue la perturbation 
 py_obj : l'objet python auquel il est fait appel pour modifier le maillage 
+batch : si vrai, l'objet python est appelé une seule fois avec les 3 tableaux (memoryview de doubles en Python 3, listes en Python 2) des coordonnées de tous les noeuds à modifier, et retourne les 3 tableaux des nouvelles coordonnées (ou None s'il a modifié les tableaux reçus). Sinon il est appelé pour chaque noeud. 
 
 ";
 %feature("docstring") Mgx3D::Group::GroupManagerIfc::addSmoothing "
@@ -1404,9 +1408,9 @@ Gestionnaire des opérations effectuées au niveau du module de maillage. Le ges
 ";
 
 %feature("docstring") Mgx3D::Mesh::MeshManagerIfc::compareWithMesh "
-virtual bool Mgx3D::Mesh::MeshManagerIfc::compareWithMesh(std::string nom)
+virtual MeshComparisonReport Mgx3D::Mesh::MeshManagerIfc::compareWithMesh(std::string nom, double tolerance=0.0)
 
-Compare le maillage actuel avec un maillage sur disque, return true si ok. 
+Compare le maillage actuel avec un maillage sur disque (format lima), les noeuds sont appariés à la tolérance près (une tolérance nulle prend la racine de MgxNumeric::mgxDoubleEpsilon). Retourne le résultat de la comparaison, isOk() si les maillages sont identiques. 
 
 ";
 %feature("docstring") Mgx3D::Mesh::MeshManagerIfc::getInfos "
@@ -1876,10 +1880,22 @@ Constructeur pour fonction de lissage surfacique avec les arguments par défaut.
 
 ";
 %feature("docstring") Mgx3D::Mesh::SurfacicSmoothing::SurfacicSmoothing "
-Mgx3D::Mesh::SurfacicSmoothing::SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solver)
+Mgx3D::Mesh::SurfacicSmoothing::SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solver, int patchSize=0)
 
 Constructeur avec paramètres différents du défaut. 
 
+";
+%feature("docstring") Mgx3D::Mesh::SurfacicSmoothing::getPatchSize "
+int Mgx3D::Mesh::SurfacicSmoothing::getPatchSize() const 
+
+accesseur sur le nombre de mailles par patch (0 pour un lissage sans découpage) 
+
+";
+%feature("docstring") Mgx3D::Mesh::SurfacicSmoothing::setPatchSize "
+void Mgx3D::Mesh::SurfacicSmoothing::setPatchSize(int patchSize)
+
+change le nombre de mailles par patch, le lissage se fait alors par patchs colorés traités en parallèle 
+
 ";
 %feature("docstring") Mgx3D::Topo::TopoManagerIfc " 
 Interface de gestionnaire des opérations effectuées au niveau du module topologique. 
@@ -2551,10 +2567,22 @@ Constructeur pour fonction de lissage volumique avec les arguments par défaut.
 
 ";
 %feature("docstring") Mgx3D::Mesh::VolumicSmoothing::VolumicSmoothing "
-Mgx3D::Mesh::VolumicSmoothing::VolumicSmoothing(int nbIterations, eVolumicMethod methodeLissage)
+Mgx3D::Mesh::VolumicSmoothing::VolumicSmoothing(int nbIterations, eVolumicMethod methodeLissage, int patchSize=0)
 
 Constructeur avec paramètres différents du défaut. 
 
+";
+%feature("docstring") Mgx3D::Mesh::VolumicSmoothing::getPatchSize "
+int Mgx3D::Mesh::VolumicSmoothing::getPatchSize() const 
+
+accesseur sur le nombre de mailles par patch (0 pour un lissage sans découpage) 
+
+";
+%feature("docstring") Mgx3D::Mesh::VolumicSmoothing::setPatchSize "
+void Mgx3D::Mesh::VolumicSmoothing::setPatchSize(int patchSize)
+
+change le nombre de mailles par patch, le lissage se fait alors par patchs colorés traités en parallèle 
+
 ";
 %feature("docstring") gmds " 
 